@@ -0,0 +1,259 @@
+// gateway-routing-helper.cc
+
+#include "gateway-routing-helper.hpp"
+
+#include "ns3/assert.h"
+#include "ns3/channel-list.h"
+#include "ns3/ipv4.h"
+#include "ns3/log.h"
+#include "ns3/node-list.h"
+
+#include "ns3/ndnSIM/helper/ndn-fib-helper.hpp"
+
+#include <limits>
+#include <queue>
+
+NS_LOG_COMPONENT_DEFINE("GatewayRoutingHelper");
+
+namespace ns3 {
+
+void
+GatewayRoutingHelper::Install(Ptr<Node> node)
+{
+  m_globalRouting.Install(node);
+}
+
+void
+GatewayRoutingHelper::Install(const NodeContainer& nodes)
+{
+  m_globalRouting.Install(nodes);
+}
+
+void
+GatewayRoutingHelper::InstallAll()
+{
+  m_globalRouting.InstallAll();
+}
+
+void
+GatewayRoutingHelper::AddGateway(Ptr<Node> node)
+{
+  Ptr<Ipv4> ipv4 = node->GetObject<Ipv4>();
+  NS_ASSERT_MSG(ipv4 != nullptr, "Gateway " << node->GetId() << " has no IP stack");
+  AddGateway(node, ipv4->GetAddress(1, 0).GetLocal());
+}
+
+void
+GatewayRoutingHelper::AddGateway(Ptr<Node> node, Ipv4Address address)
+{
+  NS_ASSERT_MSG(!m_isCalculated, "Gateways must be added before CalculateRoutes()");
+
+  Ptr<GatewayApp> app;
+  for (uint32_t i = 0; i < node->GetNApplications() && app == nullptr; i++) {
+    app = DynamicCast<GatewayApp>(node->GetApplication(i));
+  }
+  NS_ASSERT_MSG(app != nullptr, "GatewayApp is not installed on node " << node->GetId());
+
+  m_gateways.push_back({app, address, 0});
+}
+
+void
+GatewayRoutingHelper::AddOrigin(const std::string& prefix, Ptr<Node> node)
+{
+  m_globalRouting.AddOrigin(prefix, node);
+  if (!m_isCalculated) {
+    return;
+  }
+
+  auto vertex = m_vertices.find(PeekPointer(node->GetObject<ndn::GlobalRouter>()));
+  NS_ASSERT_MSG(vertex != m_vertices.end(), "Node " << node->GetId() << " was not routed");
+  InstallOrigin(vertex->second, {std::make_shared<ndn::Name>(prefix)});
+}
+
+void
+GatewayRoutingHelper::AddOrigins(const std::string& prefix, const NodeContainer& nodes)
+{
+  for (NodeContainer::Iterator node = nodes.Begin(); node != nodes.End(); node++) {
+    AddOrigin(prefix, *node);
+  }
+}
+
+void
+GatewayRoutingHelper::CalculateRoutes()
+{
+  NS_ASSERT_MSG(!m_isCalculated, "Routes are already calculated");
+  BuildGraph();
+
+  for (auto& gateway : m_gateways) {
+    Ptr<ndn::GlobalRouter> gr = gateway.app->GetNode()->GetObject<ndn::GlobalRouter>();
+    auto vertex = m_vertices.find(PeekPointer(gr));
+    NS_ASSERT_MSG(vertex != m_vertices.end(), "GlobalRouter is not installed on a gateway");
+    gateway.vertex = vertex->second;
+  }
+
+  // the prefixes of the other domains are reached through the nearest gateway
+  m_gatewayRoutes.assign(m_nodes.size(), Route{nullptr, std::numeric_limits<uint32_t>::max(), 0});
+  for (size_t domain = 0; domain < m_domainVertices.size(); domain++) {
+    std::vector<size_t> gateways;
+    for (size_t i = 0; i < m_gateways.size(); i++) {
+      if (m_domains[m_gateways[i].vertex] == domain) {
+        gateways.push_back(i);
+      }
+    }
+    if (gateways.empty()) {
+      NS_LOG_DEBUG("Domain " << domain << " has no gateway");
+      continue;
+    }
+
+    std::vector<size_t> targets;
+    for (size_t gateway : gateways) {
+      targets.push_back(m_gateways[gateway].vertex);
+    }
+    auto routes = FindRoutes(domain, targets);
+    for (size_t i = 0; i < routes.size(); i++) {
+      size_t vertex = m_domainVertices[domain][i];
+      m_gatewayRoutes[vertex] = routes[i];
+      m_gatewayRoutes[vertex].target = gateways[routes[i].target];
+
+      // one default route per node, rather than one route per remote prefix
+      if (m_nodes[vertex] != nullptr && routes[i].face != nullptr) {
+        ndn::FibHelper::AddRoute(m_nodes[vertex], "/", routes[i].face, routes[i].metric);
+      }
+    }
+  }
+  m_isCalculated = true;
+
+  for (size_t vertex = 0; vertex < m_nodes.size(); vertex++) {
+    if (m_nodes[vertex] == nullptr) {
+      continue;
+    }
+    const auto& prefixes = m_nodes[vertex]->GetObject<ndn::GlobalRouter>()->GetLocalPrefixes();
+    if (!prefixes.empty()) {
+      InstallOrigin(vertex, prefixes);
+    }
+  }
+}
+
+void
+GatewayRoutingHelper::BuildGraph()
+{
+  std::vector<Ptr<ndn::GlobalRouter>> routers;
+  for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
+    Ptr<ndn::GlobalRouter> gr = (*node)->GetObject<ndn::GlobalRouter>();
+    if (gr != nullptr) {
+      m_vertices.emplace(PeekPointer(gr), routers.size());
+      routers.push_back(gr);
+      m_nodes.push_back(*node);
+    }
+  }
+  for (ChannelList::Iterator channel = ChannelList::Begin(); channel != ChannelList::End();
+       channel++) {
+    Ptr<ndn::GlobalRouter> gr = (*channel)->GetObject<ndn::GlobalRouter>();
+    if (gr != nullptr) {
+      m_vertices.emplace(PeekPointer(gr), routers.size());
+      routers.push_back(gr);
+      m_nodes.push_back(nullptr);
+    }
+  }
+
+  m_inHops.resize(routers.size());
+  for (size_t i = 0; i < routers.size(); i++) {
+    for (const auto& incidency : routers[i]->GetIncidencies()) {
+      const auto& face = std::get<1>(incidency);
+      uint32_t metric = face == nullptr ? 0 : face->getMetric();
+      m_inHops[m_vertices.at(PeekPointer(std::get<2>(incidency)))].push_back({i, face, metric});
+    }
+  }
+
+  // domains are the connected parts of the NDN graph, links are present in both directions
+  m_domains.assign(routers.size(), std::numeric_limits<size_t>::max());
+  m_domainIndices.assign(routers.size(), 0);
+  for (size_t start = 0; start < routers.size(); start++) {
+    if (m_domains[start] != std::numeric_limits<size_t>::max()) {
+      continue;
+    }
+    size_t domain = m_domainVertices.size();
+    m_domainVertices.emplace_back(1, start);
+    m_domains[start] = domain;
+    for (size_t next = 0; next < m_domainVertices[domain].size(); next++) {
+      for (const auto& hop : m_inHops[m_domainVertices[domain][next]]) {
+        if (m_domains[hop.from] == std::numeric_limits<size_t>::max()) {
+          m_domains[hop.from] = domain;
+          m_domainIndices[hop.from] = m_domainVertices[domain].size();
+          m_domainVertices[domain].push_back(hop.from);
+        }
+      }
+    }
+  }
+  NS_LOG_DEBUG(routers.size() << " vertices in " << m_domainVertices.size() << " domains");
+}
+
+std::vector<GatewayRoutingHelper::Route>
+GatewayRoutingHelper::FindRoutes(size_t domain, const std::vector<size_t>& targets) const
+{
+  const auto& vertices = m_domainVertices[domain];
+  std::vector<Route> routes(vertices.size(),
+                            Route{nullptr, std::numeric_limits<uint32_t>::max(), 0});
+
+  // Dijkstra from the targets over reversed links: the route of a vertex starts with the face
+  // of its link toward the vertex that reached it
+  using Entry = std::pair<uint32_t, size_t>;
+  std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> queue;
+  for (size_t i = 0; i < targets.size(); i++) {
+    size_t index = m_domainIndices[targets[i]];
+    routes[index] = Route{nullptr, 0, i};
+    queue.emplace(0, index);
+  }
+
+  while (!queue.empty()) {
+    Entry entry = queue.top();
+    queue.pop();
+    const Route& route = routes[entry.second];
+    if (entry.first != route.metric) {
+      continue;
+    }
+    for (const auto& hop : m_inHops[vertices[entry.second]]) {
+      uint32_t metric = route.metric + hop.metric;
+      Route& other = routes[m_domainIndices[hop.from]];
+      if (metric < other.metric) {
+        other = Route{hop.face, metric, route.target};
+        queue.emplace(metric, m_domainIndices[hop.from]);
+      }
+    }
+  }
+  return routes;
+}
+
+void
+GatewayRoutingHelper::InstallOrigin(size_t vertex,
+                                    const ndn::GlobalRouter::LocalPrefixList& prefixes)
+{
+  size_t domain = m_domains[vertex];
+
+  auto routes = FindRoutes(domain, {vertex});
+  for (size_t i = 0; i < routes.size(); i++) {
+    Ptr<Node> node = m_nodes[m_domainVertices[domain][i]];
+    if (node == nullptr || routes[i].face == nullptr) {
+      continue;
+    }
+    for (const auto& prefix : prefixes) {
+      ndn::FibHelper::AddRoute(node, *prefix, routes[i].face, routes[i].metric);
+    }
+  }
+
+  if (m_gatewayRoutes[vertex].metric == std::numeric_limits<uint32_t>::max()) {
+    NS_LOG_DEBUG("Domain " << domain << " has no gateway, its prefixes are not tunneled");
+    return;
+  }
+  Ipv4Address address = m_gateways[m_gatewayRoutes[vertex].target].address;
+  for (const auto& gateway : m_gateways) {
+    if (m_domains[gateway.vertex] == domain) {
+      continue;
+    }
+    for (const auto& prefix : prefixes) {
+      gateway.app->GetGtt().AddRoute(*prefix, address);
+    }
+  }
+}
+
+} // namespace ns3
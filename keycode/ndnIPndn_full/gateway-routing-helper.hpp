@@ -0,0 +1,152 @@
+// gateway-routing-helper.hpp
+
+#ifndef GATEWAY_ROUTING_HELPER_H_
+#define GATEWAY_ROUTING_HELPER_H_
+
+#include "gatewayApp.hpp"
+
+#include "ns3/ipv4-address.h"
+#include "ns3/node.h"
+#include "ns3/node-container.h"
+
+#include "ns3/ndnSIM/helper/ndn-global-routing-helper.hpp"
+#include "ns3/ndnSIM/model/ndn-global-router.hpp"
+
+#include <unordered_map>
+#include <vector>
+
+namespace ns3 {
+
+/** \brief Global routing for NDN domains joined by IP gateways
+ *
+ *  A domain is a set of nodes connected by NDN links; domains reach each other only through
+ *  the IP tunnels of the GatewayApps. CalculateRoutes() installs, in every domain, the routes
+ *  to the prefixes originated in the domain and a default route to the nearest gateway of the
+ *  domain for all other prefixes, so the stack must not install its own default routes.
+ *  The GTT of every gateway maps the prefixes of the other domains to the gateway of the
+ *  originating domain that is nearest to the origin.
+ *
+ *  Each domain runs one shortest path computation per origin and one for its gateways, so
+ *  the setup grows with the size of the domains rather than with the square of the topology.
+ *  Once routes are calculated, AddOrigin() installs the routes and GTT entries of a new
+ *  prefix without recomputing the others.
+ *
+ *  A GlobalRoutingHelper member installs the GlobalRouters and records the origins, but the
+ *  routes are calculated here only: GlobalRoutingHelper::CalculateRoutes() must not be used on
+ *  the same nodes.
+ *
+ *  \code
+ *  GatewayRoutingHelper routing;
+ *  routing.Install(ndnNodes);
+ *  routing.AddGateway(iGate1);
+ *  routing.AddGateway(iGate2);
+ *  routing.AddOrigin("/domain1/src1", node1);
+ *  routing.CalculateRoutes();
+ *  \endcode
+ */
+class GatewayRoutingHelper
+{
+public:
+  /** \brief Install the GlobalRouter interface on \p node
+   */
+  void
+  Install(Ptr<Node> node);
+
+  /** \brief Install the GlobalRouter interface on \p nodes
+   */
+  void
+  Install(const NodeContainer& nodes);
+
+  /** \brief Install the GlobalRouter interface on all nodes
+   */
+  void
+  InstallAll();
+
+  /** \brief Register the GatewayApp installed on \p node
+   *
+   *  The gateway is reached at the address of its first IP interface, the one GatewayApp
+   *  puts in the tunnel header.
+   */
+  void
+  AddGateway(Ptr<Node> node);
+
+  /** \brief Register the GatewayApp installed on \p node, reached at \p address
+   */
+  void
+  AddGateway(Ptr<Node> node, Ipv4Address address);
+
+  /** \brief Add \p prefix as origin on \p node
+   *
+   *  After CalculateRoutes(), the routes and GTT entries of \p prefix are installed at once.
+   */
+  void
+  AddOrigin(const std::string& prefix, Ptr<Node> node);
+
+  /** \brief Add \p prefix as origin on all \p nodes
+   */
+  void
+  AddOrigins(const std::string& prefix, const NodeContainer& nodes);
+
+  /** \brief Calculate the routes of every domain and fill the GTT of every gateway
+   *
+   *  The NDN links and the gateways must not change afterwards.
+   */
+  void
+  CalculateRoutes();
+
+private:
+  /** \brief Link from a vertex, through a face of that vertex
+   */
+  struct Hop
+  {
+    size_t from;
+    std::shared_ptr<ndn::Face> face; ///< nullptr on links that leave a channel
+    uint32_t metric;
+  };
+
+  /** \brief First hop of the shortest path from a vertex to the nearest of several targets
+   */
+  struct Route
+  {
+    std::shared_ptr<ndn::Face> face; ///< nullptr on the targets and on unreachable vertices
+    uint32_t metric;
+    size_t target; ///< index of the nearest target
+  };
+
+  struct Gateway
+  {
+    Ptr<GatewayApp> app;
+    Ipv4Address address;
+    size_t vertex;
+  };
+
+  void
+  BuildGraph();
+
+  /** \brief Shortest paths from every vertex of \p domain to the nearest of \p targets
+   *  \return routes indexed by the position of the vertex in m_domainVertices[domain]
+   */
+  std::vector<Route>
+  FindRoutes(size_t domain, const std::vector<size_t>& targets) const;
+
+  void
+  InstallOrigin(size_t vertex, const ndn::GlobalRouter::LocalPrefixList& prefixes);
+
+private:
+  ndn::GlobalRoutingHelper m_globalRouting;
+
+  std::vector<Ptr<Node>> m_nodes; ///< nullptr for channels
+  std::vector<std::vector<Hop>> m_inHops;
+  std::unordered_map<ndn::GlobalRouter*, size_t> m_vertices;
+  std::vector<size_t> m_domains;
+  std::vector<size_t> m_domainIndices; ///< position of each vertex in its domain
+  std::vector<std::vector<size_t>> m_domainVertices;
+
+  std::vector<Gateway> m_gateways;
+  std::vector<Route> m_gatewayRoutes; ///< per vertex, to the nearest gateway of its domain
+  bool m_isCalculated = false;
+};
+
+} // namespace ns3
+
+#endif // GATEWAY_ROUTING_HELPER_H_
@@ -29,9 +29,12 @@
 
 #include "ns3/ndnSIM/helper/ndn-stack-helper.hpp"
 #include "ns3/ndnSIM/helper/ndn-fib-helper.hpp"
+#include "ns3/ndnSIM/model/ndn-l3-protocol.hpp"
+#include "ns3/ndnSIM/NFD/daemon/fw/forwarder.hpp"
 
 #include "ns3/random-variable-stream.h"
 #include "ndn-cxx/encoding/block.hpp"
+#include "ndn-cxx/interest-view.hpp"
 #include "ndn-cxx/encoding/buffer-stream.hpp"
 #include "ndn-cxx/encoding/encoding-buffer.hpp"
 #include "ns3/ndnSIM/model/ndn-block-header.hpp"
@@ -46,7 +49,25 @@ NS_OBJECT_ENSURE_REGISTERED (GatewayApp);
 TypeId
 GatewayApp::GetTypeId ()
 {
-  static TypeId tid = TypeId ("GatewayApp").SetParent<ndn::App> ().AddConstructor<GatewayApp> ();
+  static TypeId tid =
+      TypeId ("GatewayApp")
+          .SetParent<ndn::App> ()
+          .AddConstructor<GatewayApp> ()
+          .AddTraceSource ("TunnelTx", "A packet is sent through the tunnel to a gateway",
+                           MakeTraceSourceAccessor (&GatewayApp::m_tunnelTx),
+                           "ns3::GatewayApp::TunnelTracedCallback")
+          .AddTraceSource ("TunnelRx", "An Interest or Data is received from the tunnel",
+                           MakeTraceSourceAccessor (&GatewayApp::m_tunnelRx),
+                           "ns3::GatewayApp::TunnelRxTracedCallback")
+          .AddTraceSource ("Drop", "A packet has no gateway to go to or cannot be sent",
+                           MakeTraceSourceAccessor (&GatewayApp::m_drop),
+                           "ns3::GatewayApp::TunnelTracedCallback")
+          .AddTraceSource ("GttLookup", "The gateway of an Interest is looked up in the GTT",
+                           MakeTraceSourceAccessor (&GatewayApp::m_gttLookup),
+                           "ns3::GatewayApp::GttLookupTracedCallback")
+          .AddTraceSource ("DttSize", "Number of prefixes in the DTT",
+                           MakeTraceSourceAccessor (&GatewayApp::m_dttSize),
+                           "ns3::TracedValueCallback::Uint32");
 
   /*.AddAttribute ("GttRecords",
                    "The initiated GttRecords",
@@ -73,15 +94,7 @@ GatewayApp::StartApplication ()
   //tunnel port
   m_tunnelPort = 7776;
 
-  //gtt insert
-  m_gtt = GttTable ();
-  m_gtt.AddRoute (ndn::Name ("/domain1/src2"), Ipv4Address ("10.1.1.1"));
-  m_gtt.AddRoute (ndn::Name ("/domain1/src1"), Ipv4Address ("10.1.1.1"));
-  m_gtt.AddRoute (ndn::Name ("/domain1/iGate1"), Ipv4Address ("10.1.1.1"));
-  m_gtt.AddRoute (ndn::Name ("/domain1/iGate2"), Ipv4Address ("10.1.5.2"));
-  m_gtt.AddRoute (ndn::Name ("/domain2/dst1"), Ipv4Address ("10.1.5.2"));
-  m_gtt.AddRoute (ndn::Name ("/domain2/dst2"), Ipv4Address ("10.1.5.2"));
-  m_gtt.AddRoute (ndn::Name ("/domain2/dst3"), Ipv4Address ("10.1.5.2"));
+  //the gtt is filled by GatewayRoutingHelper or Gtt_addRoute before the start
 
   // initialize ndn::App
   ndn::App::StartApplication ();
@@ -118,11 +131,7 @@ GatewayApp::StartApplication ()
   //Send SocketSimulator::Schedule (Seconds (3), &SimpleUdpApplication::SendPacket, udp0, packet1,dest_ip_ip5 , 7777)
   m_send_socket = Socket::CreateSocket (GetNode (), tid);
 
-  std::cout << "GatewayApp.start app." << std::endl;
   NS_LOG_INFO (TEAL_CODE << "Start App" << END_CODE);
-  Ptr<Packet> packet1 = Create<Packet> (8000);
-  Ipv4Address dest_ip_ip5 ("10.1.5.2");
-  
   //Simulator::Schedule (Seconds (1), &GatewayApp::SendPacket, this, packet1,dest_ip_ip5 , 7777);
 }
 
@@ -196,7 +205,6 @@ GatewayApp::SendElection ()
   NS_LOG_INFO (CYAN_CODE << "Sending Electron packet for " << *interest << " AT NODE "
                          << this->GetNode ()->GetId () << END_CODE);
 
-  this->m_gtt.printTheMap ();
   // Call trace (for logging purposes)
   m_transmittedInterests (interest, this, m_face);
 
@@ -209,32 +217,21 @@ GatewayApp::OnInterest (std::shared_ptr<const ndn::Interest> interest)
 {
   ndn::App::OnInterest (interest);
 
-  ndn::Block block = interest->wireEncode ();
+  const ndn::Block& block = interest->wireEncode ();
   ndn::BlockHeader blockheader (block);
   Ptr<ns3::Packet> packet1 = Create<ns3::Packet> (block.size ());
   packet1->AddHeader (blockheader);
 
-  NS_LOG_INFO (CYAN_CODE << "The Gateway program receive interest " << interest->toUri ()
+  NS_LOG_INFO (CYAN_CODE << "The Gateway program receive interest " << interest->getName ()
                          << END_CODE);
-  std::string interets_short = interest->toUri ();
-  ndn::Block b = interest->wireEncode ();
-  Ptr<Packet> packet = Create<Packet> ((uint8_t *) interets_short.c_str (), 8000);
-
-  //read packet buffer/payload
-  uint8_t *buffer = new uint8_t[packet->GetSize ()];
-  packet->CopyData (buffer, packet->GetSize ());
-  std::string s = std::string ((char *) buffer);
 
-  //
-  //read pkt pylod
-  NS_LOG_INFO (BLUE_CODE << "Sending packet for " << s << END_CODE);
-
-  //gtt mapping
-  int size = interest->getName ().size ();
-  ndn::Name name = interest->getName ().getSubName (0, size - 1);
+  //gtt mapping, on a view of the whole name: the GTT holds the producer prefixes
+  ndn::ViewArena arena;
+  ndn::NameView name (interest->getName (), arena);
   NS_LOG_INFO (RED_CODE << "gtt mapping input: " << name << END_CODE);
   ns3::Ipv4Address ip_str = m_gtt.mapToGateIP (name);
   NS_LOG_INFO (RED_CODE << "gtt mapping output: " << ip_str << END_CODE);
+  m_gttLookup (name, ip_str, ip_str != Ipv4Address::GetAny ());
 
 
   //add ipaddress to header
@@ -251,7 +248,11 @@ GatewayApp::OnInterest (std::shared_ptr<const ndn::Interest> interest)
   
   //if(find tunnel true) return ip_str and port number
   Ipv4Address dest_ip_ip5 (ip_str);
-  Simulator::ScheduleNow (&GatewayApp::SendPacket, this, packet1, dest_ip_ip5, 7777);
+  // with synchronous delivery we already run in the forwarder's event, sending takes no new one
+  if (m_isSynchronousDelivery)
+    SendPacket (packet1, dest_ip_ip5, 7777);
+  else
+    Simulator::ScheduleNow (&GatewayApp::SendPacket, this, packet1, dest_ip_ip5, 7777);
   //test
   
   //this->BuildTunnel(dest_ip_ip5,newPort);
@@ -307,7 +308,10 @@ GatewayApp::OnData (std::shared_ptr<const ndn::Data> data)
   NS_LOG_INFO (CYAN_CODE << "Receiving Data packet at handle two IN " << GetNode ()->GetId ()
                          << " WITH DATA " << data->getName () << END_CODE);
 
-  std::cout << "DATA received for name " << data->getName ().getSubName(0,data->getName().size()-1) << std::endl;
+  //the DTT holds the Interest names without their last component, Data names can be longer
+  ndn::ViewArena arena;
+  ndn::NameView name (data->getName (), arena);
+  NS_LOG_DEBUG ("DATA received for name " << name);
 
   //data chunck need modify,gtt doesn't work
   //gtt mapping
@@ -321,13 +325,15 @@ GatewayApp::OnData (std::shared_ptr<const ndn::Data> data)
 
 
   //Ipv4Address dest_ip_ip5 ("10.1.1.1");
-  ndn::Name name = data->getName ().getSubName (0, data->getName().size()- 1);
   Ipv4Address dest_ip_ip5 = m_dtt.mapToGateIP(name);
-  ndn::Block block = data->wireEncode ();
+  const ndn::Block& block = data->wireEncode ();
   ndn::BlockHeader blockheader (block);
   Ptr<ns3::Packet> packet1 = Create<ns3::Packet> (block.size ());
   packet1->AddHeader (blockheader);
-  Simulator::ScheduleNow (&GatewayApp::SendPacket, this, packet1, dest_ip_ip5, 9999);
+  if (m_isSynchronousDelivery)
+    SendPacket (packet1, dest_ip_ip5, 9999);
+  else
+    Simulator::ScheduleNow (&GatewayApp::SendPacket, this, packet1, dest_ip_ip5, 9999);
 }
 
 //GTT
@@ -335,7 +341,38 @@ void
 GatewayApp::Gtt_addRoute (ndn::Name prefix, ns3::Ipv4Address ipv4address)
 {
   m_gtt.AddRoute (prefix, ipv4address);
-  m_gtt.printTheMap ();
+}
+
+GttTable&
+GatewayApp::GetGtt ()
+{
+  return m_gtt;
+}
+
+//stats
+GatewayApp::Stats
+GatewayApp::GetStats () const
+{
+  Stats stats = {};
+  if (m_face != nullptr)
+    {
+      stats.appFace = m_face->getCounters ().snapshot ();
+    }
+  Ptr<ndn::L3Protocol> l3 = GetNode ()->GetObject<ndn::L3Protocol> ();
+  if (l3 != nullptr)
+    {
+      stats.forwarder = l3->getForwarder ()->getCounters ().snapshot ();
+    }
+  return stats;
+}
+
+void
+GatewayApp::PrintTables (std::ostream &os) const
+{
+  os << "GTT\n";
+  m_gtt.Print (os);
+  os << "DTT\n";
+  m_dtt.Print (os);
 }
 
 //ip
@@ -379,25 +416,46 @@ GatewayApp::HandleReadOne (Ptr<Socket> socket)
       uint32_t ip = tipHeader.GetData ();
       Ipv4Address ipv4(ip);
       NS_LOG_INFO (GREEN_CODE<<"IP: " << ipv4 <<END_CODE);
-      
+
+      m_tunnelRx (packet, InetSocketAddress::ConvertFrom (from).GetIpv4 (),
+                  RecordTunnelDelay (packet));
 
 
       ndn::BlockHeader blockheader;
       recv_pkt->RemoveHeader (blockheader);
       ndn::Block recv_block = blockheader.getBlock ();
+      //the DTT key comes from a view parsed in place, a Name is only created for a new route
+      ndn::ViewArena arena;
+      ndn::InterestView view (recv_block, arena);
+      m_dtt.AddRoute(view.getName().getPrefix(-1),ipv4);
+      m_dttSize = static_cast<uint32_t> (m_dtt.size ());
+
+      //the owning Interest, needed to forward it, is decoded once from the same block
       auto interest = ndn::make_shared<ndn::Interest> (recv_block);
-      //uint8_t *buffer = new uint8_t[packet->GetSize ()];
-      //packet->CopyData(buffer, packet->GetSize ());
-      std::string s = interest->toUri ();
-      NS_LOG_INFO ("Content: " << s);
-      m_dtt.AddRoute(interest->getName().getSubName(0,interest->getName().size()-1),ipv4);
-      m_dtt.printDTTMap();
+      NS_LOG_INFO ("Content: " << *interest);
       ReformAndSendInterest (interest);
     }
 }
 
 
 
+Time
+GatewayApp::RecordTunnelDelay (Ptr<const Packet> packet)
+{
+  //RecordRx ignores a packet without the timestamp tag of PrepareTx, e.g., from a gateway that
+  //does not stamp its packets, and GetLastDelay would then report the previous packet's delay
+  ByteTagIterator tags = packet->GetByteTagIterator ();
+  while (tags.HasNext ())
+    {
+      if (tags.Next ().GetTypeId ().GetName () == "anon::DelayJitterEstimationTimestampTag")
+        {
+          m_tunnelDelay.RecordRx (packet);
+          return m_tunnelDelay.GetLastDelay ();
+        }
+    }
+  return Seconds (-1);
+}
+
 void
 GatewayApp::HandleReadTwo (Ptr<Socket> socket)
 {
@@ -414,6 +472,9 @@ GatewayApp::HandleReadTwo (Ptr<Socket> socket)
                                << END_CODE);
       NS_LOG_INFO (CYAN_CODE << "Receiving Data packet at handle two IN " << id << " WITH DATA "
                              << END_CODE);
+      m_tunnelRx (packet, InetSocketAddress::ConvertFrom (from).GetIpv4 (),
+                  RecordTunnelDelay (packet));
+
       Ptr<ns3::Packet> recv_pkt = packet->Copy ();
       ndn::BlockHeader blockheader;
       recv_pkt->RemoveHeader (blockheader);
@@ -585,8 +646,23 @@ void
 GatewayApp::SendPacket (Ptr<Packet> packet, Ipv4Address destination, uint16_t port)
 {
   NS_LOG_FUNCTION (this << packet << destination << port);
+  if (destination == Ipv4Address::GetAny ())
+    {
+      // no GTT or DTT route
+      NS_LOG_WARN ("No gateway for the packet, dropping");
+      m_drop (packet, destination);
+      return;
+    }
+
+  // the peer reads the encapsulation time from the tag to report the tunnel delay
+  m_tunnelDelay.PrepareTx (packet);
   m_send_socket->Connect (InetSocketAddress (Ipv4Address::ConvertFrom (destination), port));
-  m_send_socket->Send (packet);
+  if (m_send_socket->Send (packet) < 0)
+    {
+      m_drop (packet, destination);
+      return;
+    }
+  m_tunnelTx (packet, destination);
 }
 
 } // namespace ns3
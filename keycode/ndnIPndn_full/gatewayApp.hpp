@@ -9,11 +9,19 @@
 #include "ns3/ndnSIM/model/ndn-common.hpp"
 #include "gtt.hpp"
 
+#include "ns3/ndnSIM/NFD/daemon/face/face-counters.hpp"
+#include "ns3/ndnSIM/NFD/daemon/fw/forwarder-counters.hpp"
+
 
 //new Jul 26
 #include "ns3/nstime.h"
 #include "ns3/ptr.h"
+#include "ns3/ipv4-address.h"
+#include "ns3/traced-callback.h"
+#include "ns3/traced-value.h"
+#include "ns3/delay-jitter-estimation.h"
 #include "ns3/ndnSIM/ndn-cxx/name.hpp"
+#include "ns3/ndnSIM/ndn-cxx/name-view.hpp"
 namespace ns3 {
 
 
@@ -74,6 +82,69 @@ public:
     void 
     Gtt_addRoute(ndn::Name prefix, Ipv4Address ipv4address);
 
+    /** \brief the GTT, mapping the prefixes of remote domains to their gateway
+     *
+     *  Unlike Gtt_addRoute, adding routes here does not print the table, so that
+     *  GatewayRoutingHelper can fill it with the prefixes of large topologies.
+     */
+    GttTable&
+    GetGtt();
+
+/////////////////////////////////////////////////
+//stats
+///////////////////////////////////////////////////
+
+    /** \brief counters of the gateway, taken at one point in time
+     */
+    struct Stats
+    {
+      /** \brief counters of the face between the gateway and its NDN forwarder
+       *
+       *  nInInterests are the Interests handed to the gateway for tunneling,
+       *  nOutData the Data returned through the tunnel.
+       */
+      nfd::face::FaceCounters::Snapshot appFace;
+
+      /** \brief counters of the forwarder on the gateway node
+       */
+      nfd::ForwarderCounters::Snapshot forwarder;
+    };
+
+    /** \brief read the gateway counters
+     *
+     *  The values come from the same counters that NFD increments while forwarding,
+     *  so querying them has no cost on the forwarding path.
+     */
+    Stats
+    GetStats() const;
+
+    /** \brief print the GTT and the DTT
+     *
+     *  The tables are no longer printed when they change, only when asked for.
+     */
+    void
+    PrintTables(std::ostream& os) const;
+
+/////////////////////////////////////////////////
+//trace sources
+///////////////////////////////////////////////////
+
+    /** \brief signature of TunnelTx and Drop: the UDP payload and the gateway it is sent to
+     *
+     *  Drop reports 0.0.0.0 as gateway when the GTT or DTT has no route for the packet.
+     */
+    typedef void (*TunnelTracedCallback)(Ptr<const Packet> packet, Ipv4Address peer);
+
+    /** \brief signature of TunnelRx: the UDP payload, the gateway it comes from, and the time
+     *  since that gateway encapsulated it, negative if the gateway did not stamp the packet
+     */
+    typedef void (*TunnelRxTracedCallback)(Ptr<const Packet> packet, Ipv4Address peer, Time delay);
+
+    /** \brief signature of GttLookup: the looked up prefix, the gateway found, and whether one was
+     */
+    typedef void (*GttLookupTracedCallback)(const ndn::NameView& prefix, Ipv4Address gateway,
+                                            bool isFound);
+
 /*
  
   GttTable g = GttTable();
@@ -108,6 +179,11 @@ private:
   void 
   SetupReceiveSocket (Ptr<Socket> socket, uint16_t port);
 
+  /** \brief time since the peer encapsulated \p packet, negative if the peer did not stamp it
+   */
+  Time
+  RecordTunnelDelay (Ptr<const Packet> packet);
+
   Ptr<Socket> m_recv_socket1; /**< A socket to receive on a specific port */
   Ptr<Socket> m_recv_socket2; /**< A socket to receive on a specific port */
   Ptr<Socket> m_recv_socketTunnel;
@@ -119,6 +195,13 @@ private:
   GttTable m_gtt;
   GttTable m_dtt;
 
+  TracedCallback<Ptr<const Packet>, Ipv4Address> m_tunnelTx; ///< packets sent to a gateway
+  TracedCallback<Ptr<const Packet>, Ipv4Address, Time> m_tunnelRx; ///< Interests and Data decapsulated
+  TracedCallback<Ptr<const Packet>, Ipv4Address> m_drop; ///< packets without route or not sent
+  TracedCallback<const ndn::NameView&, Ipv4Address, bool> m_gttLookup;
+  TracedValue<uint32_t> m_dttSize;
+  DelayJitterEstimation m_tunnelDelay; ///< reads the encapsulation time tagged by the peer
+
 
   vector<int> m_available_port{ 7007, 6006, 8008,9009, 3003,2002,1001};
   //producer set jul 26
@@ -18,98 +18,117 @@ GttTable::GttTable(){
 
 ns3::Ipv4Address GttTable::mapToGateIP(ndn::Name name)
 {
-    
- for (auto x : m_GttMap) {
-        if(HasRoute(name,x.first)){
-            ns3::Ipv4Address s=x.first;
-            return s;
+    ndn::ViewArena arena;
+    return mapToGateIP(ndn::NameView(name, arena));
+}
+
+ns3::Ipv4Address GttTable::mapToGateIP(const ndn::NameView& name) const
+{
+    //longest prefix match, as producers announce prefixes and not the names they serve;
+    //sub-views are looked up without copying the table or creating Names
+    for (size_t i = name.size() + 1; i-- > 0;) {
+        auto it = m_index.find(name.getPrefix(i));
+        if (it != m_index.end()) {
+            return it->second;
         }
     }
-    return NULL;
+    return ns3::Ipv4Address(uint32_t(0));
 }
 
 
 void GttTable::AddRoute(ndn::Name name, ns3::Ipv4Address ip){
 
-
-    if(m_GttMap.count(ip)) {//if ip is already in list
-        std::vector<ndn::Name> names;
-        auto it = m_GttMap.find(ip);
-        names=it->second;
-
-        //test the existence of the name
-        bool hasName = false;
-        for(auto & elem : names)
-        {
-            if(name==elem){
-                hasName=true;
-                break;
-            }for(auto & elem : names)
-        {
-            if(name==elem){
-                hasName=true;
-                break;
-            }
-        }
-        if(hasName==true){
-
-        }else{
-            names.push_back(name);
-            m_GttMap.erase(ip);
-            m_GttMap.insert(make_pair(ip,names));
-        }
-        }
-
-    } else { //else ip is not already in list so add i
-        std::vector<ndn::Name> names;
-        names.push_back(name);
-        m_GttMap.insert(make_pair(ip,names));
+    auto it = m_index.find(name);
+    if (it == m_index.end()) {
+        //new prefix, no need to search the names of the gateway
+        m_GttMap[ip].push_back(name);
+        m_index.emplace(std::move(name), ip);
+        return;
     }
 
+    ndn::ViewArena arena;
+    if (HasRoute(ndn::NameView(name, arena), ip)) {
+        return;
+    }
+    m_GttMap[ip].push_back(name);
+    if (ip < it->second) {
+        it->second = ip;
+    }
+}
 
+void GttTable::AddRoute(const ndn::NameView& name, ns3::Ipv4Address ip){
+    if(!HasRoute(name,ip)){
+        AddRoute(name.toName(),ip);
+    }
 }
 
-bool GttTable::HasRoute(ndn::Name name, ns3::Ipv4Address ip){
-    if(m_GttMap.count(ip)){//if the ip exist in the table
-        std::vector<ndn::Name> names;
-        auto it = m_GttMap.find(ip);
-        names=it->second;
-        for(auto & elem : names)
-        {
-            if(name==elem){
-                return true;
-            }
-        }
+bool GttTable::HasRoute(const ndn::NameView& name, ns3::Ipv4Address ip) const{
+    auto index = m_index.find(name);
+    if (index == m_index.end()) {
         return false;
-    } else{                      //if the ip not exist in the table
+    }
+    if (index->second == ip) {
+        return true;
+    }
+
+    //the prefix is also routed to another gateway
+    auto it = m_GttMap.find(ip);
+    if(it == m_GttMap.end()){
         return false;
     }
+    for(const auto & elem : it->second)
+    {
+        if(name==elem){
+            return true;
+        }
+    }
+    return false;
+}
+
+bool GttTable::HasRoute(ndn::Name name, ns3::Ipv4Address ip){
+    ndn::ViewArena arena;
+    return HasRoute(ndn::NameView(name, arena), ip);
 }
 
 void GttTable::RemoveRoute(ndn::Name name, ns3::Ipv4Address ip){
     
-    if(m_GttMap.count(ip)) {//if ip is already in list
-        std::vector<ndn::Name> names;
-        auto it = m_GttMap.find(ip);
-        names=it->second;
-
-
-        for(auto it = std::begin(names); it != std::end(names); ++it) {
-               // std::cout << *it << "\n";
-               if(name==*it)
-               {    
-                    names.erase(it);
-               }
+    auto it = m_GttMap.find(ip);
+    if (it == m_GttMap.end()) {
+        return;
+    }
+    auto& names = it->second;
+    names.erase(std::remove(names.begin(), names.end(), name), names.end());
+
+    auto index = m_index.find(name);
+    if (index == m_index.end() || index->second != ip) {
+        return;
+    }
+    //fall back to the lowest other gateway of the prefix, as the map is ordered by address
+    m_index.erase(index);
+    for (const auto& x : m_GttMap) {
+        if (std::find(x.second.begin(), x.second.end(), name) != x.second.end()) {
+            m_index.emplace(name, x.first);
+            break;
         }
-            m_GttMap.erase(ip);
-            m_GttMap.insert(make_pair(ip,names));
-    } else { //else ip is not already in list so add i
-        
     }
 }
 
+size_t GttTable::size() const{
+    return m_index.size();
+}
+
 
 
+void GttTable::Print(std::ostream& os) const{
+    for (const auto& x : m_GttMap) {
+        os << x.first;
+        for (const auto& n : x.second) {
+            os << " " << n;
+        }
+        os << "\n";
+    }
+}
+
 void GttTable::printTheMap(){
     cout<<PURPLE_CODE<<"**********************************"<<"\n";
     cout<<"print the GTT table:"<<"\n";
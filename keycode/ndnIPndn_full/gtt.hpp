@@ -1,9 +1,11 @@
 #include "ns3/ndnSIM/ndn-cxx/name.hpp"
+#include "ns3/ndnSIM/ndn-cxx/name-view.hpp"
 #include "ns3/ptr.h"
 #include "ns3/log.h"
 #include "ns3/simulator.h"
 #include "ns3/ipv4-address.h"
 #include "ns3/packet.h"
+#include <algorithm>
 #include <map>
 #include <vector>
 #include <string>
@@ -19,21 +21,47 @@ public:
     GttTable();
     void 
     AddRoute(ndn::Name prefix, ns3::Ipv4Address ipv4address);
+    //only creates a Name when the route is new
+    void
+    AddRoute(const ndn::NameView& prefix, ns3::Ipv4Address ipv4address);
     void 
     RemoveRoute(ndn::Name prefix,ns3::Ipv4Address ipv4address);
     bool
     HasRoute(ndn::Name prefix,ns3::Ipv4Address ipv4address);
+    bool
+    HasRoute(const ndn::NameView& prefix, ns3::Ipv4Address ipv4address) const;
     void
     printTheMap();
 
     void
     printDTTMap();
+    //one line per gateway with its prefixes, without colors
+    void
+    Print(std::ostream& os) const;
+    //gateway of the longest routed prefix of the name, 0.0.0.0 if none
     ns3::Ipv4Address
     mapToGateIP(ndn::Name prefix);
+    ns3::Ipv4Address
+    mapToGateIP(const ndn::NameView& prefix) const;
+
+    size_t
+    size() const;
 
 private:
+    //orders Names and NameViews alike, so a view can be looked up without creating a Name
+    struct NameLess
+    {
+        using is_transparent = void;
+
+        bool operator()(const ndn::Name& a, const ndn::Name& b) const { return a < b; }
+        bool operator()(const ndn::NameView& a, const ndn::Name& b) const { return a.compare(b) < 0; }
+        bool operator()(const ndn::Name& a, const ndn::NameView& b) const { return b.compare(a) > 0; }
+    };
+
     int m_value = 0;
     std::map<ns3::Ipv4Address,std::vector<ndn::Name>> m_GttMap;
+    //prefix -> gateway returned by mapToGateIP, the lowest address among the routes of the prefix
+    std::map<ndn::Name,ns3::Ipv4Address,NameLess> m_index;
     std::string findIpByPrefix(ndn::Name name);
 
 
@@ -18,6 +18,10 @@
 #include "ndn-load-balancer/random-load-balancer-strategy.hpp"
 #include "NFD/daemon/fw/gatewayTunnelStrategy.hpp"
 #include "gatewayApp.hpp"
+#include "gateway-routing-helper.hpp"
+#include "segment-fetch-app.hpp"
+
+#include <chrono>
 
 
 using namespace ns3;
@@ -28,9 +32,36 @@ namespace ns3 {
 int
 main(int argc, char* argv[])
 {
+  bool lazyDecode = false;
+  uint64_t objectSize = 0;
+  std::string fetchCc = "aimd";
+  std::string dataRate;
+  double stopTime = 10.0;
+  bool syncApps = false;
+  std::string tunnelTrace;
+  bool printTables = false;
   CommandLine cmd;
+  cmd.AddValue("lazyDecode", "Defer decoding of packet fields that forwarding does not use", lazyDecode);
+  cmd.AddValue("objectSize", "Size of an object fetched by node5 from node2 through the tunnel, 0 to disable", objectSize);
+  cmd.AddValue("fetchCc", "Window adaptation of the object fetcher, aimd or cubic", fetchCc);
+  cmd.AddValue("dataRate", "DataRate of the point-to-point links, e.g. 100Mbps", dataRate);
+  cmd.AddValue("stopTime", "Simulation stop time in seconds", stopTime);
+  cmd.AddValue("syncApps", "Hand packets to the apps and gateways without a new event per packet", syncApps);
+  cmd.AddValue("tunnelTrace", "File to which TunnelTracer writes the tunnel rates of the gateways", tunnelTrace);
+  cmd.AddValue("printTables", "Print the GTT and DTT of the gateways at the end of the simulation", printTables);
   cmd.Parse(argc, argv);  
 
+  if (syncApps) {
+    Config::SetDefault("ns3::ndn::App::SynchronousDelivery", BooleanValue(true));
+  }
+
+  if (!dataRate.empty()) {
+    Config::SetDefault("ns3::PointToPointNetDevice::DataRate", StringValue(dataRate));
+  }
+
+  ::ndn::Interest::setLazyDecoding(lazyDecode);
+  ::ndn::Data::setLazyDecoding(lazyDecode);
+
   MobilityHelper mobilitys;
   Ptr<ListPositionAllocator> initialAlloc =
   CreateObject<ListPositionAllocator> ();
@@ -174,8 +205,8 @@ main(int argc, char* argv[])
 
 
   //ndn part
+  //default routes lead to the gateways, they are installed by GatewayRoutingHelper
   ndn::StackHelper ndnHelper;
-  ndnHelper.SetDefaultRoutes(true);
   ndnHelper.Install(node1);
 	ndnHelper.Install(node2);
 	ndnHelper.Install(node3);
@@ -231,48 +262,55 @@ main(int argc, char* argv[])
   //gate2App->Gtt_addRoute(ndn::Name("/igate2"),"10.1.5.1");
 
 
+  //routes inside each domain and the GTT of the gateways, from the producer prefixes
+  GatewayRoutingHelper routingHelper;
+  routingHelper.Install(ndnNodes);
+  routingHelper.AddGateway(iGate1);
+  routingHelper.AddGateway(iGate2);
+
   //producer
   producerHelper.SetPrefix("/domain1/src1");
   producerHelper.Install(node1);
+  routingHelper.AddOrigin("/domain1/src1", node1);
   producerHelper.SetPrefix("/domain1/test");
   producerHelper.Install(node1);
+  routingHelper.AddOrigin("/domain1/test", node1);
   producerHelper.SetPrefix("/domain1/src2");
   producerHelper.Install(node2);
+  routingHelper.AddOrigin("/domain1/src2", node2);
   producerHelper.SetPrefix("/domain1/iGate1");
   producerHelper.Install(iGate1);
+  routingHelper.AddOrigin("/domain1/iGate1", iGate1);
   producerHelper.SetPrefix("/domain2/dst1");
   producerHelper.Install(node3);
+  routingHelper.AddOrigin("/domain2/dst1", node3);
   producerHelper.SetPrefix("/domain2/dst2");
   producerHelper.Install(node4);
+  routingHelper.AddOrigin("/domain2/dst2", node4);
   producerHelper.SetPrefix("/domain2/dst3");
   producerHelper.Install(node5);
+  routingHelper.AddOrigin("/domain2/dst3", node5);
   producerHelper.SetPrefix("/domain2/iGate2");
   producerHelper.Install(iGate2);
-
-
-
-
-  //manually configure FIB
-  ndn::FibHelper::AddRoute(iGate2, "/domain2/dst3", node5, 20);
-  ndn::FibHelper::AddRoute(iGate2, "/domain2/dst1", node3, 20);
-  ndn::FibHelper::AddRoute(iGate2,"/domain2/dst2",node3,20);
-  ndn::FibHelper::AddRoute(node3, "/domain2/iGate2", iGate2, 20);
-  ndn::FibHelper::AddRoute(node3, "/domain2/dst2", node4, 20);
-  ndn::FibHelper::AddRoute(node3, "/domain2/dst3", iGate2, 20);
-  ndn::FibHelper::AddRoute(node4, "/domain2/dst1", node3, 20);
-  ndn::FibHelper::AddRoute(node4, "/domain2/dst3", node5, 20);
-  ndn::FibHelper::AddRoute(node4, "/domain2/iGate2", node3, 20);
-  ndn::FibHelper::AddRoute(node5, "/domain2/dst2", node4, 20);
-  ndn::FibHelper::AddRoute(node5, "/domain2iGate2", iGate2, 20);
-  ndn::FibHelper::AddRoute(node5, "/domain2/dst1", iGate2, 20);
-  ndn::FibHelper::AddRoute(node1, "/domain1/src2", iGate1, 20);
-  ndn::FibHelper::AddRoute(node1, "/domain1/iGate1", iGate1, 20);
-  ndn::FibHelper::AddRoute(node2, "/domain1/iGate1", iGate1, 20);
-  ndn::FibHelper::AddRoute(node2, "/domain1/test", iGate1, 20);
-  ndn::FibHelper::AddRoute(node2, "/domain1/src1", iGate1, 20);
-  ndn::FibHelper::AddRoute(iGate1, "/domain1/src1", node1, 20);
-  ndn::FibHelper::AddRoute(iGate1, "/domain1/test", node1, 20);
-  ndn::FibHelper::AddRoute(iGate1, "/domain1/src2", node2, 20);
+  routingHelper.AddOrigin("/domain2/iGate2", iGate2);
+
+  routingHelper.CalculateRoutes();
+
+  // Goodput of a segmented object fetched over the tunnel, logged by SegmentFetchApp
+  if (objectSize > 0) {
+    ndn::AppHelper objectProducerHelper("SegmentProducerApp");
+    objectProducerHelper.SetAttribute("Prefix", StringValue("/domain1/object"));
+    objectProducerHelper.SetAttribute("ObjectSize", UintegerValue(objectSize));
+    objectProducerHelper.Install(node2);
+    //added after CalculateRoutes, only the routes of this prefix are installed
+    routingHelper.AddOrigin("/domain1/object", node2);
+
+    ndn::AppHelper objectFetcherHelper("SegmentFetcherApp");
+    objectFetcherHelper.SetAttribute("Prefix", StringValue("/domain1/object"));
+    objectFetcherHelper.SetAttribute("CongestionControl", StringValue(fetchCc));
+    objectFetcherHelper.Install(node5).Start(Seconds(3.0));
+    LogComponentEnable("SegmentFetchApp", LOG_LEVEL_INFO);
+  }
 
 /*
   //Initiate three consumer application.
@@ -311,8 +349,24 @@ main(int argc, char* argv[])
   LogComponentEnable ("GatewayApp", LOG_LEVEL_INFO);
   //LogComponentEnable ("Strategy", LOG_LEVEL_INFO);
 
-  Simulator::Stop(Seconds(10.0));
+  if (!tunnelTrace.empty()) {
+    ndn::TunnelTracer::Install(NodeContainer(iGate1, iGate2), tunnelTrace);
+  }
+
+  Simulator::Stop(Seconds(stopTime));
+  auto start = std::chrono::steady_clock::now();
   Simulator::Run();
+  std::chrono::duration<double> wallTime = std::chrono::steady_clock::now() - start;
+
+  std::cout << "Events\tWallTime" << std::endl
+            << Simulator::GetEventCount() << "\t" << wallTime.count() << std::endl;
+
+  if (printTables) {
+    for (auto app : {installedApp1.Get(0), installedApp2.Get(0)}) {
+      std::cout << "Gateway " << app->GetNode()->GetId() << std::endl;
+      DynamicCast<GatewayApp>(app)->PrintTables(std::cout);
+    }
+  }
   Simulator::Destroy();
 
   return 0;
@@ -0,0 +1,134 @@
+// segment-fetch-app.cc
+
+#include "segment-fetch-app.hpp"
+
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+#include "ns3/string.h"
+#include "ns3/uinteger.h"
+
+#include "ns3/ndnSIM/helper/ndn-stack-helper.hpp"
+
+NS_LOG_COMPONENT_DEFINE("SegmentFetchApp");
+
+namespace ns3 {
+
+NS_OBJECT_ENSURE_REGISTERED(SegmentProducerApp);
+NS_OBJECT_ENSURE_REGISTERED(SegmentFetcherApp);
+
+TypeId
+SegmentProducerApp::GetTypeId()
+{
+  static TypeId tid =
+    TypeId("SegmentProducerApp")
+      .SetParent<Application>()
+      .AddConstructor<SegmentProducerApp>()
+      .AddAttribute("Prefix", "Name of the served object", StringValue("/"),
+                    MakeStringAccessor(&SegmentProducerApp::m_prefix), MakeStringChecker())
+      .AddAttribute("ObjectSize", "Size of the object in bytes", UintegerValue(100 * 1024 * 1024),
+                    MakeUintegerAccessor(&SegmentProducerApp::m_objectSize),
+                    MakeUintegerChecker<uint64_t>(1))
+      .AddAttribute("SegmentSize", "Content size of each segment", UintegerValue(1024),
+                    MakeUintegerAccessor(&SegmentProducerApp::m_segmentSize),
+                    MakeUintegerChecker<uint32_t>(1));
+  return tid;
+}
+
+void
+SegmentProducerApp::StartApplication()
+{
+  m_payload.assign(m_segmentSize, 0xAB);
+  m_face = std::make_unique<::ndn::Face>();
+  m_face->setInterestFilter(m_prefix,
+                            [this] (const auto&, const auto& interest) { OnInterest(interest); },
+                            [] (const ::ndn::Name& prefix, const std::string& reason) {
+                              NS_LOG_INFO("Failed to register " << prefix << ": " << reason);
+                            });
+}
+
+void
+SegmentProducerApp::StopApplication()
+{
+  m_face.reset();
+}
+
+void
+SegmentProducerApp::OnInterest(const ::ndn::Interest& interest)
+{
+  ::ndn::Name prefix(m_prefix);
+  uint64_t segment = 0;
+  if (interest.getName().size() > prefix.size() && interest.getName()[-1].isSegment()) {
+    segment = interest.getName()[-1].toSegment();
+  }
+
+  uint64_t nSegments = (m_objectSize + m_segmentSize - 1) / m_segmentSize;
+  if (segment >= nSegments) {
+    return;
+  }
+
+  auto data = std::make_shared<::ndn::Data>(::ndn::Name(prefix).appendSegment(segment));
+  uint64_t offset = segment * m_segmentSize;
+  size_t size = static_cast<size_t>(std::min<uint64_t>(m_segmentSize, m_objectSize - offset));
+  data->setContent(::ndn::make_span(m_payload).first(size));
+  data->setFreshnessPeriod(::ndn::time::seconds(10));
+  data->setFinalBlock(::ndn::name::Component::fromSegment(nSegments - 1));
+  ndn::StackHelper::getKeyChain().sign(*data);
+  m_face->put(*data);
+}
+
+TypeId
+SegmentFetcherApp::GetTypeId()
+{
+  static TypeId tid =
+    TypeId("SegmentFetcherApp")
+      .SetParent<Application>()
+      .AddConstructor<SegmentFetcherApp>()
+      .AddAttribute("Prefix", "Name of the fetched object", StringValue("/"),
+                    MakeStringAccessor(&SegmentFetcherApp::m_prefix), MakeStringChecker())
+      .AddAttribute("CongestionControl", "Window adaptation of the fetcher, aimd or cubic",
+                    StringValue("aimd"),
+                    MakeStringAccessor(&SegmentFetcherApp::m_congestionControl),
+                    MakeStringChecker());
+  return tid;
+}
+
+void
+SegmentFetcherApp::StartApplication()
+{
+  using ::ndn::util::SegmentFetcher;
+
+  SegmentFetcher::Options options;
+  options.congestionControl = m_congestionControl == "cubic" ? SegmentFetcher::CongestionControl::CUBIC
+                                                             : SegmentFetcher::CongestionControl::AIMD;
+
+  m_face = std::make_unique<::ndn::Face>();
+  m_startTime = Simulator::Now();
+  m_nBytesInOrder = 0;
+  m_fetcher = SegmentFetcher::start(*m_face, ::ndn::Interest(m_prefix), m_validator, options);
+
+  m_fetcher->onInOrderBytes.connect([this] (::ndn::span<const uint8_t> bytes) {
+    m_nBytesInOrder += bytes.size();
+  });
+  m_fetcher->onComplete.connect([this] (::ndn::ConstBufferPtr object) {
+    double seconds = (Simulator::Now() - m_startTime).GetSeconds();
+    NS_LOG_INFO("Fetched " << object->size() << " bytes of " << m_prefix << " with "
+                << m_congestionControl << " in " << seconds << " s, goodput "
+                << object->size() * 8 / seconds / 1e6 << " Mbit/s");
+  });
+  m_fetcher->onError.connect([this] (uint32_t code, const std::string& msg) {
+    NS_LOG_INFO("Fetching " << m_prefix << " failed after " << m_nBytesInOrder
+                << " in-order bytes: " << code << " " << msg);
+  });
+}
+
+void
+SegmentFetcherApp::StopApplication()
+{
+  if (m_fetcher != nullptr) {
+    m_fetcher->stop();
+    m_fetcher.reset();
+  }
+  m_face.reset();
+}
+
+} // namespace ns3
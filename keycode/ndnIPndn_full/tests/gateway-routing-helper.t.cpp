@@ -0,0 +1,159 @@
+// gateway-routing-helper.t.cpp
+
+#include "gateway-routing-helper.hpp"
+
+#include "helper/ndn-app-helper.hpp"
+#include "model/ndn-l3-protocol.hpp"
+
+#include "unit-tests/tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * Two domains joined by gateways, metrics on both directions of each link:
+ *
+ *     A1 --1-- G1 --1-- B1            G2 --1-- C2 --3-- D2 --1-- G3
+ */
+class GatewayRoutingHelperFixture : public ScenarioHelperWithCleanupFixture
+{
+public:
+  GatewayRoutingHelperFixture()
+  {
+    createTopology({
+        {"A1", "G1"},
+        {"G1", "B1"},
+        {"G2", "C2"},
+        {"C2", "D2"},
+        {"D2", "G3"}
+      });
+    setMetric("C2", "D2", 3);
+
+    AppHelper gatewayHelper("GatewayApp");
+    for (const auto& gateway : {"G1", "G2", "G3"}) {
+      gateways[gateway] = DynamicCast<GatewayApp>(gatewayHelper.Install(getNode(gateway)).Get(0));
+    }
+
+    routing.Install(NodeContainer(getNode("A1"), getNode("G1"), getNode("B1")));
+    routing.Install(NodeContainer(getNode("G2"), getNode("C2"), getNode("D2"), getNode("G3")));
+    routing.AddGateway(getNode("G1"), Ipv4Address("10.0.1.1"));
+    routing.AddGateway(getNode("G2"), Ipv4Address("10.0.2.1"));
+    routing.AddGateway(getNode("G3"), Ipv4Address("10.0.2.2"));
+  }
+
+  void
+  setMetric(const std::string& node1, const std::string& node2, uint64_t metric)
+  {
+    getFace(node1, node2)->setMetric(metric);
+    getFace(node2, node1)->setMetric(metric);
+  }
+
+  /** \return the face of the only nexthop of \p prefix on \p node, nullptr without FIB entry
+   */
+  const Face*
+  findNextHop(const std::string& node, const Name& prefix)
+  {
+    auto& fib = getNode(node)->GetObject<L3Protocol>()->getForwarder()->getFib();
+    const auto* entry = fib.findExactMatch(prefix);
+    if (entry == nullptr) {
+      return nullptr;
+    }
+    BOOST_REQUIRE_EQUAL(entry->getNextHops().size(), 1);
+    return &entry->getNextHops().begin()->getFace();
+  }
+
+  Ipv4Address
+  mapToGateIP(const std::string& gateway, const Name& name)
+  {
+    return gateways[gateway]->GetGtt().mapToGateIP(name);
+  }
+
+public:
+  GatewayRoutingHelper routing;
+  std::map<std::string, Ptr<GatewayApp>> gateways;
+};
+
+BOOST_FIXTURE_TEST_SUITE(HelperGatewayRoutingHelper, GatewayRoutingHelperFixture)
+
+BOOST_AUTO_TEST_CASE(DomainRoutes)
+{
+  routing.AddOrigin("/d1/a", getNode("A1"));
+  routing.AddOrigin("/d1/b", getNode("B1"));
+  routing.AddOrigin("/d2/c", getNode("C2"));
+  routing.AddOrigin("/d2/d", getNode("D2"));
+  routing.CalculateRoutes();
+
+  // prefixes of the domain
+  BOOST_CHECK_EQUAL(findNextHop("A1", "/d1/b"), getFace("A1", "G1").get());
+  BOOST_CHECK_EQUAL(findNextHop("G1", "/d1/a"), getFace("G1", "A1").get());
+  BOOST_CHECK_EQUAL(findNextHop("G1", "/d1/b"), getFace("G1", "B1").get());
+  BOOST_CHECK_EQUAL(findNextHop("G3", "/d2/c"), getFace("G3", "D2").get());
+  BOOST_CHECK_EQUAL(findNextHop("C2", "/d2/d"), getFace("C2", "D2").get());
+  BOOST_CHECK(findNextHop("A1", "/d1/a") == nullptr);
+
+  // prefixes of the other domain are not routed, not even through the gateways
+  BOOST_CHECK(findNextHop("A1", "/d2/c") == nullptr);
+  BOOST_CHECK(findNextHop("G1", "/d2/c") == nullptr);
+  BOOST_CHECK(findNextHop("G2", "/d1/a") == nullptr);
+  BOOST_CHECK(findNextHop("D2", "/d1/b") == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(DefaultRoutes)
+{
+  routing.CalculateRoutes();
+
+  // one default route per node, to the nearest gateway of its own domain
+  BOOST_CHECK_EQUAL(findNextHop("A1", "/"), getFace("A1", "G1").get());
+  BOOST_CHECK_EQUAL(findNextHop("B1", "/"), getFace("B1", "G1").get());
+  BOOST_CHECK_EQUAL(findNextHop("C2", "/"), getFace("C2", "G2").get());
+  BOOST_CHECK_EQUAL(findNextHop("D2", "/"), getFace("D2", "G3").get());
+
+  // the gateways tunnel instead
+  BOOST_CHECK(findNextHop("G1", "/") == nullptr);
+  BOOST_CHECK(findNextHop("G2", "/") == nullptr);
+  BOOST_CHECK(findNextHop("G3", "/") == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(GttFill)
+{
+  routing.AddOrigin("/d1/a", getNode("A1"));
+  routing.AddOrigin("/d2/c", getNode("C2"));
+  routing.AddOrigin("/d2/d", getNode("D2"));
+  routing.CalculateRoutes();
+
+  // the remote prefixes map to the gateway nearest to their origin
+  BOOST_CHECK_EQUAL(mapToGateIP("G1", "/d2/c"), Ipv4Address("10.0.2.1"));
+  BOOST_CHECK_EQUAL(mapToGateIP("G1", "/d2/d"), Ipv4Address("10.0.2.2"));
+  BOOST_CHECK_EQUAL(mapToGateIP("G2", "/d1/a"), Ipv4Address("10.0.1.1"));
+  BOOST_CHECK_EQUAL(mapToGateIP("G3", "/d1/a"), Ipv4Address("10.0.1.1"));
+
+  // and the local ones are not tunneled
+  BOOST_CHECK_EQUAL(mapToGateIP("G1", "/d1/a"), Ipv4Address::GetAny());
+  BOOST_CHECK_EQUAL(mapToGateIP("G2", "/d2/c"), Ipv4Address::GetAny());
+  BOOST_CHECK_EQUAL(gateways["G1"]->GetGtt().size(), 2);
+  BOOST_CHECK_EQUAL(gateways["G2"]->GetGtt().size(), 1);
+
+  // Interest names are longer than the producer prefixes
+  BOOST_CHECK_EQUAL(mapToGateIP("G1", Name("/d2/d").appendVersion(1).appendSegment(3)),
+                    Ipv4Address("10.0.2.2"));
+  BOOST_CHECK_EQUAL(mapToGateIP("G1", "/d2"), Ipv4Address::GetAny());
+}
+
+BOOST_AUTO_TEST_CASE(OriginAfterCalculation)
+{
+  routing.AddOrigin("/d1/a", getNode("A1"));
+  routing.CalculateRoutes();
+
+  routing.AddOrigin("/d1/object", getNode("B1"));
+  BOOST_CHECK_EQUAL(findNextHop("A1", "/d1/object"), getFace("A1", "G1").get());
+  BOOST_CHECK_EQUAL(findNextHop("G1", "/d1/object"), getFace("G1", "B1").get());
+  BOOST_CHECK(findNextHop("C2", "/d1/object") == nullptr);
+  BOOST_CHECK_EQUAL(mapToGateIP("G2", "/d1/object"), Ipv4Address("10.0.1.1"));
+  BOOST_CHECK_EQUAL(mapToGateIP("G3", "/d1/object"), Ipv4Address("10.0.1.1"));
+  BOOST_CHECK_EQUAL(gateways["G1"]->GetGtt().size(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
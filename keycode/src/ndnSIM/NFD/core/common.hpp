@@ -61,6 +61,7 @@
 #include <ndn-cxx/data.hpp>
 #include <ndn-cxx/interest.hpp>
 #include <ndn-cxx/name.hpp>
+#include <ndn-cxx/name-view.hpp>
 #include <ndn-cxx/encoding/block.hpp>
 #include <ndn-cxx/lp/nack.hpp>
 #include <ndn-cxx/net/face-uri.hpp>
@@ -106,8 +107,10 @@ using ndn::Data;
 using ndn::FaceUri;
 using ndn::Interest;
 using ndn::Name;
+using ndn::NameView;
 using ndn::PartialName;
 using ndn::Scheduler;
+using ndn::ViewArena;
 
 // Not using a namespace alias (namespace tlv = ndn::tlv), because
 // it doesn't allow NFD to add other members to the namespace
@@ -37,6 +37,12 @@ FaceCounters::FaceCounters(const LinkService::Counters& linkServiceCounters,
   , nOutData(linkServiceCounters.nOutData)
   , nInNacks(linkServiceCounters.nInNacks)
   , nOutNacks(linkServiceCounters.nOutNacks)
+  , nInInterestBytes(linkServiceCounters.nInInterestBytes)
+  , nOutInterestBytes(linkServiceCounters.nOutInterestBytes)
+  , nInDataBytes(linkServiceCounters.nInDataBytes)
+  , nOutDataBytes(linkServiceCounters.nOutDataBytes)
+  , nInNackBytes(linkServiceCounters.nInNackBytes)
+  , nOutNackBytes(linkServiceCounters.nOutNackBytes)
   , nInPackets(transportCounters.nInPackets)
   , nOutPackets(transportCounters.nOutPackets)
   , nInBytes(transportCounters.nInBytes)
@@ -46,5 +52,35 @@ FaceCounters::FaceCounters(const LinkService::Counters& linkServiceCounters,
 {
 }
 
+FaceCounters::Snapshot
+FaceCounters::snapshot() const
+{
+  Snapshot s;
+  s.nInInterests = nInInterests;
+  s.nOutInterests = nOutInterests;
+  s.nInterestsExceededRetx = nInterestsExceededRetx;
+  s.nInData = nInData;
+  s.nOutData = nOutData;
+  s.nInNacks = nInNacks;
+  s.nOutNacks = nOutNacks;
+  s.nInInterestBytes = nInInterestBytes;
+  s.nOutInterestBytes = nOutInterestBytes;
+  s.nInDataBytes = nInDataBytes;
+  s.nOutDataBytes = nOutDataBytes;
+  s.nInNackBytes = nInNackBytes;
+  s.nOutNackBytes = nOutNackBytes;
+  s.nInPackets = nInPackets;
+  s.nOutPackets = nOutPackets;
+  s.nInBytes = nInBytes;
+  s.nOutBytes = nOutBytes;
+  s.nInHopLimitZero = nInHopLimitZero;
+  s.nOutHopLimitZero = nOutHopLimitZero;
+  s.nInSatisfiedInterests = nInSatisfiedInterests;
+  s.nInUnsatisfiedInterests = nInUnsatisfiedInterests;
+  s.nOutSatisfiedInterests = nOutSatisfiedInterests;
+  s.nOutUnsatisfiedInterests = nOutUnsatisfiedInterests;
+  return s;
+}
+
 } // namespace face
 } // namespace nfd
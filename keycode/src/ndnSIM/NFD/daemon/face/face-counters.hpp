@@ -45,6 +45,47 @@ public:
   FaceCounters(const LinkService::Counters& linkServiceCounters,
                const Transport::Counters& transportCounters);
 
+  /** \brief a copy of the counter values taken at one point in time
+   *
+   *  Counters are only modified from the forwarding thread, therefore a Snapshot taken
+   *  from the same thread (e.g., in a scheduled event) is consistent across all fields.
+   */
+  struct Snapshot
+  {
+    uint64_t nInInterests;
+    uint64_t nOutInterests;
+    uint64_t nInterestsExceededRetx;
+    uint64_t nInData;
+    uint64_t nOutData;
+    uint64_t nInNacks;
+    uint64_t nOutNacks;
+
+    uint64_t nInInterestBytes;
+    uint64_t nOutInterestBytes;
+    uint64_t nInDataBytes;
+    uint64_t nOutDataBytes;
+    uint64_t nInNackBytes;
+    uint64_t nOutNackBytes;
+
+    uint64_t nInPackets;
+    uint64_t nOutPackets;
+    uint64_t nInBytes;
+    uint64_t nOutBytes;
+
+    uint64_t nInHopLimitZero;
+    uint64_t nOutHopLimitZero;
+
+    uint64_t nInSatisfiedInterests;
+    uint64_t nInUnsatisfiedInterests;
+    uint64_t nOutSatisfiedInterests;
+    uint64_t nOutUnsatisfiedInterests;
+  };
+
+  /** \return current values of all counters
+   */
+  Snapshot
+  snapshot() const;
+
   /** \return counters provided by LinkService
    *  \tparam T LinkService counters type
    *  \throw std::bad_cast counters type mismatch
@@ -76,6 +117,13 @@ public:
   const PacketCounter& nInNacks;
   const PacketCounter& nOutNacks;
 
+  const ByteCounter& nInInterestBytes;
+  const ByteCounter& nOutInterestBytes;
+  const ByteCounter& nInDataBytes;
+  const ByteCounter& nOutDataBytes;
+  const ByteCounter& nInNackBytes;
+  const ByteCounter& nOutNackBytes;
+
   const PacketCounter& nInPackets;
   const PacketCounter& nOutPackets;
   const ByteCounter& nInBytes;
@@ -89,6 +137,22 @@ public:
    */
   PacketCounter nOutHopLimitZero;
 
+  /** \brief count of satisfied PIT entries that had an in-record of this face
+   */
+  PacketCounter nInSatisfiedInterests;
+
+  /** \brief count of PIT entries that had an in-record of this face and expired unsatisfied
+   */
+  PacketCounter nInUnsatisfiedInterests;
+
+  /** \brief count of satisfied PIT entries that had an out-record of this face
+   */
+  PacketCounter nOutSatisfiedInterests;
+
+  /** \brief count of PIT entries that had an out-record of this face and expired unsatisfied
+   */
+  PacketCounter nOutUnsatisfiedInterests;
+
 private:
   const LinkService::Counters& m_linkServiceCounters;
   const Transport::Counters& m_transportCounters;
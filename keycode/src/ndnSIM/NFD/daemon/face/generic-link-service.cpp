@@ -103,7 +103,8 @@ GenericLinkService::sendLpPacket(lp::Packet&& pkt)
     checkCongestionLevel(pkt);
   }
 
-  auto block = pkt.wireEncode();
+  // a transport that gathers the packet copies the fragment only once, into its own buffer
+  auto block = getTransport()->canSendComposite() ? pkt.wireEncodeComposite() : pkt.wireEncode();
   if (mtu != MTU_UNLIMITED && block.size() > static_cast<size_t>(mtu)) {
     ++nOutOverMtu;
     NFD_LOG_FACE_WARN("attempted to send packet over MTU limit");
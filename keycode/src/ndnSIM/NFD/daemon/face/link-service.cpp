@@ -51,6 +51,13 @@ LinkService::setFaceAndTransport(Face& face, Transport& transport)
   m_transport = &transport;
 }
 
+template<typename Packet>
+static size_t
+wireSize(const Packet& pkt)
+{
+  return pkt.hasWire() ? pkt.wireEncode().size() : 0;
+}
+
 void
 LinkService::sendInterest(const Interest& interest)
 {
@@ -60,6 +67,7 @@ LinkService::sendInterest(const Interest& interest)
   ++this->nOutInterests;
 
   doSendInterest(interest);
+  this->nOutInterestBytes += wireSize(interest);
 
   afterSendInterest(interest);
 }
@@ -73,6 +81,7 @@ LinkService::sendData(const Data& data)
   ++this->nOutData;
 
   doSendData(data);
+  this->nOutDataBytes += wireSize(data);
 
   afterSendData(data);
 }
@@ -86,6 +95,7 @@ LinkService::sendNack(const ndn::lp::Nack& nack)
   ++this->nOutNacks;
 
   doSendNack(nack);
+  this->nOutNackBytes += wireSize(nack.getInterest());
 
   afterSendNack(nack);
 }
@@ -96,6 +106,7 @@ LinkService::receiveInterest(const Interest& interest, const EndpointId& endpoin
   NFD_LOG_FACE_TRACE(__func__);
 
   ++this->nInInterests;
+  this->nInInterestBytes += wireSize(interest);
 
   afterReceiveInterest(interest, endpoint);
 }
@@ -106,6 +117,7 @@ LinkService::receiveData(const Data& data, const EndpointId& endpoint)
   NFD_LOG_FACE_TRACE(__func__);
 
   ++this->nInData;
+  this->nInDataBytes += wireSize(data);
 
   afterReceiveData(data, endpoint);
 }
@@ -116,6 +128,7 @@ LinkService::receiveNack(const ndn::lp::Nack& nack, const EndpointId& endpoint)
   NFD_LOG_FACE_TRACE(__func__);
 
   ++this->nInNacks;
+  this->nInNackBytes += wireSize(nack.getInterest());
 
   afterReceiveNack(nack, endpoint);
 }
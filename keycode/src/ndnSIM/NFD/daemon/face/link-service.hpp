@@ -67,6 +67,32 @@ public:
   /** \brief count of outgoing Nacks
    */
   PacketCounter nOutNacks;
+
+  /** \brief total size of incoming Interests
+   *
+   *  Only Interests that carry a wire encoding are accounted for.
+   */
+  ByteCounter nInInterestBytes;
+
+  /** \brief total size of outgoing Interests
+   */
+  ByteCounter nOutInterestBytes;
+
+  /** \brief total size of incoming Data packets
+   */
+  ByteCounter nInDataBytes;
+
+  /** \brief total size of outgoing Data packets
+   */
+  ByteCounter nOutDataBytes;
+
+  /** \brief total size of the Interests carried by incoming Nacks
+   */
+  ByteCounter nInNackBytes;
+
+  /** \brief total size of the Interests carried by outgoing Nacks
+   */
+  ByteCounter nOutNackBytes;
 };
 
 /** \brief the upper part of a Face
@@ -82,7 +82,7 @@ LpFragmenter::fragmentPacket(const lp::Packet& packet, size_t mtu)
   BOOST_ASSERT(!packet.has<lp::FragIndexField>());
   BOOST_ASSERT(!packet.has<lp::FragCountField>());
 
-  if (MAX_SINGLE_FRAG_OVERHEAD + packet.wireEncode().size() <= mtu) {
+  if (MAX_SINGLE_FRAG_OVERHEAD + packet.wireEncodeComposite().size() <= mtu) {
     // fast path: fragmentation not needed
     // To qualify for fast path, the packet must have space for adding a sequence number,
     // because another NDNLPv2 feature may require the sequence number.
@@ -95,7 +95,7 @@ LpFragmenter::fragmentPacket(const lp::Packet& packet, size_t mtu)
 
   // compute size of other NDNLPv2 headers to be placed on the first fragment
   size_t firstHeaderSize = 0;
-  const Block& packetWire = packet.wireEncode();
+  const Block& packetWire = packet.wireEncodeComposite();
   if (packetWire.type() == lp::tlv::LpPacket) {
     for (const Block& element : packetWire.elements()) {
       if (element.type() != lp::tlv::Fragment) {
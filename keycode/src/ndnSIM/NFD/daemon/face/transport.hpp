@@ -232,6 +232,14 @@ public: // static properties
   ssize_t
   getSendQueueCapacity() const;
 
+  /** \return whether the transport can send a packet that has not been encoded into a single buffer
+   *
+   *  Such a packet keeps referencing the buffers of its header fields and of its fragment,
+   *  and the transport serializes it with ndn::Block::gather() instead of reading its wire.
+   */
+  bool
+  canSendComposite() const;
+
 public: // dynamic properties
   /** \return transport state
    */
@@ -286,6 +294,9 @@ protected: // properties to be set by subclass
   void
   setSendQueueCapacity(ssize_t sendQueueCapacity);
 
+  void
+  setCanSendComposite(bool canSendComposite);
+
   /** \brief set transport state
    *
    *  Only the following transitions are valid:
@@ -347,6 +358,7 @@ private:
   ndn::nfd::LinkType m_linkType;
   ssize_t m_mtu;
   ssize_t m_sendQueueCapacity;
+  bool m_canSendComposite;
   TransportState m_state;
   time::steady_clock::TimePoint m_expirationTime;
 };
@@ -447,6 +459,18 @@ Transport::setSendQueueCapacity(ssize_t sendQueueCapacity)
   m_sendQueueCapacity = sendQueueCapacity;
 }
 
+inline bool
+Transport::canSendComposite() const
+{
+  return m_canSendComposite;
+}
+
+inline void
+Transport::setCanSendComposite(bool canSendComposite)
+{
+  m_canSendComposite = canSendComposite;
+}
+
 inline TransportState
 Transport::getState() const
 {
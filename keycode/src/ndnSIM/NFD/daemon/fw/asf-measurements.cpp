@@ -38,7 +38,7 @@ FaceInfo::scheduleTimeout(const Name& interestName, scheduler::EventCallback cb)
 {
   BOOST_ASSERT(!m_timeoutEvent);
   m_lastInterestName = interestName;
-  m_timeoutEvent = getScheduler().schedule(m_rttEstimator.getEstimatedRto(), std::move(cb));
+  m_timeoutEvent = getScheduler().scheduleCoarse(m_rttEstimator.getEstimatedRto(), std::move(cb));
   return m_rttEstimator.getEstimatedRto();
 }
 
@@ -76,8 +76,8 @@ NamespaceInfo::getOrCreateFaceInfo(FaceId faceId)
 void
 NamespaceInfo::extendFaceInfoLifetime(FaceInfo& info, FaceId faceId)
 {
-  info.m_measurementExpiration = getScheduler().schedule(AsfMeasurements::MEASUREMENTS_LIFETIME,
-                                                         [=] { m_fiMap.erase(faceId); });
+  info.m_measurementExpiration = getScheduler().scheduleCoarse(AsfMeasurements::MEASUREMENTS_LIFETIME,
+                                                               [=] { m_fiMap.erase(faceId); });
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -76,9 +76,20 @@ BestRouteStrategy::afterReceiveInterest(const Interest& interest, const FaceEndp
   auto it = nexthops.end();
 
   if (suppression == RetxSuppressionResult::NEW) {
-    // forward to nexthop with lowest cost except downstream
+    // fast path: the lowest-cost nexthop whose face is up is usually eligible
+    const fib::NextHop* usable = fibEntry.getFirstUsableNextHop();
+    if (usable != nullptr && isNextHopEligible(ingress.face, interest, *usable, pitEntry)) {
+      Face& outFace = usable->getFace();
+      NFD_LOG_DEBUG(interest << " from=" << ingress << " newPitEntry-to=" << outFace.getId());
+      this->sendInterest(interest, outFace, pitEntry);
+      return;
+    }
+
+    // forward to nexthop with lowest cost except downstream, skipping faces that are not up
+    // as the fast path does, so that the choice does not depend on which path made it
     it = std::find_if(nexthops.begin(), nexthops.end(), [&] (const auto& nexthop) {
-      return isNextHopEligible(ingress.face, interest, nexthop, pitEntry);
+      return nexthop.getFace().getState() == face::FaceState::UP &&
+             isNextHopEligible(ingress.face, interest, nexthop, pitEntry);
     });
 
     if (it == nexthops.end()) {
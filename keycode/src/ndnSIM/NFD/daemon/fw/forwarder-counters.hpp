@@ -34,6 +34,47 @@ namespace nfd {
  */
 class ForwarderCounters
 {
+public:
+  /** \brief a copy of the counter values taken at one point in time
+   *  \sa face::FaceCounters::Snapshot
+   */
+  struct Snapshot
+  {
+    uint64_t nInInterests;
+    uint64_t nOutInterests;
+    uint64_t nInData;
+    uint64_t nOutData;
+    uint64_t nInNacks;
+    uint64_t nOutNacks;
+
+    uint64_t nSatisfiedInterests;
+    uint64_t nUnsatisfiedInterests;
+    uint64_t nUnsolicitedData;
+
+    uint64_t nCsHits;
+    uint64_t nCsMisses;
+  };
+
+  /** \return current values of all counters
+   */
+  Snapshot
+  snapshot() const
+  {
+    Snapshot s;
+    s.nInInterests = nInInterests;
+    s.nOutInterests = nOutInterests;
+    s.nInData = nInData;
+    s.nOutData = nOutData;
+    s.nInNacks = nInNacks;
+    s.nOutNacks = nOutNacks;
+    s.nSatisfiedInterests = nSatisfiedInterests;
+    s.nUnsatisfiedInterests = nUnsatisfiedInterests;
+    s.nUnsolicitedData = nUnsolicitedData;
+    s.nCsHits = nCsHits;
+    s.nCsMisses = nCsMisses;
+    return s;
+  }
+
 public:
   PacketCounter nInInterests;
   PacketCounter nOutInterests;
@@ -54,13 +54,30 @@ getDefaultStrategyName()
   return fw::BestRouteStrategy::getStrategyName();
 }
 
-Forwarder::Forwarder(FaceTable& faceTable)
+/** \brief count a satisfied or expired PIT entry on the faces of its in-records and out-records
+ */
+static void
+countPitEntryOnFaces(const pit::Entry& pitEntry, bool isSatisfied)
+{
+  for (const pit::InRecord& inRecord : pitEntry.getInRecords()) {
+    face::FaceCounters& counters = inRecord.getFace().getCounters();
+    ++(isSatisfied ? counters.nInSatisfiedInterests : counters.nInUnsatisfiedInterests);
+  }
+  for (const pit::OutRecord& outRecord : pitEntry.getOutRecords()) {
+    face::FaceCounters& counters = outRecord.getFace().getCounters();
+    ++(isSatisfied ? counters.nOutSatisfiedInterests : counters.nOutUnsatisfiedInterests);
+  }
+}
+
+Forwarder::Forwarder(FaceTable& faceTable, size_t nNameTreeBuckets)
   : m_faceTable(faceTable)
   , m_unsolicitedDataPolicy(make_unique<fw::DefaultUnsolicitedDataPolicy>())
+  , m_nameTree(nNameTreeBuckets)
   , m_fib(m_nameTree)
   , m_pit(m_nameTree)
   , m_measurements(m_nameTree)
   , m_strategyChoice(*this)
+  , m_deadNonceList(make_unique<DeadNonceList>())
   , m_csFace(face::makeNullFace(FaceUri("contentstore://")))
 {
   m_faceTable.addReserved(m_csFace, face::FACEID_CONTENT_STORE);
@@ -82,6 +99,10 @@ Forwarder::Forwarder(FaceTable& faceTable)
       [this, &face] (const Interest& interest) {
         this->onDroppedInterest(interest, const_cast<Face&>(face));
       });
+    face.afterStateChange.connect(
+      [this, &face] (face::FaceState, face::FaceState) {
+        m_fib.updateUsableNextHops(face);
+      });
   });
 
   m_faceTable.beforeRemove.connect([this] (const Face& face) {
@@ -97,6 +118,15 @@ Forwarder::Forwarder(FaceTable& faceTable)
 
 Forwarder::~Forwarder() = default;
 
+DeadNonceListBase&
+Forwarder::getDeadNonceList()
+{
+  if (m_deadNonceList == nullptr) {
+    m_deadNonceList = m_deadNonceListFactory();
+  }
+  return *m_deadNonceList;
+}
+
 void
 Forwarder::onIncomingInterest(const Interest& interest, const FaceEndpoint& ingress)
 {
@@ -129,7 +159,8 @@ Forwarder::onIncomingInterest(const Interest& interest, const FaceEndpoint& ingr
   }
 
   // detect duplicate Nonce with Dead Nonce List
-  bool hasDuplicateNonceInDnl = m_deadNonceList.has(interest.getName(), interest.getNonce());
+  bool hasDuplicateNonceInDnl = m_deadNonceList != nullptr &&
+                                m_deadNonceList->has(interest.getName(), interest.getNonce());
   if (hasDuplicateNonceInDnl) {
     // goto Interest loop pipeline
     this->onInterestLoop(interest, ingress);
@@ -137,7 +168,7 @@ Forwarder::onIncomingInterest(const Interest& interest, const FaceEndpoint& ingr
   }
 
   // strip forwarding hint if Interest has reached producer region
-  if (!interest.getForwardingHint().empty() &&
+  if (interest.hasForwardingHint() &&
       m_networkRegionTable.isInProducerRegion(interest.getForwardingHint())) {
     NFD_LOG_DEBUG("onIncomingInterest in=" << ingress
                   << " interest=" << interest.getName() << " reaching-producer-region");
@@ -254,6 +285,7 @@ Forwarder::onContentStoreHit(const Interest& interest, const FaceEndpoint& ingre
   // set PIT expiry timer to now
   this->setExpiryTimer(pitEntry, 0_ms);
 
+  countPitEntryOnFaces(*pitEntry, true);
   beforeSatisfyInterest(*pitEntry, *m_csFace, data);
   m_strategyChoice.findEffectiveStrategy(*pitEntry).beforeSatisfyInterest(data, FaceEndpoint(*m_csFace, 0), pitEntry);
 
@@ -292,6 +324,7 @@ Forwarder::onInterestFinalize(const shared_ptr<pit::Entry>& pitEntry)
                 << (pitEntry->isSatisfied ? " satisfied" : " unsatisfied"));
 
   if (!pitEntry->isSatisfied) {
+    countPitEntryOnFaces(*pitEntry, false);
     beforeExpirePendingInterest(*pitEntry);
   }
 
@@ -346,6 +379,7 @@ Forwarder::onIncomingData(const Data& data, const FaceEndpoint& ingress)
     NFD_LOG_DEBUG("onIncomingData matching=" << pitEntry->getName());
 
     // invoke PIT satisfy callback
+    countPitEntryOnFaces(*pitEntry, true);
     beforeSatisfyInterest(*pitEntry, ingress.face, data);
 
     std::set<std::pair<Face*, EndpointId>> unsatisfiedDownstreams;
@@ -587,7 +621,7 @@ Forwarder::setExpiryTimer(const shared_ptr<pit::Entry>& pitEntry, time::millisec
   duration = std::max(duration, 0_ms);
 
   pitEntry->expiryTimer.cancel();
-  pitEntry->expiryTimer = getScheduler().schedule(duration, [=] { onInterestFinalize(pitEntry); });
+  pitEntry->expiryTimer = getScheduler().scheduleCoarse(duration, [=] { onInterestFinalize(pitEntry); });
 }
 
 void
@@ -598,7 +632,7 @@ Forwarder::insertDeadNonceList(pit::Entry& pitEntry, const Face* upstream)
   if (pitEntry.isSatisfied) {
     BOOST_ASSERT(pitEntry.dataFreshnessPeriod >= 0_ms);
     needDnl = pitEntry.getInterest().getMustBeFresh() &&
-              pitEntry.dataFreshnessPeriod < m_deadNonceList.getLifetime();
+              pitEntry.dataFreshnessPeriod < getDeadNonceList().getLifetime();
   }
 
   if (!needDnl) {
@@ -606,18 +640,19 @@ Forwarder::insertDeadNonceList(pit::Entry& pitEntry, const Face* upstream)
   }
 
   // Dead Nonce List insert
+  DeadNonceListBase& dnl = getDeadNonceList();
   if (upstream == nullptr) {
     // insert all outgoing Nonces
     const auto& outRecords = pitEntry.getOutRecords();
     std::for_each(outRecords.begin(), outRecords.end(), [&] (const auto& outRecord) {
-      m_deadNonceList.add(pitEntry.getName(), outRecord.getLastNonce());
+      dnl.add(pitEntry.getName(), outRecord.getLastNonce());
     });
   }
   else {
     // insert outgoing Nonce of a specific face
     auto outRecord = pitEntry.getOutRecord(*upstream);
     if (outRecord != pitEntry.getOutRecords().end()) {
-      m_deadNonceList.add(pitEntry.getName(), outRecord->getLastNonce());
+      dnl.add(pitEntry.getName(), outRecord->getLastNonce());
     }
   }
 }
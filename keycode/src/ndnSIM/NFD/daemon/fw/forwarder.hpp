@@ -53,8 +53,11 @@ class Strategy;
 class Forwarder
 {
 public:
+  /** \param faceTable the faces of the forwarder
+   *  \param nNameTreeBuckets initial number of NameTree buckets, the NameTree grows as needed
+   */
   explicit
-  Forwarder(FaceTable& faceTable);
+  Forwarder(FaceTable& faceTable, size_t nNameTreeBuckets = 1024);
 
   NFD_VIRTUAL_WITH_TESTS
   ~Forwarder();
@@ -114,10 +117,35 @@ public:
     return m_strategyChoice;
   }
 
-  DeadNonceList&
-  getDeadNonceList()
+  /** \brief Get the Dead Nonce List, creating it if it is created on first use
+   */
+  DeadNonceListBase&
+  getDeadNonceList();
+
+  /** \brief Replace the Dead Nonce List implementation
+   *
+   *  Nonces recorded in the previous Dead Nonce List are discarded.
+   */
+  void
+  setDeadNonceList(unique_ptr<DeadNonceListBase> dnl)
+  {
+    BOOST_ASSERT(dnl != nullptr);
+    m_deadNonceList = std::move(dnl);
+  }
+
+  using DeadNonceListFactory = std::function<unique_ptr<DeadNonceListBase>()>;
+
+  /** \brief Replace the Dead Nonce List by one that @p factory creates on first insertion
+   *
+   *  Until an Interest is recorded, no Dead Nonce List is allocated and no maintenance
+   *  event is scheduled, so idle forwarders of large simulations do not pay for it.
+   */
+  void
+  setDeadNonceListFactory(DeadNonceListFactory factory)
   {
-    return m_deadNonceList;
+    BOOST_ASSERT(factory != nullptr);
+    m_deadNonceListFactory = std::move(factory);
+    m_deadNonceList.reset();
   }
 
   NetworkRegionTable&
@@ -266,7 +294,8 @@ private:
   Cs                 m_cs;
   Measurements       m_measurements;
   StrategyChoice     m_strategyChoice;
-  DeadNonceList      m_deadNonceList;
+  unique_ptr<DeadNonceListBase> m_deadNonceList; ///< nullptr until first use with a factory
+  DeadNonceListFactory m_deadNonceListFactory;
   NetworkRegionTable m_networkRegionTable;
   shared_ptr<Face>   m_csFace;
 
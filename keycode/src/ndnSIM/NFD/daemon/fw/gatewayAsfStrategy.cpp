@@ -0,0 +1,336 @@
+#include "gatewayAsfStrategy.hpp"
+#include "algorithm.hpp"
+#include "common/logger.hpp"
+
+namespace nfd {
+namespace fw {
+
+NFD_LOG_INIT(GatewayAsfStrategy);
+NFD_REGISTER_STRATEGY(GatewayAsfStrategy);
+
+const time::milliseconds GatewayAsfStrategy::RETX_SUPPRESSION_INITIAL(10);
+const time::milliseconds GatewayAsfStrategy::RETX_SUPPRESSION_MAX(250);
+
+/// Interest by which the gateway application registers its tunnel face
+static const Name TUNNEL_REGISTRY("/tunnel/tunnelRegisty");
+
+GatewayAsfStrategy::GatewayAsfStrategy(Forwarder& forwarder, const Name& name)
+  : GatewayTunnelStrategy(forwarder)
+  , m_measurements(getMeasurements())
+  , m_probing(m_measurements)
+  , m_retxSuppression(RETX_SUPPRESSION_INITIAL,
+                      RetxSuppressionExponential::DEFAULT_MULTIPLIER,
+                      RETX_SUPPRESSION_MAX)
+{
+  ParsedInstanceName parsed = parseInstanceName(name);
+  if (!parsed.parameters.empty()) {
+    processParams(parsed.parameters);
+  }
+
+  if (parsed.version && *parsed.version != getStrategyName()[-1].toVersion()) {
+    NDN_THROW(std::invalid_argument(
+      "GatewayAsfStrategy does not support version " + to_string(*parsed.version)));
+  }
+  this->setInstanceName(makeInstanceName(name, getStrategyName()));
+}
+
+const Name&
+GatewayAsfStrategy::getStrategyName()
+{
+  static const auto strategyName = Name("/localhost/nfd/strategy/gateway-asf").appendVersion(1);
+  return strategyName;
+}
+
+void
+GatewayAsfStrategy::processParams(const PartialName& parsed)
+{
+  for (const auto& component : parsed) {
+    std::string parsedStr(reinterpret_cast<const char*>(component.value()), component.value_size());
+    auto n = parsedStr.find("~");
+    if (n == std::string::npos) {
+      NDN_THROW(std::invalid_argument("Format is <parameter>~<value>"));
+    }
+
+    auto f = parsedStr.substr(0, n);
+    auto s = parsedStr.substr(n + 1);
+    uint64_t value = 0;
+    try {
+      if (s.empty() || s[0] == '-') {
+        NDN_THROW(boost::bad_lexical_cast());
+      }
+      value = boost::lexical_cast<uint64_t>(s);
+    }
+    catch (const boost::bad_lexical_cast&) {
+      NDN_THROW(std::invalid_argument("Value of " + f + " must be a non-negative integer"));
+    }
+
+    if (f == "probing-interval") {
+      m_probing.setProbingInterval(value);
+    }
+    else if (f == "max-timeouts") {
+      if (value == 0) {
+        NDN_THROW(std::invalid_argument("max-timeouts should be greater than 0"));
+      }
+      m_nMaxTimeouts = value;
+    }
+    else {
+      NDN_THROW(std::invalid_argument("Parameter should be probing-interval or max-timeouts"));
+    }
+  }
+}
+
+void
+GatewayAsfStrategy::afterReceiveInterest(const Interest& interest, const FaceEndpoint& ingress,
+                                         const shared_ptr<pit::Entry>& pitEntry)
+{
+  if (interest.getName() == TUNNEL_REGISTRY) {
+    GatewayTunnelStrategy::afterReceiveInterest(interest, ingress, pitEntry);
+    return;
+  }
+
+  const fib::Entry& fibEntry = this->lookupFib(*pitEntry);
+  bool isNewInterest = !hasPendingOutRecords(*pitEntry);
+
+  Face* faceToUse = getBestFaceForForwarding(interest, ingress.face, fibEntry, pitEntry,
+                                             isNewInterest);
+  if (faceToUse == nullptr) {
+    if (isNewInterest) {
+      NFD_LOG_DEBUG(interest << " new-interest from=" << ingress << " no-nexthop");
+      lp::NackHeader nackHeader;
+      nackHeader.setReason(lp::NackReason::NO_ROUTE);
+      this->sendNack(nackHeader, ingress.face, pitEntry);
+      this->rejectPendingInterest(pitEntry);
+    }
+    else {
+      NFD_LOG_DEBUG(interest << " retx-interest from=" << ingress << " no eligible nexthop");
+    }
+    return;
+  }
+
+  if (isNewInterest) {
+    NFD_LOG_DEBUG(interest << " new-interest from=" << ingress << " forward-to=" << faceToUse->getId());
+    forwardInterest(interest, *faceToUse, fibEntry, pitEntry);
+    sendProbe(interest, ingress, *faceToUse, fibEntry, pitEntry);
+    return;
+  }
+
+  auto suppressResult = m_retxSuppression.decidePerUpstream(*pitEntry, *faceToUse);
+  if (suppressResult == RetxSuppressionResult::SUPPRESS) {
+    NFD_LOG_DEBUG(interest << " retx-interest from=" << ingress
+                  << " forward-to=" << faceToUse->getId() << " suppressed");
+    return;
+  }
+
+  NFD_LOG_DEBUG(interest << " retx-interest from=" << ingress << " forward-to=" << faceToUse->getId());
+  auto* outRecord = forwardInterest(interest, *faceToUse, fibEntry, pitEntry);
+  if (outRecord && suppressResult == RetxSuppressionResult::FORWARD) {
+    m_retxSuppression.incrementIntervalForOutRecord(*outRecord);
+  }
+}
+
+void
+GatewayAsfStrategy::beforeSatisfyInterest(const Data& data, const FaceEndpoint& ingress,
+                                          const shared_ptr<pit::Entry>& pitEntry)
+{
+  asf::NamespaceInfo* namespaceInfo = m_measurements.getNamespaceInfo(pitEntry->getName());
+  if (namespaceInfo == nullptr) {
+    NFD_LOG_DEBUG(pitEntry->getName() << " data from=" << ingress << " no-measurements");
+    return;
+  }
+
+  asf::FaceInfo* faceInfo = namespaceInfo->getFaceInfo(ingress.face.getId());
+  if (faceInfo == nullptr) {
+    NFD_LOG_DEBUG(pitEntry->getName() << " data from=" << ingress << " no-face-info");
+    return;
+  }
+
+  auto outRecord = pitEntry->getOutRecord(ingress.face);
+  if (outRecord == pitEntry->out_end()) {
+    NFD_LOG_DEBUG(pitEntry->getName() << " data from=" << ingress << " no-out-record");
+  }
+  else {
+    faceInfo->recordRtt(time::steady_clock::now() - outRecord->getLastRenewed());
+    NFD_LOG_DEBUG(pitEntry->getName() << " data from=" << ingress
+                  << " rtt=" << faceInfo->getLastRtt() << " srtt=" << faceInfo->getSrtt());
+  }
+
+  namespaceInfo->extendFaceInfoLifetime(*faceInfo, ingress.face.getId());
+  // Extend PIT entry timer to allow the slower path to answer the probe
+  this->setExpiryTimer(pitEntry, 50_ms);
+  faceInfo->cancelTimeout(data.getName());
+}
+
+void
+GatewayAsfStrategy::afterReceiveNack(const lp::Nack& nack, const FaceEndpoint& ingress,
+                                     const shared_ptr<pit::Entry>& pitEntry)
+{
+  NFD_LOG_DEBUG(nack.getInterest() << " nack from=" << ingress << " reason=" << nack.getReason());
+  onTimeoutOrNack(pitEntry->getName(), ingress.face.getId(), true);
+  GatewayTunnelStrategy::afterReceiveNack(nack, ingress, pitEntry);
+}
+
+const fib::NextHop*
+GatewayAsfStrategy::getTunnelNextHop() const
+{
+  if (m_RegistyApp.empty()) {
+    return nullptr;
+  }
+  return m_forwarder.getFib().findLongestPrefixMatch(m_RegistyApp).getFirstUsableNextHop();
+}
+
+namespace {
+
+struct FaceRank
+{
+  Face* face;
+  time::nanoseconds srtt;
+  bool isTunnel;
+  uint64_t cost;
+
+  /** \brief Sort by SRTT, ranking faces without measurements behind measured ones and ahead
+   *         of timed-out ones, then prefer the in-domain path, then by cost
+   */
+  bool
+  operator<(const FaceRank& other) const
+  {
+    return std::tie(srtt, isTunnel, cost) < std::tie(other.srtt, other.isTunnel, other.cost);
+  }
+};
+
+} // namespace
+
+static time::nanoseconds
+getRankingRtt(const asf::FaceInfo* info)
+{
+  if (info == nullptr || info->getLastRtt() == asf::FaceInfo::RTT_NO_MEASUREMENT) {
+    return time::nanoseconds::max() / 2;
+  }
+  if (info->hasTimeout()) {
+    return time::nanoseconds::max();
+  }
+  return info->getSrtt();
+}
+
+Face*
+GatewayAsfStrategy::getBestFaceForForwarding(const Interest& interest, const Face& inFace,
+                                             const fib::Entry& fibEntry,
+                                             const shared_ptr<pit::Entry>& pitEntry,
+                                             bool isInterestNew)
+{
+  auto now = time::steady_clock::now();
+  const fib::NextHop* tunnel = getTunnelNextHop();
+  const Face* tunnelFace = tunnel != nullptr ? &tunnel->getFace() : nullptr;
+
+  std::vector<FaceRank> ranked;
+  if (hasPrefixInDomain(interest)) {
+    for (const auto& nh : fibEntry.getNextHops()) {
+      if (&nh.getFace() == tunnelFace ||
+          !isNextHopEligible(inFace, interest, nh, pitEntry, !isInterestNew, now)) {
+        continue;
+      }
+      auto* info = m_measurements.getFaceInfo(fibEntry, interest.getName(), nh.getFace().getId());
+      ranked.push_back({&nh.getFace(), getRankingRtt(info), false, nh.getCost()});
+    }
+  }
+
+  // Interests coming out of the tunnel must not be tunneled again
+  if (tunnel != nullptr && tunnelFace != &inFace &&
+      isNextHopEligible(inFace, interest, *tunnel, pitEntry, !isInterestNew, now)) {
+    auto* info = m_measurements.getFaceInfo(fibEntry, interest.getName(), tunnelFace->getId());
+    ranked.push_back({&tunnel->getFace(), getRankingRtt(info), true, tunnel->getCost()});
+  }
+
+  auto best = std::min_element(ranked.begin(), ranked.end());
+  return best != ranked.end() ? best->face : nullptr;
+}
+
+pit::OutRecord*
+GatewayAsfStrategy::forwardInterest(const Interest& interest, Face& outFace,
+                                    const fib::Entry& fibEntry,
+                                    const shared_ptr<pit::Entry>& pitEntry)
+{
+  const auto& interestName = interest.getName();
+  auto faceId = outFace.getId();
+
+  auto* outRecord = sendInterest(interest, outFace, pitEntry);
+
+  asf::FaceInfo& faceInfo = m_measurements.getOrCreateFaceInfo(fibEntry, interestName, faceId);
+
+  // Refresh measurements since Face is being used for forwarding
+  asf::NamespaceInfo& namespaceInfo = m_measurements.getOrCreateNamespaceInfo(fibEntry, interestName);
+  namespaceInfo.extendFaceInfoLifetime(faceInfo, faceId);
+
+  if (!faceInfo.isTimeoutScheduled()) {
+    faceInfo.scheduleTimeout(interestName, [this, name = interestName, faceId] {
+      onTimeoutOrNack(name, faceId, false);
+    });
+  }
+
+  return outRecord;
+}
+
+void
+GatewayAsfStrategy::sendProbe(const Interest& interest, const FaceEndpoint& ingress,
+                              const Face& faceToUse, const fib::Entry& fibEntry,
+                              const shared_ptr<pit::Entry>& pitEntry)
+{
+  if (!m_probing.isProbingNeeded(fibEntry, interest.getName())) {
+    return;
+  }
+
+  // probe the path that is not in use: the tunnel while forwarding in the domain,
+  // and the best in-domain nexthop while forwarding on the tunnel
+  Face* faceToProbe = nullptr;
+  const fib::NextHop* tunnel = getTunnelNextHop();
+  if (tunnel != nullptr && &tunnel->getFace() == &faceToUse) {
+    if (hasPrefixInDomain(interest)) {
+      faceToProbe = m_probing.getFaceToProbe(ingress.face, interest, fibEntry, faceToUse);
+    }
+  }
+  else if (tunnel != nullptr && &tunnel->getFace() != &ingress.face &&
+           isNextHopEligible(ingress.face, interest, *tunnel, pitEntry)) {
+    faceToProbe = &tunnel->getFace();
+  }
+  if (faceToProbe == nullptr) {
+    return;
+  }
+
+  Interest probeInterest(interest);
+  probeInterest.refreshNonce();
+  NFD_LOG_TRACE("Sending probe " << probeInterest << " to=" << faceToProbe->getId());
+  forwardInterest(probeInterest, *faceToProbe, fibEntry, pitEntry);
+
+  m_probing.afterForwardingProbe(fibEntry, interest.getName());
+}
+
+void
+GatewayAsfStrategy::onTimeoutOrNack(const Name& interestName, FaceId faceId, bool isNack)
+{
+  asf::NamespaceInfo* namespaceInfo = m_measurements.getNamespaceInfo(interestName);
+  if (namespaceInfo == nullptr) {
+    NFD_LOG_TRACE(interestName << " FibEntry has been removed since timeout scheduling");
+    return;
+  }
+
+  asf::FaceInfo* faceInfo = namespaceInfo->getFaceInfo(faceId);
+  if (faceInfo == nullptr) {
+    NFD_LOG_TRACE(interestName << " FaceInfo id=" << faceId << " has been removed since timeout scheduling");
+    return;
+  }
+
+  size_t nTimeouts = faceInfo->getNTimeouts() + 1;
+  faceInfo->setNTimeouts(nTimeouts);
+
+  if (nTimeouts < m_nMaxTimeouts && !isNack) {
+    NFD_LOG_TRACE(interestName << " face=" << faceId << " timeout-count=" << nTimeouts << " ignoring");
+    namespaceInfo->extendFaceInfoLifetime(*faceInfo, faceId);
+    faceInfo->cancelTimeout(interestName);
+  }
+  else {
+    NFD_LOG_TRACE(interestName << " face=" << faceId << " timeout-count=" << nTimeouts);
+    faceInfo->recordTimeout(interestName);
+  }
+}
+
+} // namespace fw
+} // namespace nfd
@@ -0,0 +1,88 @@
+#ifndef GATEWAYASFSTRATEGY_HPP
+#define GATEWAYASFSTRATEGY_HPP
+
+#include "gatewayTunnelStrategy.hpp"
+#include "asf-measurements.hpp"
+#include "asf-probing-module.hpp"
+#include "fw/retx-suppression-exponential.hpp"
+
+namespace nfd {
+namespace fw {
+
+/** \brief Gateway strategy that chooses between the in-domain path and the IP tunnel by RTT
+ *
+ *  GatewayTunnelStrategy always forwards an Interest whose prefix is reachable inside the domain
+ *  on the in-domain path. This strategy keeps SRTT and timeout measurements of both the FIB
+ *  nexthops and the tunnel face of the gateway application, using the measurements and the
+ *  probing module of AsfStrategy, and forwards each new Interest on the faster of the two.
+ *  The path that is not in use is probed periodically, so that an overloaded in-domain path
+ *  can spill traffic onto the IP backbone and take it back when it recovers.
+ *
+ *  Prefixes that are not reachable inside the domain are always forwarded on the tunnel.
+ *  Interests arriving from the tunnel are never sent back into it.
+ *
+ *  Parameters are the same as AsfStrategy: probing-interval~<ms> and max-timeouts~<n>.
+ */
+class GatewayAsfStrategy : public GatewayTunnelStrategy
+{
+public:
+  explicit
+  GatewayAsfStrategy(Forwarder& forwarder, const Name& name = getStrategyName());
+
+  static const Name&
+  getStrategyName();
+
+public: // triggers
+  void
+  afterReceiveInterest(const Interest& interest, const FaceEndpoint& ingress,
+                       const shared_ptr<pit::Entry>& pitEntry) override;
+
+  void
+  beforeSatisfyInterest(const Data& data, const FaceEndpoint& ingress,
+                        const shared_ptr<pit::Entry>& pitEntry) override;
+
+  void
+  afterReceiveNack(const lp::Nack& nack, const FaceEndpoint& ingress,
+                   const shared_ptr<pit::Entry>& pitEntry) override;
+
+NFD_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  /** \return the nexthop of the tunnel registered by the gateway application,
+   *          or nullptr if there is none or its face is down
+   */
+  const fib::NextHop*
+  getTunnelNextHop() const;
+
+private:
+  void
+  processParams(const PartialName& parsed);
+
+  Face*
+  getBestFaceForForwarding(const Interest& interest, const Face& inFace,
+                           const fib::Entry& fibEntry, const shared_ptr<pit::Entry>& pitEntry,
+                           bool isInterestNew);
+
+  pit::OutRecord*
+  forwardInterest(const Interest& interest, Face& outFace, const fib::Entry& fibEntry,
+                  const shared_ptr<pit::Entry>& pitEntry);
+
+  void
+  sendProbe(const Interest& interest, const FaceEndpoint& ingress, const Face& faceToUse,
+            const fib::Entry& fibEntry, const shared_ptr<pit::Entry>& pitEntry);
+
+  void
+  onTimeoutOrNack(const Name& interestName, FaceId faceId, bool isNack);
+
+private:
+  asf::AsfMeasurements m_measurements;
+  asf::ProbingModule m_probing;
+  RetxSuppressionExponential m_retxSuppression;
+  size_t m_nMaxTimeouts = 3;
+
+  static const time::milliseconds RETX_SUPPRESSION_INITIAL;
+  static const time::milliseconds RETX_SUPPRESSION_MAX;
+};
+
+} // namespace fw
+} // namespace nfd
+
+#endif // GATEWAYASFSTRATEGY_HPP
@@ -149,30 +149,13 @@ GatewayTunnelStrategy::outDomainTraffic(const Interest& interest, const FaceEndp
 bool 
 GatewayTunnelStrategy::hasPrefixInDomain(const Interest& interest)
 {
-  std::vector<ndn::Name> appendList;
-  nfd::fib::Fib::const_iterator i;
-  for(i=m_forwarder.getFib().begin();i!=m_forwarder.getFib().end();i++)
-  { 
-    //compare the interest with the fib on their prefix
-    //use subname to remove the sequence
-    ndn::Name n,a;
-    n=interest.getName().getSubName(0,2);
-    a=i->getPrefix();
-    NS_LOG_INFO(YELLOW_CODE<<"Comare "<<n<<" vs "<<a<<END_CODE);
-    if(interest.getName().getSubName(0,2)==  i->getPrefix())
-    {
-      return true;
-    }
-  }
-  
-/*
-#for test print all prefix in fib 
-for (ndn::Name n: appendList)
-    std::cout << n << ' ';
-  
-std::cout <<" "<<std::endl;
-*/
-  return false;
+  //compare the interest with the fib on their prefix
+  //use a view of the first two components to remove the sequence without creating a Name
+  ViewArena arena;
+  NameView prefix = NameView(interest.getName(), arena).getPrefix(2);
+  bool isInDomain = m_forwarder.getFib().findExactMatch(prefix) != nullptr;
+  NS_LOG_INFO(YELLOW_CODE<<"Compare "<<prefix<<" with fib: "<<isInDomain<<END_CODE);
+  return isInDomain;
 }
 
 
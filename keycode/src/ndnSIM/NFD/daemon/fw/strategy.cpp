@@ -334,7 +334,7 @@ Strategy::lookupFib(const pit::Entry& pitEntry) const
 
   const Interest& interest = pitEntry.getInterest();
   // has forwarding hint?
-  if (interest.getForwardingHint().empty()) {
+  if (!interest.hasForwardingHint()) {
     // FIB lookup with Interest name
     const fib::Entry& fibEntry = fib.findLongestPrefixMatch(pitEntry);
     NFD_LOG_TRACE("lookupFib noForwardingHint found=" << fibEntry.getPrefix());
@@ -0,0 +1,237 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2021,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "bloom-dead-nonce-list.hpp"
+#include "common/global.hpp"
+#include "common/logger.hpp"
+
+#include <cmath>
+
+namespace nfd {
+
+NFD_LOG_INIT(BloomDeadNonceList);
+
+const double BloomDeadNonceList::DEFAULT_FALSE_POSITIVE_RATE;
+const size_t BloomDeadNonceList::Slice::BLOCK_WORDS;
+const size_t BloomDeadNonceList::Slice::BLOCK_BITS;
+const size_t BloomDeadNonceList::SLICE_COUNT;
+const size_t BloomDeadNonceList::INITIAL_CAPACITY;
+const size_t BloomDeadNonceList::MIN_CAPACITY;
+const size_t BloomDeadNonceList::MAX_CAPACITY;
+const double BloomDeadNonceList::CAPACITY_UP;
+const double BloomDeadNonceList::BLOCKED_OVERHEAD;
+
+BloomDeadNonceList::Slice::Slice(size_t capacity, double bitsPerEntry, size_t nHashes)
+  : m_nBlocks(std::max<size_t>(1, std::ceil(capacity * bitsPerEntry / BLOCK_BITS)))
+  , m_nHashes(nHashes)
+  , m_capacity(capacity)
+{
+  static_assert(BLOCK_BITS == 512, "forEachBit draws 9-bit positions");
+  m_bits.resize(m_nBlocks * BLOCK_WORDS);
+}
+
+/** \brief Derive a new 64-bit hash from \p x (MurmurHash3 finalizer)
+ */
+static uint64_t
+remix(uint64_t x)
+{
+  x ^= x >> 33;
+  x *= 0xff51afd7ed558ccdULL;
+  x ^= x >> 33;
+  x *= 0xc4ceb9fe1a85ec53ULL;
+  x ^= x >> 33;
+  return x;
+}
+
+template<typename F>
+static bool
+forEachBit(uint64_t entry, size_t nHashes, const F& f)
+{
+  // Bit positions within a block are drawn from fresh hashes, 9 bits at a time.
+  // Double hashing (h1 + i*h2) is not usable here: within a 512-bit block the probe
+  // sequences of different entries overlap too often, inflating false positives.
+  constexpr size_t POSITIONS_PER_HASH = 64 / 9;
+  uint64_t seed = entry;
+  uint64_t h = 0;
+  for (size_t i = 0; i < nHashes; ++i, h >>= 9) {
+    if (i % POSITIONS_PER_HASH == 0) {
+      h = seed = remix(seed + 0x9e3779b97f4a7c15ULL);
+    }
+    if (!f(h % 512)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+size_t
+BloomDeadNonceList::Slice::getBlockOffset(Entry entry) const
+{
+  // entry is a CityHash value, so its upper half is uniformly distributed
+  return ((entry >> 32) * m_nBlocks >> 32) * BLOCK_WORDS;
+}
+
+bool
+BloomDeadNonceList::Slice::contains(Entry entry) const
+{
+  const uint64_t* block = &m_bits[getBlockOffset(entry)];
+  return forEachBit(entry, m_nHashes, [block] (size_t bit) {
+    return (block[bit / 64] & (uint64_t(1) << (bit % 64))) != 0;
+  });
+}
+
+void
+BloomDeadNonceList::Slice::insert(Entry entry)
+{
+  uint64_t* block = &m_bits[getBlockOffset(entry)];
+  forEachBit(entry, m_nHashes, [block] (size_t bit) {
+    block[bit / 64] |= uint64_t(1) << (bit % 64);
+    return true;
+  });
+  ++m_count;
+}
+
+double
+BloomDeadNonceList::Slice::getFalsePositiveRate() const
+{
+  double nBits = static_cast<double>(m_nBlocks * BLOCK_BITS);
+  return std::pow(1.0 - std::exp(-static_cast<double>(m_nHashes * m_count) / nBits), m_nHashes);
+}
+
+BloomDeadNonceList::BloomDeadNonceList(time::nanoseconds lifetime, double fpRate)
+  : DeadNonceListBase(lifetime)
+  , m_rotateInterval((m_lifetime + time::nanoseconds(SLICE_COUNT - 1)) / SLICE_COUNT)
+{
+  if (!(fpRate > 0.0 && fpRate < 1.0)) {
+    NDN_THROW(std::invalid_argument("fpRate must be between 0 and 1"));
+  }
+
+  // up to SLICE_COUNT + 1 slices are probed on each lookup
+  double sliceFpRate = fpRate / (SLICE_COUNT + 1);
+  double optimalBitsPerEntry = -std::log(sliceFpRate) / (std::log(2.0) * std::log(2.0));
+  m_nHashes = std::max<size_t>(1, std::lround(optimalBitsPerEntry * std::log(2.0)));
+  m_bitsPerEntry = optimalBitsPerEntry * BLOCKED_OVERHEAD;
+
+  openSlice(INITIAL_CAPACITY);
+  m_rotateEvent = getScheduler().scheduleCoarse(m_rotateInterval, [this] { rotate(); });
+
+  static_assert(INITIAL_CAPACITY >= MIN_CAPACITY, "INITIAL_CAPACITY is too small");
+  static_assert(INITIAL_CAPACITY <= MAX_CAPACITY, "INITIAL_CAPACITY is too large");
+  static_assert(SLICE_COUNT >= 1, "SLICE_COUNT must be at least 1");
+  BOOST_ASSERT_MSG(CAPACITY_UP > 1.0, "CAPACITY_UP must leave headroom");
+}
+
+bool
+BloomDeadNonceList::has(const Name& name, Interest::Nonce nonce) const
+{
+  Entry entry = makeEntry(name, nonce);
+  // newest first: loops are most likely to be detected shortly after the nonce died
+  return std::any_of(m_slices.rbegin(), m_slices.rend(),
+                     [entry] (const Slice& slice) { return slice.contains(entry); });
+}
+
+void
+BloomDeadNonceList::add(const Name& name, Interest::Nonce nonce)
+{
+  Entry entry = makeEntry(name, nonce);
+  Slice& current = m_slices.back();
+  if (current.contains(entry)) {
+    // already retained at least as long as a new insertion would be
+    NFD_LOG_TRACE("adding duplicate " << name << " nonce=" << nonce);
+    return;
+  }
+
+  NFD_LOG_TRACE("adding " << name << " nonce=" << nonce);
+  current.insert(entry);
+  ++m_intervalCount;
+
+  if (current.isFull()) {
+    size_t capacity = std::min(MAX_CAPACITY, current.getCapacity() * 2);
+    NFD_LOG_DEBUG("slice full, opening overflow slice capacity=" << capacity);
+    openSlice(capacity);
+  }
+}
+
+size_t
+BloomDeadNonceList::size() const
+{
+  size_t n = 0;
+  for (const auto& slice : m_slices) {
+    n += slice.size();
+  }
+  return n;
+}
+
+double
+BloomDeadNonceList::getFalsePositiveRate() const
+{
+  double pNegative = 1.0;
+  for (const auto& slice : m_slices) {
+    pNegative *= 1.0 - slice.getFalsePositiveRate();
+  }
+  return 1.0 - pNegative;
+}
+
+size_t
+BloomDeadNonceList::getMemoryUsage() const
+{
+  size_t n = 0;
+  for (const auto& slice : m_slices) {
+    n += slice.getMemoryUsage();
+  }
+  return n;
+}
+
+void
+BloomDeadNonceList::openSlice(size_t capacity)
+{
+  m_slices.emplace_back(capacity, m_bitsPerEntry, m_nHashes);
+  m_slices.back().interval = m_interval;
+}
+
+void
+BloomDeadNonceList::rotate()
+{
+  ++m_interval;
+
+  // a slice of interval i holds entries added no later than the start of interval i+1,
+  // so it can be dropped SLICE_COUNT intervals (>= lifetime) after that
+  while (!m_slices.empty() && m_slices.front().interval + SLICE_COUNT + 1 <= m_interval) {
+    m_slices.pop_front();
+  }
+
+  size_t capacity = static_cast<size_t>(m_intervalCount * CAPACITY_UP);
+  capacity = std::min(MAX_CAPACITY, std::max(MIN_CAPACITY, capacity));
+  NFD_LOG_TRACE("rotate interval=" << m_interval << " added=" << m_intervalCount
+                << " slices=" << m_slices.size() << " capacity=" << capacity);
+
+  m_intervalCount = 0;
+  openSlice(capacity);
+
+  m_rotateEvent = getScheduler().scheduleCoarse(m_rotateInterval, [this] { rotate(); });
+}
+
+} // namespace nfd
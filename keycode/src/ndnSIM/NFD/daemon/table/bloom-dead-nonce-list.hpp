@@ -0,0 +1,200 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2021,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef NFD_DAEMON_TABLE_BLOOM_DEAD_NONCE_LIST_HPP
+#define NFD_DAEMON_TABLE_BLOOM_DEAD_NONCE_LIST_HPP
+
+#include "dead-nonce-list.hpp"
+
+#include <deque>
+
+namespace nfd {
+
+/**
+ * \brief Dead Nonce List backed by a ring of time-sliced Bloom filters.
+ *
+ * Instead of storing each 64-bit name+nonce hash in a hash table (several dozen bytes per
+ * entry including container overhead), entries are inserted into a Bloom filter that covers
+ * one slice of the lifetime. Every lifetime/#SLICE_COUNT a new slice is opened, and a slice is
+ * dropped as a whole once every entry in it is at least lifetime old. This costs a few bytes
+ * per entry, and each lookup touches one cache line per live slice.
+ *
+ * Each slice is sized for the number of entries inserted during the previous interval,
+ * so that memory follows the Interest rate. If a slice fills up before the interval ends,
+ * an additional slice is opened so that the false positive probability stays bounded.
+ *
+ * Entries are retained for at least lifetime and at most lifetime * (1 + 1/#SLICE_COUNT).
+ * Like DeadNonceList, false positives are possible but recoverable by retransmission;
+ * their probability is chosen at construction time.
+ */
+class BloomDeadNonceList final : public DeadNonceListBase
+{
+public:
+  /**
+   * \brief Constructs the Dead Nonce List
+   * \param lifetime expected lifetime of each nonce, must be no less than #MIN_LIFETIME
+   * \param fpRate target probability that has() returns true for a name+nonce that was
+   *        never added, must be in the (0,1) range
+   * \throw std::invalid_argument if lifetime is less than #MIN_LIFETIME or fpRate is invalid
+   */
+  explicit
+  BloomDeadNonceList(time::nanoseconds lifetime = DEFAULT_LIFETIME,
+                     double fpRate = DEFAULT_FALSE_POSITIVE_RATE);
+
+  bool
+  has(const Name& name, Interest::Nonce nonce) const final;
+
+  void
+  add(const Name& name, Interest::Nonce nonce) final;
+
+  /**
+   * \brief Returns the number of stored nonces
+   * \note A nonce added again after the slice holding it has closed is counted twice.
+   */
+  size_t
+  size() const final;
+
+  /**
+   * \brief Returns the estimated probability of a false positive given the current fill
+   * \note The estimate assumes evenly loaded blocks and is therefore optimistic.
+   */
+  double
+  getFalsePositiveRate() const;
+
+  /**
+   * \brief Returns the number of bytes used by the filters
+   */
+  size_t
+  getMemoryUsage() const;
+
+public:
+  /// Default target false positive probability
+  static constexpr double DEFAULT_FALSE_POSITIVE_RATE = 1e-4;
+
+private:
+  /** \brief A blocked Bloom filter
+   *
+   *  All bits of an entry are located in one 512-bit block, so that a lookup
+   *  costs a single cache miss.
+   */
+  class Slice
+  {
+  public:
+    Slice(size_t capacity, double bitsPerEntry, size_t nHashes);
+
+    bool
+    contains(Entry entry) const;
+
+    void
+    insert(Entry entry);
+
+    bool
+    isFull() const
+    {
+      return m_count >= m_capacity;
+    }
+
+    size_t
+    size() const
+    {
+      return m_count;
+    }
+
+    size_t
+    getCapacity() const
+    {
+      return m_capacity;
+    }
+
+    size_t
+    getMemoryUsage() const
+    {
+      return m_bits.size() * sizeof(uint64_t);
+    }
+
+    double
+    getFalsePositiveRate() const;
+
+  public:
+    /// number of the interval during which the last entry may have been inserted
+    uint64_t interval = 0;
+
+  private:
+    size_t
+    getBlockOffset(Entry entry) const;
+
+  private:
+    static constexpr size_t BLOCK_WORDS = 8;
+    static constexpr size_t BLOCK_BITS = BLOCK_WORDS * 64;
+
+    std::vector<uint64_t> m_bits;
+    size_t m_nBlocks;
+    size_t m_nHashes;
+    size_t m_capacity;
+    size_t m_count = 0;
+  };
+
+  /** \brief Open a new slice that can hold \p capacity entries
+   */
+  void
+  openSlice(size_t capacity);
+
+NFD_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  /** \brief Close the current interval and drop slices that are older than lifetime
+   */
+  void
+  rotate();
+
+  /// Number of intervals in a lifetime
+  static constexpr size_t SLICE_COUNT = 5;
+
+  static constexpr size_t INITIAL_CAPACITY = 1 << 12;
+  static constexpr size_t MIN_CAPACITY = 1 << 8;
+  static constexpr size_t MAX_CAPACITY = 1 << 24;
+
+  /// Headroom applied to the previous interval's count when sizing a slice
+  static constexpr double CAPACITY_UP = 1.2;
+
+  /** \brief Extra bits per entry to compensate for uneven load across blocks
+   *
+   *  A blocked Bloom filter sized by the textbook formula has about five times the target
+   *  false positive probability when full; 30% more bits bring it back under the target.
+   */
+  static constexpr double BLOCKED_OVERHEAD = 1.3;
+
+  const time::nanoseconds m_rotateInterval;
+  double m_bitsPerEntry;
+  size_t m_nHashes;
+
+  std::deque<Slice> m_slices; ///< oldest slice at the front, current slice at the back
+  uint64_t m_interval = 0;
+  size_t m_intervalCount = 0; ///< entries inserted during the current interval
+  scheduler::ScopedEventId m_rotateEvent;
+};
+
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_BLOOM_DEAD_NONCE_LIST_HPP
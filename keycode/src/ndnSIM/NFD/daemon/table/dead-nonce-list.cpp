@@ -32,8 +32,8 @@ namespace nfd {
 
 NFD_LOG_INIT(DeadNonceList);
 
-const time::nanoseconds DeadNonceList::DEFAULT_LIFETIME;
-const time::nanoseconds DeadNonceList::MIN_LIFETIME;
+const time::nanoseconds DeadNonceListBase::DEFAULT_LIFETIME;
+const time::nanoseconds DeadNonceListBase::MIN_LIFETIME;
 const size_t DeadNonceList::INITIAL_CAPACITY;
 const size_t DeadNonceList::MIN_CAPACITY;
 const size_t DeadNonceList::MAX_CAPACITY;
@@ -43,24 +43,39 @@ const double DeadNonceList::CAPACITY_UP;
 const double DeadNonceList::CAPACITY_DOWN;
 const size_t DeadNonceList::EVICT_LIMIT;
 
-DeadNonceList::DeadNonceList(time::nanoseconds lifetime)
+DeadNonceListBase::DeadNonceListBase(time::nanoseconds lifetime)
   : m_lifetime(lifetime)
-  , m_capacity(INITIAL_CAPACITY)
-  , m_markInterval(m_lifetime / EXPECTED_MARK_COUNT)
-  , m_adjustCapacityInterval(m_lifetime)
 {
   if (m_lifetime < MIN_LIFETIME) {
     NDN_THROW(std::invalid_argument("lifetime is less than MIN_LIFETIME"));
   }
 
+  BOOST_ASSERT_MSG(DEFAULT_LIFETIME >= MIN_LIFETIME, "DEFAULT_LIFETIME is too small");
+}
+
+DeadNonceListBase::Entry
+DeadNonceListBase::makeEntry(const Name& name, Interest::Nonce nonce)
+{
+  const auto& nameWire = name.wireEncode();
+  uint32_t n;
+  std::memcpy(&n, nonce.data(), sizeof(n));
+  return CityHash64WithSeed(reinterpret_cast<const char*>(nameWire.wire()), nameWire.size(), n);
+}
+
+DeadNonceList::DeadNonceList(time::nanoseconds lifetime)
+  : DeadNonceListBase(lifetime)
+  , m_capacity(INITIAL_CAPACITY)
+  , m_markInterval(m_lifetime / EXPECTED_MARK_COUNT)
+  , m_adjustCapacityInterval(m_lifetime)
+{
   for (size_t i = 0; i < EXPECTED_MARK_COUNT; ++i) {
     m_queue.push_back(MARK);
   }
 
-  m_markEvent = getScheduler().schedule(m_markInterval, [this] { mark(); });
-  m_adjustCapacityEvent = getScheduler().schedule(m_adjustCapacityInterval, [this] { adjustCapacity(); });
+  m_markEvent = getScheduler().scheduleCoarse(m_markInterval, [this] { mark(); });
+  m_adjustCapacityEvent = getScheduler().scheduleCoarse(m_adjustCapacityInterval,
+                                                        [this] { adjustCapacity(); });
 
-  BOOST_ASSERT_MSG(DEFAULT_LIFETIME >= MIN_LIFETIME, "DEFAULT_LIFETIME is too small");
   static_assert(INITIAL_CAPACITY >= MIN_CAPACITY, "INITIAL_CAPACITY is too small");
   static_assert(INITIAL_CAPACITY <= MAX_CAPACITY, "INITIAL_CAPACITY is too large");
   BOOST_ASSERT_MSG(static_cast<size_t>(MIN_CAPACITY * CAPACITY_UP) > MIN_CAPACITY,
@@ -81,14 +96,14 @@ DeadNonceList::size() const
 bool
 DeadNonceList::has(const Name& name, Interest::Nonce nonce) const
 {
-  Entry entry = DeadNonceList::makeEntry(name, nonce);
+  Entry entry = makeEntry(name, nonce);
   return m_ht.find(entry) != m_ht.end();
 }
 
 void
 DeadNonceList::add(const Name& name, Interest::Nonce nonce)
 {
-  Entry entry = DeadNonceList::makeEntry(name, nonce);
+  Entry entry = makeEntry(name, nonce);
   const auto iter = m_ht.find(entry);
   bool isDuplicate = iter != m_ht.end();
 
@@ -103,15 +118,6 @@ DeadNonceList::add(const Name& name, Interest::Nonce nonce)
   }
 }
 
-DeadNonceList::Entry
-DeadNonceList::makeEntry(const Name& name, Interest::Nonce nonce)
-{
-  const auto& nameWire = name.wireEncode();
-  uint32_t n;
-  std::memcpy(&n, nonce.data(), sizeof(n));
-  return CityHash64WithSeed(reinterpret_cast<const char*>(nameWire.wire()), nameWire.size(), n);
-}
-
 size_t
 DeadNonceList::countMarks() const
 {
@@ -127,7 +133,7 @@ DeadNonceList::mark()
 
   NFD_LOG_TRACE("mark nMarks=" << nMarks);
 
-  m_markEvent = getScheduler().schedule(m_markInterval, [this] { mark(); });
+  m_markEvent = getScheduler().scheduleCoarse(m_markInterval, [this] { mark(); });
 }
 
 void
@@ -151,7 +157,8 @@ DeadNonceList::adjustCapacity()
   m_actualMarkCounts.clear();
   evictEntries();
 
-  m_adjustCapacityEvent = getScheduler().schedule(m_adjustCapacityInterval, [this] { adjustCapacity(); });
+  m_adjustCapacityEvent = getScheduler().scheduleCoarse(m_adjustCapacityInterval,
+                                                        [this] { adjustCapacity(); });
 }
 
 void
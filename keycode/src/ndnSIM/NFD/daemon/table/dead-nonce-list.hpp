@@ -41,6 +41,72 @@ namespace nfd {
  * When a Nonce is erased (dead) from a PIT entry, the Nonce and the Interest Name are added to
  * the Dead Nonce List and kept for a duration in which most loops are expected to have occured.
  *
+ * This is the interface used by the forwarder. Implementations differ in how they trade
+ * memory usage against the probability of false positives.
+ *
+ * \sa DeadNonceList, BloomDeadNonceList
+ */
+class DeadNonceListBase : noncopyable
+{
+public:
+  virtual
+  ~DeadNonceListBase() = default;
+
+  /**
+   * \brief Determines if name+nonce is in the list
+   * \return true if name+nonce exists, false otherwise
+   */
+  virtual bool
+  has(const Name& name, Interest::Nonce nonce) const = 0;
+
+  /**
+   * \brief Adds name+nonce to the list
+   */
+  virtual void
+  add(const Name& name, Interest::Nonce nonce) = 0;
+
+  /**
+   * \brief Returns the number of stored nonces
+   */
+  virtual size_t
+  size() const = 0;
+
+  /**
+   * \brief Returns the expected nonce lifetime
+   */
+  time::nanoseconds
+  getLifetime() const
+  {
+    return m_lifetime;
+  }
+
+public:
+  /// Default entry lifetime
+  static constexpr time::nanoseconds DEFAULT_LIFETIME = 6_s;
+  /// Minimum entry lifetime
+  static constexpr time::nanoseconds MIN_LIFETIME = 50_ms;
+
+protected:
+  /**
+   * \throw std::invalid_argument if lifetime is less than #MIN_LIFETIME
+   */
+  explicit
+  DeadNonceListBase(time::nanoseconds lifetime);
+
+  using Entry = uint64_t;
+
+  /** \brief Hash name+nonce into a 64-bit entry
+   */
+  static Entry
+  makeEntry(const Name& name, Interest::Nonce nonce);
+
+protected:
+  const time::nanoseconds m_lifetime;
+};
+
+/**
+ * \brief Dead Nonce List backed by a hash table of 64-bit hashes.
+ *
  * To reduce memory usage, the Interest Name and Nonce are stored as a 64-bit hash.
  * The probability of false positives (a non-looping Interest considered as looping) is small
  * and a collision is recoverable when the consumer retransmits with a different Nonce.
@@ -51,7 +117,7 @@ namespace nfd {
  * The number of MARKs stored in the container reflects the lifetime of the entries,
  * because MARKs are inserted at fixed intervals.
  */
-class DeadNonceList : noncopyable
+class DeadNonceList final : public DeadNonceListBase
 {
 public:
   /**
@@ -64,41 +130,20 @@ public:
   explicit
   DeadNonceList(time::nanoseconds lifetime = DEFAULT_LIFETIME);
 
-  /**
-   * \brief Determines if name+nonce is in the list
-   * \return true if name+nonce exists, false otherwise
-   */
   bool
-  has(const Name& name, Interest::Nonce nonce) const;
+  has(const Name& name, Interest::Nonce nonce) const final;
 
-  /**
-   * \brief Adds name+nonce to the list
-   */
   void
-  add(const Name& name, Interest::Nonce nonce);
+  add(const Name& name, Interest::Nonce nonce) final;
 
   /**
    * \brief Returns the number of stored nonces
    * \note The return value does not contain non-Nonce entries in the index, if any.
    */
   size_t
-  size() const;
-
-  /**
-   * \brief Returns the expected nonce lifetime
-   */
-  time::nanoseconds
-  getLifetime() const
-  {
-    return m_lifetime;
-  }
+  size() const final;
 
 private:
-  using Entry = uint64_t;
-
-  static Entry
-  makeEntry(const Name& name, Interest::Nonce nonce);
-
   /** \brief Return the number of MARKs in the index
    */
   size_t
@@ -122,15 +167,7 @@ private:
   void
   evictEntries();
 
-public:
-  /// Default entry lifetime
-  static constexpr time::nanoseconds DEFAULT_LIFETIME = 6_s;
-  /// Minimum entry lifetime
-  static constexpr time::nanoseconds MIN_LIFETIME = 50_ms;
-
 private:
-  const time::nanoseconds m_lifetime;
-
   struct Queue {};
   struct Hashtable {};
   using Container = boost::multi_index_container<
@@ -52,17 +52,22 @@ std::pair<NextHopList::iterator, bool>
 Entry::addOrUpdateNextHop(Face& face, uint64_t cost)
 {
   auto it = this->findNextHop(face);
-  bool isNew = false;
-  if (it == m_nextHops.end()) {
-    m_nextHops.emplace_back(face);
-    it = std::prev(m_nextHops.end());
-    isNew = true;
+  bool isNew = it == m_nextHops.end();
+  if (!isNew) {
+    if (it->getCost() == cost) {
+      return {it, false};
+    }
+    m_nextHops.erase(it);
   }
 
+  // keep the list sorted by cost; among equal costs, the earliest added comes first
+  auto pos = std::upper_bound(m_nextHops.begin(), m_nextHops.end(), cost,
+                              [] (uint64_t c, const NextHop& nh) { return c < nh.getCost(); });
+  it = m_nextHops.emplace(pos, face);
   it->setCost(cost);
-  this->sortNextHops();
+  this->updateFirstUsableNextHop();
 
-  return std::make_pair(it, isNew);
+  return {it, isNew};
 }
 
 bool
@@ -71,16 +76,19 @@ Entry::removeNextHop(const Face& face)
   auto it = this->findNextHop(face);
   if (it != m_nextHops.end()) {
     m_nextHops.erase(it);
+    this->updateFirstUsableNextHop();
     return true;
   }
   return false;
 }
 
 void
-Entry::sortNextHops()
+Entry::updateFirstUsableNextHop()
 {
-  std::sort(m_nextHops.begin(), m_nextHops.end(),
-            [] (const NextHop& a, const NextHop& b) { return a.getCost() < b.getCost(); });
+  auto it = std::find_if(m_nextHops.begin(), m_nextHops.end(), [] (const NextHop& nh) {
+    return nh.getFace().getState() == face::FaceState::UP;
+  });
+  m_firstUsableNextHop = std::distance(m_nextHops.begin(), it);
 }
 
 } // namespace fib
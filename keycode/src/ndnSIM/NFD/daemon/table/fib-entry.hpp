@@ -28,6 +28,8 @@
 
 #include "fib-nexthop.hpp"
 
+#include <boost/container/small_vector.hpp>
+
 namespace nfd {
 
 namespace name_tree {
@@ -39,14 +41,18 @@ namespace fib {
 class Fib;
 
 /** \class nfd::fib::NextHopList
- *  \brief Represents a collection of nexthops.
+ *  \brief Represents a collection of nexthops, sorted by increasing cost.
  *
  *  This type has the following member functions:
  *  - `iterator<NextHop> begin()`
  *  - `iterator<NextHop> end()`
  *  - `size_t size()`
+ *
+ *  Up to NEXTHOP_INLINE_CAPACITY nexthops are stored inside the FIB entry without
+ *  a separate heap allocation; the whole list then fits in one cache line.
  */
-using NextHopList = std::vector<NextHop>;
+constexpr size_t NEXTHOP_INLINE_CAPACITY = 4;
+using NextHopList = boost::container::small_vector<NextHop, NEXTHOP_INLINE_CAPACITY>;
 
 /** \brief represents a FIB entry
  */
@@ -81,6 +87,17 @@ public:
   bool
   hasNextHop(const Face& face) const;
 
+  /** \return the lowest-cost NextHop whose face is UP, or nullptr if there is none
+   *
+   *  The result is precomputed whenever the nexthops change or one of their faces changes
+   *  state, so that strategies can pick the usual best route without scanning the list.
+   */
+  const NextHop*
+  getFirstUsableNextHop() const
+  {
+    return m_firstUsableNextHop < m_nextHops.size() ? &m_nextHops[m_firstUsableNextHop] : nullptr;
+  }
+
 private:
   /** \brief adds a NextHop record to the entry
    *
@@ -104,14 +121,15 @@ private:
   NextHopList::iterator
   findNextHop(const Face& face);
 
-  /** \brief sorts the nexthop list
+  /** \brief recomputes the result of getFirstUsableNextHop()
    */
   void
-  sortNextHops();
+  updateFirstUsableNextHop();
 
 private:
   Name m_prefix;
   NextHopList m_nextHops;
+  size_t m_firstUsableNextHop = 0;
 
   name_tree::Entry* m_nameTreeEntry = nullptr;
 
@@ -64,6 +64,12 @@ Fib::findLongestPrefixMatch(const Name& prefix) const
   return this->findLongestPrefixMatchImpl(prefix);
 }
 
+const Entry&
+Fib::findLongestPrefixMatch(const NameView& prefix) const
+{
+  return this->findLongestPrefixMatchImpl(prefix);
+}
+
 const Entry&
 Fib::findLongestPrefixMatch(const pit::Entry& pitEntry) const
 {
@@ -86,6 +92,16 @@ Fib::findExactMatch(const Name& prefix)
   return nullptr;
 }
 
+Entry*
+Fib::findExactMatch(const NameView& prefix)
+{
+  name_tree::Entry* nte = m_nameTree.findExactMatch(prefix);
+  if (nte != nullptr)
+    return nte->getFibEntry();
+
+  return nullptr;
+}
+
 std::pair<Entry*, bool>
 Fib::insert(const Name& prefix)
 {
@@ -105,6 +121,9 @@ Fib::erase(name_tree::Entry* nte, bool canDeleteNte)
 {
   BOOST_ASSERT(nte != nullptr);
 
+  for (const NextHop& nexthop : nte->getFibEntry()->getNextHops()) {
+    this->untrackNextHop(*nte->getFibEntry(), nexthop.getFace());
+  }
   nte->setFibEntry(nullptr);
   if (canDeleteNte) {
     m_nameTree.eraseIfEmpty(nte);
@@ -139,8 +158,10 @@ Fib::addOrUpdateNextHop(Entry& entry, Face& face, uint64_t cost)
   bool isNew;
   std::tie(it, isNew) = entry.addOrUpdateNextHop(face, cost);
 
-  if (isNew)
+  if (isNew) {
+    m_entriesByFace[&face].insert(&entry);
     this->afterNewNextHop(entry.getPrefix(), *it);
+  }
 }
 
 Fib::RemoveNextHopResult
@@ -151,7 +172,9 @@ Fib::removeNextHop(Entry& entry, const Face& face)
   if (!isRemoved) {
     return RemoveNextHopResult::NO_SUCH_NEXTHOP;
   }
-  else if (!entry.hasNextHops()) {
+
+  this->untrackNextHop(entry, face);
+  if (!entry.hasNextHops()) {
     name_tree::Entry* nte = m_nameTree.getEntry(entry);
     this->erase(nte, false);
     return RemoveNextHopResult::FIB_ENTRY_REMOVED;
@@ -161,6 +184,29 @@ Fib::removeNextHop(Entry& entry, const Face& face)
   }
 }
 
+void
+Fib::untrackNextHop(Entry& entry, const Face& face)
+{
+  auto it = m_entriesByFace.find(&face);
+  BOOST_ASSERT(it != m_entriesByFace.end());
+  it->second.erase(&entry);
+  if (it->second.empty()) {
+    m_entriesByFace.erase(it);
+  }
+}
+
+void
+Fib::updateUsableNextHops(const Face& face)
+{
+  auto it = m_entriesByFace.find(&face);
+  if (it == m_entriesByFace.end()) {
+    return;
+  }
+  for (Entry* entry : it->second) {
+    entry->updateFirstUsableNextHop();
+  }
+}
+
 Fib::Range
 Fib::getRange() const
 {
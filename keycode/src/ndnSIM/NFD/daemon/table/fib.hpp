@@ -62,6 +62,11 @@ public: // lookup
   const Entry&
   findLongestPrefixMatch(const Name& prefix) const;
 
+  /** \brief Performs a longest prefix match without creating a Name
+   */
+  const Entry&
+  findLongestPrefixMatch(const NameView& prefix) const;
+
   /** \brief Performs a longest prefix match
    *
    *  This is equivalent to `findLongestPrefixMatch(pitEntry.getName())`
@@ -81,6 +86,11 @@ public: // lookup
   Entry*
   findExactMatch(const Name& prefix);
 
+  /** \brief Performs an exact match lookup without creating a Name
+   */
+  Entry*
+  findExactMatch(const NameView& prefix);
+
 public: // mutation
   /** \brief Maximum number of components in a FIB entry prefix.
    */
@@ -121,6 +131,13 @@ public: // mutation
   RemoveNextHopResult
   removeNextHop(Entry& entry, const Face& face);
 
+  /** \brief Recompute Entry::getFirstUsableNextHop() of entries that have a NextHop for \p face
+   *
+   *  This should be invoked whenever \p face changes state.
+   */
+  void
+  updateUsableNextHops(const Face& face);
+
 public: // enumeration
   typedef boost::transformed_range<name_tree::GetTableEntry<Entry>, const name_tree::Range> Range;
   typedef boost::range_iterator<Range>::type const_iterator;
@@ -160,6 +177,11 @@ private:
   void
   erase(name_tree::Entry* nte, bool canDeleteNte = true);
 
+  /** \brief Forget that \p entry has a NextHop for \p face
+   */
+  void
+  untrackNextHop(Entry& entry, const Face& face);
+
   Range
   getRange() const;
 
@@ -167,6 +189,12 @@ private:
   NameTree& m_nameTree;
   size_t m_nItems = 0;
 
+  /** \brief FIB entries that have a NextHop for each face
+   *
+   *  A face state change then only revisits the entries routing through that face.
+   */
+  std::unordered_map<const Face*, std::unordered_set<Entry*>> m_entriesByFace;
+
   /** \brief The empty FIB entry.
    *
    *  This entry has no nexthops.
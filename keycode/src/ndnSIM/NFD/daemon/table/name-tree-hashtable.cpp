@@ -89,6 +89,35 @@ computeHashes(const Name& name, size_t prefixLen)
   return seq;
 }
 
+HashValue
+computeHash(const NameView& name, size_t prefixLen)
+{
+  HashValue h = 0;
+  for (size_t i = 0, last = std::min(prefixLen, name.size()); i < last; ++i) {
+    auto comp = name.getComponentWire(i);
+    h ^= HashFunc::compute(comp.data(), comp.size());
+  }
+  return h;
+}
+
+HashSequence
+computeHashes(const NameView& name, size_t prefixLen)
+{
+  size_t last = std::min(prefixLen, name.size());
+  HashSequence seq;
+  seq.reserve(last + 1);
+
+  HashValue h = 0;
+  seq.push_back(h);
+
+  for (size_t i = 0; i < last; ++i) {
+    auto comp = name.getComponentWire(i);
+    h ^= HashFunc::compute(comp.data(), comp.size());
+    seq.push_back(h);
+  }
+  return seq;
+}
+
 Node::Node(HashValue h, const Name& name)
   : hash(h)
   , prev(nullptr)
@@ -220,6 +249,36 @@ Hashtable::find(const Name& name, size_t prefixLen, const HashSequence& hashes)
   return const_cast<Hashtable*>(this)->findOrInsert(name, prefixLen, hashes[prefixLen], false).first;
 }
 
+const Node*
+Hashtable::findView(const NameView& name, size_t prefixLen, HashValue h) const
+{
+  size_t bucket = this->computeBucketIndex(h);
+
+  NameView prefix = name.getPrefix(prefixLen);
+  for (const Node* node = m_buckets[bucket]; node != nullptr; node = node->next) {
+    if (node->hash == h && prefix == node->entry.getName()) {
+      NFD_LOG_TRACE("found " << prefix << " hash=" << h << " bucket=" << bucket);
+      return node;
+    }
+  }
+
+  NFD_LOG_TRACE("not-found " << prefix << " hash=" << h << " bucket=" << bucket);
+  return nullptr;
+}
+
+const Node*
+Hashtable::find(const NameView& name, size_t prefixLen) const
+{
+  return this->findView(name, prefixLen, computeHash(name, prefixLen));
+}
+
+const Node*
+Hashtable::find(const NameView& name, size_t prefixLen, const HashSequence& hashes) const
+{
+  BOOST_ASSERT(hashes.at(prefixLen) == computeHash(name, prefixLen));
+  return this->findView(name, prefixLen, hashes[prefixLen]);
+}
+
 std::pair<const Node*, bool>
 Hashtable::insert(const Name& name, size_t prefixLen, const HashSequence& hashes)
 {
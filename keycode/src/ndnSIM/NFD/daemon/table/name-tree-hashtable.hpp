@@ -53,6 +53,19 @@ computeHash(const Name& name, size_t prefixLen = std::numeric_limits<size_t>::ma
 HashSequence
 computeHashes(const Name& name, size_t prefixLen = std::numeric_limits<size_t>::max());
 
+/** \brief computes hash value of \p name.getPrefix(prefixLen)
+ *
+ *  The result equals computeHash() of a Name with the same components.
+ */
+HashValue
+computeHash(const NameView& name, size_t prefixLen = std::numeric_limits<size_t>::max());
+
+/** \brief computes hash values for each prefix of \p name.getPrefix(prefixLen)
+ *  \return a hash sequence, where the i-th hash value equals computeHash(name, i)
+ */
+HashSequence
+computeHashes(const NameView& name, size_t prefixLen = std::numeric_limits<size_t>::max());
+
 /** \brief a hashtable node
  *
  *  Zero or more nodes can be added to a hashtable bucket. They are organized as
@@ -205,6 +218,19 @@ public:
   const Node*
   find(const Name& name, size_t prefixLen, const HashSequence& hashes) const;
 
+  /** \brief find node for name.getPrefix(prefixLen)
+   *  \pre name.size() > prefixLen
+   */
+  const Node*
+  find(const NameView& name, size_t prefixLen) const;
+
+  /** \brief find node for name.getPrefix(prefixLen)
+   *  \pre name.size() > prefixLen
+   *  \pre hashes == computeHashes(name)
+   */
+  const Node*
+  find(const NameView& name, size_t prefixLen, const HashSequence& hashes) const;
+
   /** \brief find or insert node for name.getPrefix(prefixLen)
    *  \pre name.size() > prefixLen
    *  \pre hashes == computeHashes(name)
@@ -232,6 +258,9 @@ private:
   std::pair<const Node*, bool>
   findOrInsert(const Name& name, size_t prefixLen, HashValue h, bool allowInsert);
 
+  const Node*
+  findView(const NameView& name, size_t prefixLen, HashValue h) const;
+
   void
   computeThresholds();
 
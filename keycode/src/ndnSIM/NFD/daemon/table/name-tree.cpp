@@ -174,6 +174,34 @@ NameTree::findLongestPrefixMatch(const Name& name, const EntrySelector& entrySel
   return nullptr;
 }
 
+Entry*
+NameTree::findExactMatch(const NameView& name, size_t prefixLen) const
+{
+  prefixLen = std::min(name.size(), prefixLen);
+  if (prefixLen > getMaxDepth()) {
+    return nullptr;
+  }
+
+  const Node* node = m_ht.find(name, prefixLen);
+  return node == nullptr ? nullptr : &node->entry;
+}
+
+Entry*
+NameTree::findLongestPrefixMatch(const NameView& name, const EntrySelector& entrySelector) const
+{
+  size_t depth = std::min(name.size(), getMaxDepth());
+  HashSequence hashes = computeHashes(name, depth);
+
+  for (ssize_t i = depth; i >= 0; --i) {
+    const Node* node = m_ht.find(name, i, hashes);
+    if (node != nullptr && entrySelector(node->entry)) {
+      return &node->entry;
+    }
+  }
+
+  return nullptr;
+}
+
 Entry*
 NameTree::findLongestPrefixMatch(const Entry& entry1, const EntrySelector& entrySelector) const
 {
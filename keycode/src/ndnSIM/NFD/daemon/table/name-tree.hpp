@@ -148,6 +148,13 @@ public: // matching
   Entry*
   findExactMatch(const Name& name, size_t prefixLen = std::numeric_limits<size_t>::max()) const;
 
+  /** \brief Exact match lookup
+   *  \return entry with \c name.getPrefix(prefixLen), or nullptr if it does not exist
+   *  \note This overload does not create a Name for \p name or its prefixes.
+   */
+  Entry*
+  findExactMatch(const NameView& name, size_t prefixLen = std::numeric_limits<size_t>::max()) const;
+
   /** \brief Longest prefix matching
    *  \return entry whose name is a prefix of \p name and passes \p entrySelector,
    *          where no other entry with a longer name satisfies those requirements;
@@ -157,6 +164,14 @@ public: // matching
   findLongestPrefixMatch(const Name& name,
                          const EntrySelector& entrySelector = AnyEntry()) const;
 
+  /** \brief Longest prefix matching
+   *  \note This overload does not create a Name for \p name or its prefixes.
+   *  \sa findLongestPrefixMatch(const Name&, const EntrySelector&)
+   */
+  Entry*
+  findLongestPrefixMatch(const NameView& name,
+                         const EntrySelector& entrySelector = AnyEntry()) const;
+
   /** \brief Equivalent to `findLongestPrefixMatch(entry.getName(), entrySelector)`
    *  \note This overload is more efficient than
    *        `findLongestPrefixMatch(const Name&, const EntrySelector&)` in common cases.
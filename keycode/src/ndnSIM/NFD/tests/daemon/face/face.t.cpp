@@ -146,6 +146,43 @@ BOOST_AUTO_TEST_CASE(LinkServiceSendReceive)
   BOOST_CHECK_EQUAL(face1->sentNacks.size(), nOutNacks);
 }
 
+BOOST_AUTO_TEST_CASE(CountersSnapshot)
+{
+  auto face1 = make_shared<DummyFace>();
+
+  auto interest = makeInterest("/Cn8Fm2sPqt");
+  auto data = makeData("/Cn8Fm2sPqt");
+  auto nack = makeNack(*makeInterest("/wd7KzNqE3a", false, nullopt, 916), lp::NackReason::NO_ROUTE);
+  // packets arriving from a transport always carry their wire encoding
+  interest->wireEncode();
+  nack.getInterest().wireEncode();
+
+  face1->receiveInterest(*interest, 0);
+  face1->receiveInterest(*interest, 0);
+  face1->receiveData(*data, 0);
+  face1->sendData(*data);
+  face1->sendNack(nack);
+
+  FaceCounters::Snapshot before = face1->getCounters().snapshot();
+  BOOST_CHECK_EQUAL(before.nInInterests, 2);
+  BOOST_CHECK_EQUAL(before.nInInterestBytes, 2 * interest->wireEncode().size());
+  BOOST_CHECK_EQUAL(before.nInData, 1);
+  BOOST_CHECK_EQUAL(before.nInDataBytes, data->wireEncode().size());
+  BOOST_CHECK_EQUAL(before.nOutData, 1);
+  BOOST_CHECK_EQUAL(before.nOutDataBytes, data->wireEncode().size());
+  BOOST_CHECK_EQUAL(before.nOutNacks, 1);
+  BOOST_CHECK_EQUAL(before.nOutNackBytes, nack.getInterest().wireEncode().size());
+  BOOST_CHECK_EQUAL(before.nOutInterests, 0);
+  BOOST_CHECK_EQUAL(before.nOutInterestBytes, 0);
+
+  // a snapshot is a copy, unaffected by subsequent traffic
+  face1->receiveInterest(*interest, 0);
+  BOOST_CHECK_EQUAL(before.nInInterests, 2);
+  BOOST_CHECK_EQUAL(face1->getCounters().snapshot().nInInterests, 3);
+  BOOST_CHECK_EQUAL(face1->getCounters().snapshot().nInInterestBytes,
+                    3 * interest->wireEncode().size());
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestFace
 BOOST_AUTO_TEST_SUITE_END() // Face
 
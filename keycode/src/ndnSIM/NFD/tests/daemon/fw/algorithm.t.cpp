@@ -202,6 +202,24 @@ BOOST_FIXTURE_TEST_CASE(GetLastOutgoing, GlobalIoTimeFixture)
   BOOST_CHECK_EQUAL(getLastOutgoing(entry), time::steady_clock::now());
 }
 
+BOOST_AUTO_TEST_CASE(IsNextHopEligible)
+{
+  auto face1 = make_shared<DummyFace>();
+  auto face2 = make_shared<DummyFace>();
+  face1->setId(1);
+  face2->setId(2);
+
+  auto interest = makeInterest("/Y4hKq3Tn");
+  auto entry = make_shared<pit::Entry>(*interest);
+
+  BOOST_CHECK_EQUAL(isNextHopEligible(*face1, *interest, fib::NextHop(*face1), entry), false);
+  BOOST_CHECK_EQUAL(isNextHopEligible(*face1, *interest, fib::NextHop(*face2), entry), true);
+
+  // the face state is left to the strategies
+  face2->setState(face::FaceState::DOWN);
+  BOOST_CHECK_EQUAL(isNextHopEligible(*face1, *interest, fib::NextHop(*face2), entry), true);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestPitAlgorithm
 BOOST_AUTO_TEST_SUITE_END() // Fw
 
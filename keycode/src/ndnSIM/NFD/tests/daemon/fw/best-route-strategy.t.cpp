@@ -141,6 +141,31 @@ BOOST_AUTO_TEST_CASE(Forward)
   // face1 cannot be used because it's gone from FIB entry
 }
 
+BOOST_AUTO_TEST_CASE(SkipDownFace)
+{
+  fib::Entry& fibEntry = *fib.insert(Name()).first;
+  fib.addOrUpdateNextHop(fibEntry, *face1, 10);
+  fib.addOrUpdateNextHop(fibEntry, *face2, 20);
+  fib.addOrUpdateNextHop(fibEntry, *face3, 30);
+
+  // the forwarder refreshes FIB entries when a face changes state
+  face1->setState(face::FaceState::DOWN);
+
+  shared_ptr<Interest> interest = makeInterest("/RCnbYsbGq");
+  shared_ptr<pit::Entry> pitEntry = pit.insert(*interest).first;
+  pitEntry->insertOrUpdateInRecord(*face4, *interest);
+  strategy.afterReceiveInterest(*interest, FaceEndpoint(*face4, 0), pitEntry);
+  BOOST_REQUIRE_EQUAL(strategy.sendInterestHistory.size(), 1);
+  BOOST_CHECK_EQUAL(strategy.sendInterestHistory.back().outFaceId, face2->getId());
+  // the cached nexthop is the downstream, the scan must not fall back to the down face
+  interest = makeInterest("/pVjRBgMX");
+  pitEntry = pit.insert(*interest).first;
+  pitEntry->insertOrUpdateInRecord(*face2, *interest);
+  strategy.afterReceiveInterest(*interest, FaceEndpoint(*face2, 0), pitEntry);
+  BOOST_REQUIRE_EQUAL(strategy.sendInterestHistory.size(), 2);
+  BOOST_CHECK_EQUAL(strategy.sendInterestHistory.back().outFaceId, face3->getId());
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestBestRouteStrategy
 BOOST_AUTO_TEST_SUITE_END() // Fw
 
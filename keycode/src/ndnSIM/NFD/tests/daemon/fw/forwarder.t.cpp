@@ -98,6 +98,36 @@ BOOST_AUTO_TEST_CASE(SimpleExchange)
   BOOST_CHECK_EQUAL(forwarder.getCounters().nUnsolicitedData, 0);
 }
 
+BOOST_AUTO_TEST_CASE(FaceSatisfactionCounters)
+{
+  auto face1 = addFace();
+  auto face2 = addFace();
+  auto face3 = addFace();
+
+  Fib& fib = forwarder.getFib();
+  fib::Entry* entry = fib.insert("/A").first;
+  fib.addOrUpdateNextHop(*entry, *face2, 0);
+
+  face1->receiveInterest(*makeInterest("/A/B"), 0);
+  face3->receiveInterest(*makeInterest("/A/C", false, 200_ms), 0);
+  this->advanceClocks(10_ms);
+  BOOST_REQUIRE_EQUAL(face2->sentInterests.size(), 2);
+
+  face2->receiveData(*makeData("/A/B"), 0);
+  this->advanceClocks(100_ms, 1_s);
+
+  BOOST_CHECK_EQUAL(face1->getCounters().nInSatisfiedInterests, 1);
+  BOOST_CHECK_EQUAL(face1->getCounters().nInUnsatisfiedInterests, 0);
+  BOOST_CHECK_EQUAL(face2->getCounters().nOutSatisfiedInterests, 1);
+  BOOST_CHECK_EQUAL(face2->getCounters().nOutUnsatisfiedInterests, 1);
+  BOOST_CHECK_EQUAL(face3->getCounters().nInSatisfiedInterests, 0);
+  BOOST_CHECK_EQUAL(face3->getCounters().nInUnsatisfiedInterests, 1);
+
+  ForwarderCounters::Snapshot counters = forwarder.getCounters().snapshot();
+  BOOST_CHECK_EQUAL(counters.nSatisfiedInterests, 1);
+  BOOST_CHECK_EQUAL(counters.nUnsatisfiedInterests, 1);
+}
+
 BOOST_AUTO_TEST_CASE(CsMatched)
 {
   auto face1 = addFace();
@@ -699,6 +729,36 @@ BOOST_AUTO_TEST_CASE(PitLeak) // Bug 3484
   BOOST_CHECK_EQUAL(pit.size(), 0);
 }
 
+BOOST_AUTO_TEST_CASE(LazyDeadNonceList)
+{
+  auto face1 = addFace();
+  auto face2 = addFace();
+
+  int nCreated = 0;
+  forwarder.setDeadNonceListFactory([&nCreated] {
+    ++nCreated;
+    return make_unique<DeadNonceList>();
+  });
+
+  Fib& fib = forwarder.getFib();
+  fib::Entry* entry = fib.insert("/A").first;
+  fib.addOrUpdateNextHop(*entry, *face2, 0);
+
+  auto interest = makeInterest("/A/1", false, 50_ms, 82101183);
+  face1->receiveInterest(*interest, 0);
+  BOOST_CHECK_EQUAL(face2->sentInterests.size(), 1);
+  BOOST_CHECK_EQUAL(nCreated, 0);
+
+  // the Nonce of the unsatisfied Interest is recorded when its PIT entry expires
+  this->advanceClocks(10_ms, 100_ms);
+  BOOST_CHECK_EQUAL(nCreated, 1);
+  BOOST_CHECK(forwarder.getDeadNonceList().has(interest->getName(), interest->getNonce()));
+  BOOST_CHECK_EQUAL(nCreated, 1);
+
+  face1->receiveInterest(*interest, 0);
+  BOOST_CHECK_EQUAL(face2->sentInterests.size(), 1);
+}
+
 BOOST_AUTO_TEST_CASE(UnsolicitedData)
 {
   auto face1 = addFace();
@@ -0,0 +1,189 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2021,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "fw/gatewayAsfStrategy.hpp"
+
+#include "tests/test-common.hpp"
+#include "tests/daemon/global-io-fixture.hpp"
+#include "tests/daemon/face/dummy-face.hpp"
+#include "choose-strategy.hpp"
+#include "strategy-tester.hpp"
+
+namespace nfd {
+namespace fw {
+namespace tests {
+
+using GatewayAsfStrategyTester = StrategyTester<GatewayAsfStrategy>;
+NFD_REGISTER_STRATEGY(GatewayAsfStrategyTester);
+
+class GatewayAsfStrategyFixture : public GlobalIoTimeFixture
+{
+protected:
+  GatewayAsfStrategyFixture()
+    : strategy(choose<GatewayAsfStrategyTester>(forwarder, "/",
+                                                 Name(GatewayAsfStrategyTester::getStrategyName())
+                                                   .append("probing-interval~1000")))
+  {
+    faceTable.add(consumer);
+    faceTable.add(domain);
+    faceTable.add(tunnel);
+
+    fib.addOrUpdateNextHop(*fib.insert("/domain1/src1").first, *domain, 10);
+    fib.addOrUpdateNextHop(*fib.insert("/tunnel").first, *tunnel, 0);
+  }
+
+  void
+  registerTunnel()
+  {
+    auto interest = makeInterest("/tunnel/tunnelRegisty");
+    auto pitEntry = pit.insert(*interest).first;
+    pitEntry->insertOrUpdateInRecord(*tunnel, *interest);
+    strategy.afterReceiveInterest(*interest, FaceEndpoint(*tunnel, 0), pitEntry);
+  }
+
+  /** \brief forward a new Interest from \p ingress
+   *  \return faces the Interest and its probe (if any) were sent to
+   */
+  std::vector<FaceId>
+  forward(const Name& name, Face& ingress, shared_ptr<pit::Entry>& pitEntry)
+  {
+    auto interest = makeInterest(name);
+    pitEntry = pit.insert(*interest).first;
+    pitEntry->insertOrUpdateInRecord(ingress, *interest);
+
+    size_t nSent = strategy.sendInterestHistory.size();
+    strategy.afterReceiveInterest(*interest, FaceEndpoint(ingress, 0), pitEntry);
+
+    std::vector<FaceId> sentTo;
+    for (size_t i = nSent; i < strategy.sendInterestHistory.size(); ++i) {
+      sentTo.push_back(strategy.sendInterestHistory[i].outFaceId);
+    }
+    return sentTo;
+  }
+
+  void
+  satisfy(const Name& name, Face& upstream, const shared_ptr<pit::Entry>& pitEntry)
+  {
+    strategy.beforeSatisfyInterest(*makeData(name), FaceEndpoint(upstream, 0), pitEntry);
+  }
+
+protected:
+  FaceTable faceTable;
+  Forwarder forwarder{faceTable};
+  GatewayAsfStrategyTester& strategy;
+  Fib& fib{forwarder.getFib()};
+  Pit& pit{forwarder.getPit()};
+
+  shared_ptr<DummyFace> consumer = make_shared<DummyFace>();
+  shared_ptr<DummyFace> domain = make_shared<DummyFace>();
+  shared_ptr<DummyFace> tunnel = make_shared<DummyFace>();
+};
+
+BOOST_AUTO_TEST_SUITE(Fw)
+BOOST_FIXTURE_TEST_SUITE(TestGatewayAsfStrategy, GatewayAsfStrategyFixture)
+
+BOOST_AUTO_TEST_CASE(NoTunnel)
+{
+  shared_ptr<pit::Entry> pitEntry;
+  BOOST_CHECK(strategy.getTunnelNextHop() == nullptr);
+  BOOST_CHECK(forward("/domain1/src1/1", *consumer, pitEntry) == std::vector<FaceId>{domain->getId()});
+
+  // out-domain prefix without a tunnel is rejected
+  BOOST_CHECK(forward("/domain2/src1/1", *consumer, pitEntry).empty());
+  BOOST_REQUIRE_EQUAL(strategy.sendNackHistory.size(), 1);
+  BOOST_CHECK_EQUAL(strategy.sendNackHistory.back().header.getReason(), lp::NackReason::NO_ROUTE);
+}
+
+BOOST_AUTO_TEST_CASE(OutDomain)
+{
+  registerTunnel();
+  BOOST_REQUIRE(strategy.getTunnelNextHop() != nullptr);
+  BOOST_CHECK_EQUAL(strategy.getTunnelNextHop()->getFace().getId(), tunnel->getId());
+
+  shared_ptr<pit::Entry> pitEntry;
+  BOOST_CHECK(forward("/domain2/src1/1", *consumer, pitEntry) == std::vector<FaceId>{tunnel->getId()});
+
+  // Interests coming out of the tunnel are not tunneled again
+  BOOST_CHECK(forward("/domain2/src1/2", *tunnel, pitEntry).empty());
+  BOOST_CHECK(forward("/domain1/src1/1", *tunnel, pitEntry) == std::vector<FaceId>{domain->getId()});
+}
+
+BOOST_AUTO_TEST_CASE(FasterPathWins)
+{
+  registerTunnel();
+
+  // the in-domain path answers in 40ms; without measurements on the tunnel it is preferred,
+  // and the tunnel is probed alongside it once probing is due
+  shared_ptr<pit::Entry> pitEntry;
+  std::vector<FaceId> sentTo;
+  int seq = 0;
+  while (true) {
+    sentTo = forward("/domain1/src1/" + to_string(seq++), *consumer, pitEntry);
+    BOOST_REQUIRE(!sentTo.empty());
+    BOOST_CHECK_EQUAL(sentTo.front(), domain->getId());
+    if (sentTo.size() == 2 || seq >= 10) {
+      break;
+    }
+    this->advanceClocks(10_ms, 40_ms);
+    satisfy(pitEntry->getName(), *domain, pitEntry);
+    this->advanceClocks(100_ms, 1_s);
+  }
+  BOOST_REQUIRE_EQUAL(sentTo.size(), 2);
+  BOOST_CHECK_EQUAL(sentTo.back(), tunnel->getId());
+
+  // the tunnel answers the probe in 10ms, ahead of the in-domain path
+  this->advanceClocks(10_ms);
+  satisfy(pitEntry->getName(), *tunnel, pitEntry);
+  this->advanceClocks(10_ms, 30_ms);
+  satisfy(pitEntry->getName(), *domain, pitEntry);
+  this->advanceClocks(100_ms, 1_s);
+
+  sentTo = forward("/domain1/src1/" + to_string(seq++), *consumer, pitEntry);
+  BOOST_REQUIRE(!sentTo.empty());
+  BOOST_CHECK_EQUAL(sentTo.front(), tunnel->getId());
+
+  // the in-domain path recovers: once probed and measured faster, it is preferred again
+  do {
+    this->advanceClocks(5_ms);
+    if (sentTo.size() == 2) {
+      BOOST_CHECK_EQUAL(sentTo.back(), domain->getId());
+      satisfy(pitEntry->getName(), *domain, pitEntry);
+    }
+    this->advanceClocks(5_ms, 15_ms);
+    satisfy(pitEntry->getName(), *tunnel, pitEntry);
+    this->advanceClocks(100_ms, 1_s);
+    sentTo = forward("/domain1/src1/" + to_string(seq++), *consumer, pitEntry);
+    BOOST_REQUIRE(!sentTo.empty());
+  } while (sentTo.front() == tunnel->getId() && seq < 40);
+  BOOST_CHECK_EQUAL(sentTo.front(), domain->getId());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestGatewayAsfStrategy
+BOOST_AUTO_TEST_SUITE_END() // Fw
+
+} // namespace tests
+} // namespace fw
+} // namespace nfd
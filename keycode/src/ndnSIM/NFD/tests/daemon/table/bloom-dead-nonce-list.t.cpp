@@ -0,0 +1,197 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2021,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "table/bloom-dead-nonce-list.hpp"
+#include "common/global.hpp"
+
+#include "tests/test-common.hpp"
+#include "tests/daemon/global-io-fixture.hpp"
+
+namespace nfd {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(Table)
+BOOST_FIXTURE_TEST_SUITE(TestBloomDeadNonceList, GlobalIoFixture)
+
+BOOST_AUTO_TEST_CASE(Basic)
+{
+  Name nameA("ndn:/A");
+  Name nameB("ndn:/B");
+  const Interest::Nonce nonce1(0x53b4eaa8);
+  const Interest::Nonce nonce2(0x1f46372b);
+
+  BloomDeadNonceList dnl;
+  BOOST_CHECK_EQUAL(dnl.size(), 0);
+  BOOST_CHECK_EQUAL(dnl.has(nameA, nonce1), false);
+
+  dnl.add(nameA, nonce1);
+  BOOST_CHECK_EQUAL(dnl.size(), 1);
+  BOOST_CHECK_EQUAL(dnl.has(nameA, nonce1), true);
+  BOOST_CHECK_EQUAL(dnl.has(nameA, nonce2), false);
+  BOOST_CHECK_EQUAL(dnl.has(nameB, nonce1), false);
+
+  dnl.add(nameA, nonce1);
+  BOOST_CHECK_EQUAL(dnl.size(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(InvalidArguments)
+{
+  BOOST_CHECK_THROW(BloomDeadNonceList(0_ms), std::invalid_argument);
+  BOOST_CHECK_THROW(BloomDeadNonceList(1_s, 0.0), std::invalid_argument);
+  BOOST_CHECK_THROW(BloomDeadNonceList(1_s, 1.0), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(Overflow)
+{
+  BloomDeadNonceList dnl;
+  const size_t n = BloomDeadNonceList::INITIAL_CAPACITY * 3;
+
+  Name name("/N");
+  for (uint32_t i = 1; i <= n; ++i) {
+    dnl.add(name, i);
+  }
+  BOOST_CHECK_GT(dnl.m_slices.size(), 1);
+  BOOST_CHECK_GE(dnl.size(), n - n / 1000); // duplicates are only false positives
+
+  size_t nMissing = 0;
+  for (uint32_t i = 1; i <= n; ++i) {
+    nMissing += !dnl.has(name, i);
+  }
+  BOOST_CHECK_EQUAL(nMissing, 0);
+}
+
+BOOST_AUTO_TEST_CASE(FalsePositiveRate)
+{
+  const double FP_RATE = 1e-3;
+  BloomDeadNonceList dnl(BloomDeadNonceList::DEFAULT_LIFETIME, FP_RATE);
+
+  Name name("/N");
+  for (uint32_t i = 1; i <= BloomDeadNonceList::INITIAL_CAPACITY / 2; ++i) {
+    dnl.add(name, i);
+  }
+  BOOST_CHECK_LT(dnl.getFalsePositiveRate(), FP_RATE);
+  BOOST_CHECK_GT(dnl.getMemoryUsage(), 0);
+
+  const uint32_t N_PROBES = 100000;
+  size_t nFalsePositives = 0;
+  for (uint32_t i = 0; i < N_PROBES; ++i) {
+    nFalsePositives += dnl.has(name, 0x80000000 + i);
+  }
+  BOOST_CHECK_LT(nFalsePositives, N_PROBES * FP_RATE * 3);
+}
+
+/// A fixture that periodically inserts Nonces
+class BloomPeriodicalInsertionFixture : public GlobalIoTimeFixture
+{
+protected:
+  BloomPeriodicalInsertionFixture()
+  {
+    addNonce();
+  }
+
+  void
+  setRate(size_t nNoncesPerLifetime)
+  {
+    addNonceBatch = nNoncesPerLifetime / BloomDeadNonceList::SLICE_COUNT;
+  }
+
+  void
+  addNonce()
+  {
+    for (size_t i = 0; i < addNonceBatch; ++i) {
+      dnl.add(name, ++lastNonce);
+    }
+
+    addNonceEvent = getScheduler().schedule(ADD_INTERVAL, [this] { addNonce(); });
+  }
+
+  /** \brief advance clocks by LIFETIME*t
+   */
+  void
+  advanceClocksByLifetime(double t)
+  {
+    advanceClocks(ADD_INTERVAL / 2, time::duration_cast<time::nanoseconds>(LIFETIME * t));
+  }
+
+protected:
+  static constexpr time::nanoseconds LIFETIME = 200_ms;
+  static constexpr time::nanoseconds ADD_INTERVAL = LIFETIME / BloomDeadNonceList::SLICE_COUNT;
+
+  BloomDeadNonceList dnl{LIFETIME};
+  Name name = "/N";
+  uint32_t lastNonce = 0;
+  size_t addNonceBatch = 0;
+  scheduler::ScopedEventId addNonceEvent;
+};
+
+const time::nanoseconds BloomPeriodicalInsertionFixture::LIFETIME;
+const time::nanoseconds BloomPeriodicalInsertionFixture::ADD_INTERVAL;
+
+BOOST_FIXTURE_TEST_CASE(Lifetime, BloomPeriodicalInsertionFixture)
+{
+  BOOST_CHECK_EQUAL(dnl.getLifetime(), LIFETIME);
+
+  const int RATE = BloomDeadNonceList::INITIAL_CAPACITY;
+  this->setRate(RATE);
+  this->advanceClocksByLifetime(10.0);
+  BOOST_CHECK_LE(dnl.m_slices.size(), BloomDeadNonceList::SLICE_COUNT + 1);
+
+  Name nameC("ndn:/C");
+  const Interest::Nonce nonceC(0x25390656);
+  BOOST_CHECK_EQUAL(dnl.has(nameC, nonceC), false);
+  dnl.add(nameC, nonceC);
+  BOOST_CHECK_EQUAL(dnl.has(nameC, nonceC), true);
+
+  this->advanceClocksByLifetime(0.5); // -50%, entry should exist
+  BOOST_CHECK_EQUAL(dnl.has(nameC, nonceC), true);
+
+  this->advanceClocksByLifetime(1.0); // +50%, entry should be gone
+  BOOST_CHECK_EQUAL(dnl.has(nameC, nonceC), false);
+}
+
+BOOST_FIXTURE_TEST_CASE(CapacityFollowsRate, BloomPeriodicalInsertionFixture)
+{
+  const int RATE = BloomDeadNonceList::INITIAL_CAPACITY * 4;
+  this->setRate(RATE);
+  this->advanceClocksByLifetime(10.0);
+
+  // one slice per interval once capacity has caught up with the rate
+  BOOST_CHECK_LE(dnl.m_slices.size(), BloomDeadNonceList::SLICE_COUNT + 1);
+  size_t capacity = dnl.m_slices.back().getCapacity();
+  BOOST_CHECK_GE(capacity, RATE / BloomDeadNonceList::SLICE_COUNT);
+  BOOST_CHECK_LE(capacity, RATE / BloomDeadNonceList::SLICE_COUNT * 2);
+
+  this->setRate(0);
+  this->advanceClocksByLifetime(2.0);
+  BOOST_CHECK_EQUAL(dnl.size(), 0);
+  BOOST_CHECK_EQUAL(dnl.m_slices.back().getCapacity(), BloomDeadNonceList::MIN_CAPACITY);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestBloomDeadNonceList
+BOOST_AUTO_TEST_SUITE_END() // Table
+
+} // namespace tests
+} // namespace nfd
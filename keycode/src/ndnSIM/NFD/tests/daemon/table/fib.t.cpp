@@ -148,6 +148,87 @@ BOOST_AUTO_TEST_CASE(FibEntry)
   BOOST_CHECK(fib.findExactMatch(prefix) == nullptr);
 }
 
+BOOST_AUTO_TEST_CASE(NextHopOrder)
+{
+  NameTree nameTree;
+  Fib fib(nameTree);
+  std::vector<shared_ptr<Face>> faces;
+  for (size_t i = 0; i < NEXTHOP_INLINE_CAPACITY + 2; ++i) {
+    faces.push_back(make_shared<DummyFace>());
+  }
+
+  const Face* signaledFace = nullptr;
+  fib.afterNewNextHop.connect([&] (const Name&, const NextHop& nextHop) {
+    signaledFace = &nextHop.getFace();
+  });
+
+  Entry& entry = *fib.insert("/A").first;
+  const uint64_t costs[] = {30, 10, 20, 10, 50, 0};
+  for (size_t i = 0; i < faces.size(); ++i) {
+    fib.addOrUpdateNextHop(entry, *faces[i], costs[i]);
+    // the signal carries the inserted nexthop, not the one at its former position
+    BOOST_CHECK_EQUAL(signaledFace, faces[i].get());
+  }
+  // [(f5,0), (f1,10), (f3,10), (f2,20), (f0,30), (f4,50)], ties in insertion order
+  std::vector<const Face*> expected{faces[5].get(), faces[1].get(), faces[3].get(),
+                                    faces[2].get(), faces[0].get(), faces[4].get()};
+  std::vector<const Face*> actual;
+  for (const auto& nh : entry.getNextHops()) {
+    actual.push_back(&nh.getFace());
+  }
+  BOOST_CHECK_EQUAL_COLLECTIONS(actual.begin(), actual.end(), expected.begin(), expected.end());
+
+  fib.addOrUpdateNextHop(entry, *faces[5], 40);
+  // [(f1,10), (f3,10), (f2,20), (f0,30), (f5,40), (f4,50)]
+  BOOST_CHECK_EQUAL(&entry.getNextHops().begin()->getFace(), faces[1].get());
+  BOOST_CHECK_EQUAL(&entry.getNextHops()[4].getFace(), faces[5].get());
+  BOOST_CHECK(std::is_sorted(entry.getNextHops().begin(), entry.getNextHops().end(),
+                             [] (const NextHop& a, const NextHop& b) { return a.getCost() < b.getCost(); }));
+}
+
+BOOST_AUTO_TEST_CASE(FirstUsableNextHop)
+{
+  NameTree nameTree;
+  Fib fib(nameTree);
+  auto face1 = make_shared<DummyFace>();
+  auto face2 = make_shared<DummyFace>();
+
+  Entry& entryA = *fib.insert("/A").first;
+  Entry& entryB = *fib.insert("/B").first;
+  BOOST_CHECK(entryA.getFirstUsableNextHop() == nullptr);
+
+  fib.addOrUpdateNextHop(entryA, *face1, 10);
+  fib.addOrUpdateNextHop(entryA, *face2, 20);
+  fib.addOrUpdateNextHop(entryB, *face2, 20);
+  BOOST_REQUIRE(entryA.getFirstUsableNextHop() != nullptr);
+  BOOST_CHECK_EQUAL(&entryA.getFirstUsableNextHop()->getFace(), face1.get());
+
+  face1->setState(face::FaceState::DOWN);
+  fib.updateUsableNextHops(*face1);
+  BOOST_REQUIRE(entryA.getFirstUsableNextHop() != nullptr);
+  BOOST_CHECK_EQUAL(&entryA.getFirstUsableNextHop()->getFace(), face2.get());
+  BOOST_CHECK_EQUAL(&entryB.getFirstUsableNextHop()->getFace(), face2.get());
+
+  face2->setState(face::FaceState::DOWN);
+  fib.updateUsableNextHops(*face2);
+  BOOST_CHECK(entryA.getFirstUsableNextHop() == nullptr);
+  BOOST_CHECK(entryB.getFirstUsableNextHop() == nullptr);
+
+  face1->setState(face::FaceState::UP);
+  fib.updateUsableNextHops(*face1);
+  BOOST_REQUIRE(entryA.getFirstUsableNextHop() != nullptr);
+  BOOST_CHECK_EQUAL(&entryA.getFirstUsableNextHop()->getFace(), face1.get());
+
+  fib.removeNextHop(entryA, *face1);
+  BOOST_CHECK(entryA.getFirstUsableNextHop() == nullptr);
+  // erased entries are no longer revisited on state changes
+  fib.erase("/B");
+  face2->setState(face::FaceState::UP);
+  fib.updateUsableNextHops(*face2);
+  BOOST_REQUIRE(entryA.getFirstUsableNextHop() != nullptr);
+  BOOST_CHECK_EQUAL(&entryA.getFirstUsableNextHop()->getFace(), face2.get());
+}
+
 BOOST_AUTO_TEST_CASE(Insert_LongestPrefixMatch)
 {
   NameTree nameTree;
@@ -242,6 +323,25 @@ BOOST_AUTO_TEST_CASE(LongestPrefixMatchWithMeasurementsEntry)
   BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch(mABCD).getPrefix(), "/A/B/C");
 }
 
+BOOST_AUTO_TEST_CASE(MatchNameView)
+{
+  NameTree nameTree;
+  Fib fib(nameTree);
+  fib.insert("/A");
+  fib.insert("/A/B/C");
+
+  ViewArena arena;
+  Name name("/A/B/C/D");
+  NameView view(name, arena);
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch(view).getPrefix(), "/A/B/C");
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch(view.getPrefix(2)).getPrefix(), "/A");
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch(view.getSubName(1)).getPrefix(), "/");
+
+  BOOST_CHECK(fib.findExactMatch(view.getPrefix(3)) == fib.findExactMatch("/A/B/C"));
+  BOOST_CHECK(fib.findExactMatch(view.getPrefix(2)) == nullptr);
+  BOOST_CHECK(fib.findExactMatch(view) == nullptr);
+}
+
 void
 validateFindExactMatch(Fib& fib, const Name& target)
 {
@@ -51,6 +51,14 @@ BOOST_AUTO_TEST_CASE(ComputeHash)
 
   hashes = computeHashes(prefix, 2);
   BOOST_CHECK_EQUAL(hashes.size(), 3);
+
+  // a view hashes the same as a Name with the same components
+  ViewArena arena;
+  NameView view(prefix, arena);
+  BOOST_CHECK_EQUAL(computeHash(view), computeHash(prefix));
+  BOOST_CHECK_EQUAL(computeHash(view, 2), computeHash(prefix, 2));
+  BOOST_CHECK(computeHashes(view) == computeHashes(prefix));
+  BOOST_CHECK_EQUAL(computeHash(NameView(root, arena)), 0);
 }
 
 BOOST_AUTO_TEST_SUITE(Hashtable)
@@ -419,6 +427,35 @@ BOOST_AUTO_TEST_CASE(Basic)
   BOOST_CHECK_EQUAL(nt.size(), 8);
 }
 
+BOOST_AUTO_TEST_CASE(MatchNameView)
+{
+  NameTree nt;
+  nt.lookup("/a/b/c");
+  nt.lookup("/a/e");
+  Entry* ab = nt.findExactMatch(Name("/a/b"));
+  Entry* abc = nt.findExactMatch(Name("/a/b/c"));
+  Entry* root = nt.findExactMatch(Name());
+
+  ViewArena arena;
+  Name name("/a/b/c/d");
+  NameView view(name, arena);
+  BOOST_CHECK_EQUAL(nt.findExactMatch(view), nullptr);
+  BOOST_CHECK_EQUAL(nt.findExactMatch(view, 3), abc);
+  BOOST_CHECK_EQUAL(nt.findExactMatch(view.getPrefix(2)), ab);
+  BOOST_CHECK_EQUAL(nt.findExactMatch(view.getPrefix(0)), root);
+  BOOST_CHECK_EQUAL(nt.findExactMatch(view.getSubName(1, 2)), nullptr);
+
+  BOOST_CHECK_EQUAL(nt.findLongestPrefixMatch(view), abc);
+  BOOST_CHECK_EQUAL(nt.findLongestPrefixMatch(view.getPrefix(2)), ab);
+  BOOST_CHECK_EQUAL(nt.findLongestPrefixMatch(view, [=] (const Entry& entry) {
+                      return &entry != abc;
+                    }), ab);
+
+  Name other("/x/a/b");
+  BOOST_CHECK_EQUAL(nt.findLongestPrefixMatch(NameView(other, arena)), root);
+  BOOST_CHECK_EQUAL(nt.findLongestPrefixMatch(NameView(other, arena).getSubName(1)), ab);
+}
+
 /** \brief verify a NameTree enumeration contains expected entries
  *
  *  Example:
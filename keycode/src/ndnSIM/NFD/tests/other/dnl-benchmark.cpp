@@ -0,0 +1,157 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2021,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "benchmark-helpers.hpp"
+#include "table/dead-nonce-list.hpp"
+#include "table/bloom-dead-nonce-list.hpp"
+
+#include <iostream>
+
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+#include <malloc.h>
+#define NFD_DNL_BENCHMARK_HAVE_MALLINFO2
+#endif
+
+namespace nfd {
+namespace tests {
+
+/** \brief Compares memory per entry and lookup cost of Dead Nonce List implementations
+ *
+ *  Both lists are filled with N_ENTRIES nonces spread over a few names, which is the steady
+ *  state of a forwarder that sees N_ENTRIES looped-or-satisfied Interests per lifetime.
+ */
+class DnlBenchmarkFixture
+{
+protected:
+  DnlBenchmarkFixture()
+  {
+#ifdef _DEBUG
+    std::cerr << "Benchmark compiled in debug mode is unreliable, please compile in release mode.\n";
+#endif
+
+    for (size_t i = 0; i < N_NAMES; ++i) {
+      names.emplace_back(Name("/dnl/benchmark").appendNumber(i));
+      names.back().wireEncode();
+    }
+  }
+
+  static time::nanoseconds
+  timedRun(const std::function<void()>& f)
+  {
+    auto t1 = time::steady_clock::now();
+    f();
+    auto t2 = time::steady_clock::now();
+    return time::duration_cast<time::nanoseconds>(t2 - t1);
+  }
+
+  static size_t
+  getHeapUsage()
+  {
+#ifdef NFD_DNL_BENCHMARK_HAVE_MALLINFO2
+    return mallinfo2().uordblks;
+#else
+    return 0;
+#endif
+  }
+
+  /** \brief Fill the list over N_INTERVALS intervals, then measure lookups
+   *  \param nextInterval invoked at the end of each interval, in place of the timer
+   */
+  void
+  run(const std::string& label, DeadNonceListBase& dnl,
+      const std::function<void()>& nextInterval = [] {})
+  {
+    constexpr uint32_t N_ADDS = N_ENTRIES / N_INTERVALS_PER_LIFETIME * N_INTERVALS;
+
+    time::nanoseconds dAdd = timedRun([&] {
+      for (uint32_t i = 0; i < N_ADDS; ++i) {
+        dnl.add(names[i % N_NAMES], i);
+        if ((i + 1) % (N_ENTRIES / N_INTERVALS_PER_LIFETIME) == 0) {
+          nextInterval();
+        }
+      }
+    });
+
+    // the most recent half lifetime is retained by both implementations
+    size_t nHits = 0;
+    time::nanoseconds dHit = timedRun([&] {
+      for (uint32_t i = 0; i < N_LOOKUPS; ++i) {
+        uint32_t nonce = N_ADDS - 1 - (i * 7919) % (N_ENTRIES / 2);
+        nHits += dnl.has(names[nonce % N_NAMES], nonce);
+      }
+    });
+
+    size_t nFalsePositives = 0;
+    time::nanoseconds dMiss = timedRun([&] {
+      for (uint32_t i = 0; i < N_LOOKUPS; ++i) {
+        uint32_t nonce = N_ADDS + i;
+        nFalsePositives += dnl.has(names[nonce % N_NAMES], nonce);
+      }
+    });
+
+    std::cout << label << " size=" << dnl.size()
+              << " add=" << dAdd.count() / N_ADDS << "ns"
+              << " has(hit)=" << dHit.count() / N_LOOKUPS << "ns"
+              << " has(miss)=" << dMiss.count() / N_LOOKUPS << "ns"
+              << " hits=" << nHits << "/" << N_LOOKUPS
+              << " falsePositives=" << nFalsePositives << "/" << N_LOOKUPS;
+  }
+
+protected:
+  static constexpr size_t N_NAMES = 1024;
+  static constexpr uint32_t N_ENTRIES = 1000000;
+  static constexpr uint32_t N_LOOKUPS = 2000000;
+  static constexpr uint32_t N_INTERVALS_PER_LIFETIME = BloomDeadNonceList::SLICE_COUNT;
+  static constexpr uint32_t N_INTERVALS = N_INTERVALS_PER_LIFETIME * 3;
+
+  std::vector<Name> names;
+};
+
+BOOST_FIXTURE_TEST_CASE(HashTable, DnlBenchmarkFixture)
+{
+  size_t heap0 = getHeapUsage();
+  DeadNonceList dnl;
+  dnl.m_capacity = N_ENTRIES; // skip the capacity ramp-up
+  run("DeadNonceList", dnl);
+  size_t heap1 = getHeapUsage();
+
+  if (heap1 > heap0) {
+    std::cout << " bytes/entry=" << static_cast<double>(heap1 - heap0) / dnl.size();
+  }
+  std::cout << std::endl;
+}
+
+BOOST_FIXTURE_TEST_CASE(Bloom, DnlBenchmarkFixture)
+{
+  BloomDeadNonceList dnl;
+  run("BloomDeadNonceList", dnl, [&dnl] { dnl.rotate(); });
+
+  std::cout << " bytes/entry=" << static_cast<double>(dnl.getMemoryUsage()) / dnl.size()
+            << " estimatedFpRate=" << dnl.getFalsePositiveRate() << std::endl;
+}
+
+} // namespace tests
+} // namespace nfd
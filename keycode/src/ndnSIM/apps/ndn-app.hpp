@@ -101,6 +101,7 @@ protected:
 
 protected:
   bool m_active; ///< @brief Flag to indicate that application is active (set by StartApplication and StopApplication)
+  bool m_isSynchronousDelivery; ///< @brief Hand packets to the application without a ScheduleNow event
   shared_ptr<Face> m_face;
   AppLinkService* m_appLink;
 
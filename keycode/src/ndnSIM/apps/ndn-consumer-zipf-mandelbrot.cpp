@@ -77,17 +77,62 @@ ConsumerZipfMandelbrot::SetNumberOfContents(uint32_t numOfContents)
 
   NS_LOG_DEBUG(m_q << " and " << m_s << " and " << m_N);
 
-  m_Pcum = std::vector<double>(m_N + 1);
+  // rebuilt on the next request
+  m_aliasProb.clear();
+  m_alias.clear();
+}
 
-  m_Pcum[0] = 0.0;
-  for (uint32_t i = 1; i <= m_N; i++) {
-    m_Pcum[i] = m_Pcum[i - 1] + 1.0 / std::pow(i + m_q, m_s);
+void
+ConsumerZipfMandelbrot::BuildAliasTable()
+{
+  // m_aliasProb[i] is first the probability of rank i + 1, scaled so that the average is 1
+  m_aliasProb.resize(m_N);
+  m_alias.resize(m_N);
+
+  double sum = 0.0;
+  for (uint32_t i = 0; i < m_N; i++) {
+    m_aliasProb[i] = 1.0 / std::pow(i + 1 + m_q, m_s);
+    sum += m_aliasProb[i];
+  }
+  for (uint32_t i = 0; i < m_N; i++) {
+    m_aliasProb[i] = m_aliasProb[i] * m_N / sum;
+    m_alias[i] = i;
   }
 
-  for (uint32_t i = 1; i <= m_N; i++) {
-    m_Pcum[i] = m_Pcum[i] / m_Pcum[m_N];
-    NS_LOG_LOGIC("Cumulative probability [" << i << "]=" << m_Pcum[i]);
+  // bins below the average are filled from the front of the work list, bins above from the back
+  std::vector<uint32_t> work(m_N);
+  uint32_t nSmall = 0;
+  uint32_t large = m_N;
+  for (uint32_t i = 0; i < m_N; i++) {
+    if (m_aliasProb[i] < 1.0) {
+      work[nSmall++] = i;
+    }
+    else {
+      work[--large] = i;
+    }
+  }
+
+  while (nSmall > 0 && large < m_N) {
+    uint32_t small = work[--nSmall];
+    uint32_t donor = work[large];
+    m_alias[small] = donor;
+    m_aliasProb[donor] -= 1.0 - m_aliasProb[small];
+    if (m_aliasProb[donor] < 1.0) {
+      // the donor becomes small, its slot in the large list is reused for the small list
+      ++large;
+      work[nSmall++] = donor;
+    }
   }
+
+  // leftovers differ from 1 by rounding errors only
+  for (uint32_t i = 0; i < nSmall; i++) {
+    m_aliasProb[work[i]] = 1.0;
+  }
+  for (uint32_t i = large; i < m_N; i++) {
+    m_aliasProb[work[i]] = 1.0;
+  }
+
+  NS_LOG_LOGIC("Alias table of " << m_N << " contents built");
 }
 
 uint32_t
@@ -198,24 +243,19 @@ ConsumerZipfMandelbrot::SendPacket()
 uint32_t
 ConsumerZipfMandelbrot::GetNextSeq()
 {
-  uint32_t content_index = 1; //[1, m_N]
-  double p_sum = 0;
-
-  double p_random = m_seqRng->GetValue();
-  while (p_random == 0) {
-    p_random = m_seqRng->GetValue();
+  if (m_N == 0) {
+    return 1;
+  }
+  if (m_aliasProb.size() != m_N) {
+    BuildAliasTable();
   }
-  // if (p_random == 0)
+
+  // a single uniform number picks a bin and decides between the bin's rank and its alias
+  double p_random = m_seqRng->GetValue() * m_N;
   NS_LOG_LOGIC("p_random=" << p_random);
-  for (uint32_t i = 1; i <= m_N; i++) {
-    p_sum = m_Pcum[i]; // m_Pcum[i] = m_Pcum[i-1] + p[i], p[0] = 0;   e.g.: p_cum[1] = p[1],
-                       // p_cum[2] = p[1] + p[2]
-    if (p_random <= p_sum) {
-      content_index = i;
-      break;
-    } // if
-  }   // for
-  // content_index = 1;
+  uint32_t bin = std::min(static_cast<uint32_t>(p_random), m_N - 1);
+  uint32_t content_index = 1 + (p_random - bin < m_aliasProb[bin] ? bin : m_alias[bin]); //[1, m_N]
+
   NS_LOG_DEBUG("RandomNumber=" << content_index);
   return content_index;
 }
@@ -90,11 +90,21 @@ private:
   double
   GetS() const;
 
+  /**
+   * \brief Build the alias table of the distribution (Vose's method)
+   *
+   * The table is built on the first request after N, q or s has changed, so that setting
+   * all three attributes of a large catalog costs a single O(N) pass.
+   */
+  void
+  BuildAliasTable();
+
 private:
   uint32_t m_N;               // number of the contents
   double m_q;                 // q in (k+q)^s
   double m_s;                 // s in (k+q)^s
-  std::vector<double> m_Pcum; // cumulative probability
+  std::vector<double> m_aliasProb; // probability of keeping the rank of each bin
+  std::vector<uint32_t> m_alias;   // rank replacing the rank of each bin otherwise
 
   Ptr<UniformRandomVariable> m_seqRng; // RNG
 };
@@ -108,7 +108,11 @@ Producer::OnInterest(shared_ptr<const Interest> interest)
   data->setName(dataName);
   data->setFreshnessPeriod(::ndn::time::milliseconds(m_freshness.GetMilliSeconds()));
 
-  data->setContent(make_shared< ::ndn::Buffer>(m_virtualPayloadSize));
+  // the payload is allocated once and referenced by each Data until it is encoded
+  if (m_payload == nullptr || m_payload->size() != m_virtualPayloadSize) {
+    m_payload = make_shared< ::ndn::Buffer>(m_virtualPayloadSize);
+  }
+  data->setContent(m_payload);
 
   SignatureInfo signatureInfo(static_cast< ::ndn::tlv::SignatureTypeValue>(255));
 
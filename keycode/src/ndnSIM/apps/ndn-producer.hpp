@@ -63,6 +63,7 @@ private:
   Name m_prefix;
   Name m_postfix;
   uint32_t m_virtualPayloadSize;
+  shared_ptr<const ::ndn::Buffer> m_payload; ///< content shared by all Data packets
   Time m_freshness;
 
   uint32_t m_signature;
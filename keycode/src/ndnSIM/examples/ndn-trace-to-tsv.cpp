@@ -0,0 +1,81 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-trace-to-tsv.cpp
+
+#include "ns3/core-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include <fstream>
+
+namespace ns3 {
+
+/**
+ * Converts a trace written by a tracer to a .bin or .bin.gz file into the tab-separated values
+ * that the tracer writes to a text file:
+ *
+ *     ./waf --run="ndn-trace-to-tsv --input=rate-trace.bin.gz --output=rate-trace.txt"
+ *
+ * Without --output, the values are written to the standard output.
+ */
+
+int
+main(int argc, char* argv[])
+{
+  std::string input;
+  std::string output = "-";
+
+  CommandLine cmd;
+  cmd.AddValue("input", "Binary trace to convert", input);
+  cmd.AddValue("output", "Text trace to write, - for the standard output", output);
+  cmd.Parse(argc, argv);
+
+  std::ifstream is(input, std::ios_base::in | std::ios_base::binary);
+  if (!is.is_open()) {
+    std::cerr << "File " << input << " cannot be opened for reading" << std::endl;
+    return 1;
+  }
+
+  std::ofstream file;
+  if (output != "-") {
+    file.open(output, std::ios_base::out | std::ios_base::trunc);
+    if (!file.is_open()) {
+      std::cerr << "File " << output << " cannot be opened for writing" << std::endl;
+      return 1;
+    }
+  }
+
+  try {
+    ndn::BinaryTraceSink::ConvertToTsv(is, output != "-" ? file : std::cout);
+  }
+  catch (const ndn::BinaryTraceSink::Error& e) {
+    std::cerr << input << ": " << e.what() << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
+
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  return ns3::main(argc, argv);
+}
@@ -38,6 +38,7 @@
 #include "ns3/node-list.h"
 #include "ns3/data-rate.h"
 
+#include "daemon/fw/forwarder.hpp"
 #include "daemon/mgmt/fib-manager.hpp"
 #include "ns3/ndnSIM/model/ndn-l3-protocol.hpp"
 #include "ns3/ndnSIM/helper/ndn-stack-helper.hpp"
@@ -50,6 +51,17 @@ NS_LOG_COMPONENT_DEFINE("ndn.FibHelper");
 void
 FibHelper::AddNextHop(const ControlParameters& parameters, Ptr<Node> node)
 {
+  Ptr<L3Protocol> l3protocol = node->GetObject<L3Protocol>();
+  if (!l3protocol->isManagementEnabled()) {
+    // no FibManager to send the command to, update the FIB directly
+    nfd::Face* face = l3protocol->getFaceTable().get(parameters.getFaceId());
+    NS_ASSERT_MSG(face != nullptr, "Face with ID [" << parameters.getFaceId()
+                                   << "] does not exist on node [" << node->GetId() << "]");
+    nfd::Fib& fib = l3protocol->getForwarder()->getFib();
+    fib.addOrUpdateNextHop(*fib.insert(parameters.getName()).first, *face, parameters.getCost());
+    return;
+  }
+
   Block encodedParameters(parameters.wireEncode());
 
   Name commandName("/localhost/nfd/fib");
@@ -60,13 +72,23 @@ FibHelper::AddNextHop(const ControlParameters& parameters, Ptr<Node> node)
   command->setCanBePrefix(false);
   StackHelper::getKeyChain().sign(*command);
 
-  Ptr<L3Protocol> l3protocol = node->GetObject<L3Protocol>();
   l3protocol->injectInterest(*command);
 }
 
 void
 FibHelper::RemoveNextHop(const ControlParameters& parameters, Ptr<Node> node)
 {
+  Ptr<L3Protocol> l3protocol = node->GetObject<L3Protocol>();
+  if (!l3protocol->isManagementEnabled()) {
+    nfd::Face* face = l3protocol->getFaceTable().get(parameters.getFaceId());
+    nfd::Fib& fib = l3protocol->getForwarder()->getFib();
+    nfd::fib::Entry* entry = fib.findExactMatch(parameters.getName());
+    if (face != nullptr && entry != nullptr) {
+      fib.removeNextHop(*entry, *face);
+    }
+    return;
+  }
+
   Block encodedParameters(parameters.wireEncode());
 
   Name commandName("/localhost/nfd/fib");
@@ -77,7 +99,6 @@ FibHelper::RemoveNextHop(const ControlParameters& parameters, Ptr<Node> node)
   command->setCanBePrefix(false);
   StackHelper::getKeyChain().sign(*command);
 
-  Ptr<L3Protocol> l3protocol = node->GetObject<L3Protocol>();
   l3protocol->injectInterest(*command);
 }
 
@@ -50,8 +50,11 @@
 #include <boost/lexical_cast.hpp>
 #include <boost/foreach.hpp>
 #include <boost/concept/assert.hpp>
+#include <boost/graph/adjacency_list.hpp>
 #include <boost/graph/dijkstra_shortest_paths.hpp>
 
+#include <atomic>
+#include <thread>
 #include <unordered_map>
 
 #include "boost-graph-ndn-global-routing-helper.hpp"
@@ -63,6 +66,8 @@ NS_LOG_COMPONENT_DEFINE("ndn.GlobalRoutingHelper");
 namespace ns3 {
 namespace ndn {
 
+uint32_t GlobalRoutingHelper::m_nCalculationThreads = 0;
+
 void
 GlobalRoutingHelper::Install(Ptr<Node> node)
 {
@@ -110,6 +115,12 @@ GlobalRoutingHelper::Install(Ptr<Node> node)
         Ptr<Node> otherNode = otherSide->GetNode();
         NS_ASSERT(otherNode != 0);
 
+        if (otherNode->GetObject<L3Protocol>() == 0) {
+          // e.g., the IP side of a gateway node
+          NS_LOG_DEBUG("Skipping link to node " << otherNode->GetId() << " without NDN stack");
+          continue;
+        }
+
         Ptr<GlobalRouter> otherGr = otherNode->GetObject<GlobalRouter>();
         if (otherGr == 0) {
           Install(otherNode);
@@ -149,6 +160,11 @@ GlobalRoutingHelper::Install(Ptr<Channel> channel)
     Ptr<Node> node = dev->GetNode();
     NS_ASSERT(node != 0);
 
+    if (node->GetObject<L3Protocol>() == 0) {
+      NS_LOG_DEBUG("Skipping node " << node->GetId() << " without NDN stack");
+      continue;
+    }
+
     Ptr<GlobalRouter> grOther = node->GetObject<GlobalRouter>();
     if (grOther == 0) {
       Install(node);
@@ -214,6 +230,224 @@ GlobalRoutingHelper::AddOriginsForAll()
   }
 }
 
+void
+GlobalRoutingHelper::SetCalculationThreads(uint32_t nThreads)
+{
+  m_nCalculationThreads = nThreads;
+}
+
+namespace {
+
+/**
+ * @brief Edge of RouterGraphSnapshot
+ */
+struct Hop
+{
+  Face* face; ///< nullptr on edges that leave a channel
+  uint16_t metric;
+};
+
+using SnapshotGraph = boost::adjacency_list<boost::vecS, boost::vecS, boost::directedS,
+                                            boost::no_property, Hop>;
+using SnapshotEdge = boost::graph_traits<SnapshotGraph>::edge_descriptor;
+
+/**
+ * @brief Distance to a vertex along with the first hop from the source, like boost::DistancesMap
+ */
+struct HopDistance
+{
+  Face* face;
+  uint32_t metric;
+};
+
+struct HopDistanceCompare
+{
+  bool
+  operator()(const HopDistance& a, const HopDistance& b) const
+  {
+    return a.metric < b.metric;
+  }
+};
+
+struct HopDistanceCombine
+{
+  HopDistance
+  operator()(const HopDistance& a, const Hop& b) const
+  {
+    return {a.face == nullptr ? b.face : a.face, a.metric + b.metric};
+  }
+};
+
+/**
+ * @brief Edge weights of one shortest path computation
+ *
+ * When a face of the source is enabled, the other faces of the source are treated as disabled,
+ * as CalculateAllPossibleRoutes() used to do by changing the metrics of the real faces.
+ */
+class HopWeights
+{
+public:
+  using key_type = SnapshotEdge;
+  using value_type = Hop;
+  using reference = Hop;
+  using category = boost::readable_property_map_tag;
+
+  HopWeights(const SnapshotGraph& graph, size_t source, Face* enabledFace)
+    : m_graph(&graph)
+    , m_source(source)
+    , m_enabledFace(enabledFace)
+  {
+  }
+
+  friend Hop
+  get(const HopWeights& weights, const SnapshotEdge& edge)
+  {
+    Hop hop = (*weights.m_graph)[edge];
+    if (weights.m_enabledFace != nullptr && boost::source(edge, *weights.m_graph) == weights.m_source &&
+        hop.face != weights.m_enabledFace) {
+      hop.metric = DISABLED_METRIC;
+    }
+    return hop;
+  }
+
+public:
+  // value std::numeric_limits<uint16_t>::max () MUST NOT be used (reserved)
+  static constexpr uint16_t DISABLED_METRIC = std::numeric_limits<uint16_t>::max() - 1;
+
+private:
+  const SnapshotGraph* m_graph;
+  size_t m_source;
+  Face* m_enabledFace;
+};
+
+/**
+ * @brief Route found by a shortest path computation, to be installed on the main thread
+ */
+struct FoundRoute
+{
+  size_t origin; ///< vertex that exports the prefixes
+  Face* face;
+  uint32_t metric;
+};
+
+/**
+ * @brief Read-only copy of the GlobalRouter graph
+ *
+ * ns-3 reference counts are not thread-safe, so the shortest paths of several sources are
+ * computed on vertex indices and raw face pointers; the faces and prefixes are looked up
+ * through this snapshot when routes are installed afterwards, on the main thread.
+ * Vertices and out-edges keep the order of boost::NdnGlobalRouterGraph, so ties are broken
+ * the same way as when Dijkstra ran on the GlobalRouter objects.
+ */
+class RouterGraphSnapshot
+{
+public:
+  RouterGraphSnapshot()
+  {
+    boost::NdnGlobalRouterGraph routers;
+    for (const auto& router : routers.GetVertices()) {
+      m_indices.emplace(PeekPointer(router), m_routers.size());
+      m_routers.push_back(router);
+    }
+
+    m_graph = SnapshotGraph(m_routers.size());
+    for (size_t i = 0; i < m_routers.size(); i++) {
+      for (const auto& incidency : m_routers[i]->GetIncidencies()) {
+        const auto& face = std::get<1>(incidency);
+        Hop hop{face.get(), static_cast<uint16_t>(face == nullptr ? 0 : face->getMetric())};
+        boost::add_edge(i, m_indices.at(PeekPointer(std::get<2>(incidency))), hop, m_graph);
+        if (face != nullptr) {
+          m_faces.emplace(face.get(), face);
+        }
+      }
+      m_isOrigin.push_back(!m_routers[i]->GetLocalPrefixes().empty());
+    }
+  }
+
+  size_t
+  getIndex(Ptr<GlobalRouter> router) const
+  {
+    return m_indices.at(PeekPointer(router));
+  }
+
+  Ptr<GlobalRouter>
+  getRouter(size_t index) const
+  {
+    return m_routers[index];
+  }
+
+  shared_ptr<Face>
+  getFace(Face* face) const
+  {
+    return m_faces.at(face);
+  }
+
+  /**
+   * @brief Compute shortest paths from @p source to all prefix origins
+   * @param enabledFace if not nullptr, the only face of the source that may be used
+   */
+  std::vector<FoundRoute>
+  findRoutes(size_t source, Face* enabledFace) const
+  {
+    std::vector<HopDistance> distances(boost::num_vertices(m_graph));
+    boost::dijkstra_shortest_paths(m_graph, source,
+                                   boost::weight_map(HopWeights(m_graph, source, enabledFace))
+                                     .distance_map(boost::make_iterator_property_map(
+                                       distances.begin(), boost::get(boost::vertex_index, m_graph)))
+                                     .distance_inf(HopDistance{nullptr, std::numeric_limits<uint16_t>::max()})
+                                     .distance_zero(HopDistance{nullptr, 0})
+                                     .distance_compare(HopDistanceCompare())
+                                     .distance_combine(HopDistanceCombine()));
+
+    std::vector<FoundRoute> routes;
+    for (size_t i = 0; i < distances.size(); i++) {
+      // the source and unreachable vertices have no first hop
+      if (i != source && m_isOrigin[i] && distances[i].face != nullptr) {
+        routes.push_back({i, distances[i].face, distances[i].metric});
+      }
+    }
+    return routes;
+  }
+
+private:
+  std::vector<Ptr<GlobalRouter>> m_routers;
+  std::unordered_map<GlobalRouter*, size_t> m_indices;
+  std::vector<bool> m_isOrigin;
+  std::unordered_map<Face*, shared_ptr<Face>> m_faces;
+  SnapshotGraph m_graph;
+};
+
+/**
+ * @brief Run @p task for every index in [0, nTasks) on @p nThreads threads
+ */
+template<typename Task>
+void
+runInParallel(size_t nTasks, uint32_t nThreads, const Task& task)
+{
+  if (nThreads == 0) {
+    nThreads = std::max(1U, std::thread::hardware_concurrency());
+  }
+  nThreads = static_cast<uint32_t>(std::min<size_t>(nThreads, nTasks));
+
+  std::atomic<size_t> next(0);
+  auto worker = [&] {
+    for (size_t i = next++; i < nTasks; i = next++) {
+      task(i);
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (uint32_t i = 1; i < nThreads; i++) {
+    threads.emplace_back(worker);
+  }
+  worker();
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
+} // namespace
+
 void
 GlobalRoutingHelper::CalculateRoutes()
 {
@@ -225,55 +459,40 @@ GlobalRoutingHelper::CalculateRoutes()
   BOOST_CONCEPT_ASSERT((boost::VertexListGraphConcept<boost::NdnGlobalRouterGraph>));
   BOOST_CONCEPT_ASSERT((boost::IncidenceGraphConcept<boost::NdnGlobalRouterGraph>));
 
-  boost::NdnGlobalRouterGraph graph;
-  // typedef graph_traits < NdnGlobalRouterGraph >::vertex_descriptor vertex_descriptor;
+  RouterGraphSnapshot graph;
 
   // For now we doing Dijkstra for every node.  Can be replaced with Bellman-Ford or Floyd-Warshall.
   // Other algorithms should be faster, but they need additional EdgeListGraph concept provided by
   // the graph, which
   // is not obviously how implement in an efficient manner
+  std::vector<Ptr<Node>> sources;
   for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
-    Ptr<GlobalRouter> source = (*node)->GetObject<GlobalRouter>();
-    if (source == 0) {
+    if ((*node)->GetObject<GlobalRouter>() == 0) {
       NS_LOG_DEBUG("Node " << (*node)->GetId() << " does not export GlobalRouter interface");
       continue;
     }
+    sources.push_back(*node);
+  }
 
-    boost::DistancesMap distances;
-
-    dijkstra_shortest_paths(graph, source,
-                            // predecessor_map (boost::ref(predecessors))
-                            // .
-                            distance_map(boost::ref(distances))
-                              .distance_inf(boost::WeightInf)
-                              .distance_zero(boost::WeightZero)
-                              .distance_compare(boost::WeightCompare())
-                              .distance_combine(boost::WeightCombine()));
+  std::vector<size_t> sourceIndices;
+  for (const auto& node : sources) {
+    sourceIndices.push_back(graph.getIndex(node->GetObject<GlobalRouter>()));
+  }
 
-    // NS_LOG_DEBUG (predecessors.size () << ", " << distances.size ());
+  // Dijkstra runs concurrently, routes are installed in the order of the nodes afterwards
+  std::vector<std::vector<FoundRoute>> routes(sources.size());
+  runInParallel(sources.size(), m_nCalculationThreads, [&] (size_t i) {
+    routes[i] = graph.findRoutes(sourceIndices[i], nullptr);
+  });
 
-    Ptr<L3Protocol> L3protocol = (*node)->GetObject<L3Protocol>();
-    shared_ptr<nfd::Forwarder> forwarder = L3protocol->getForwarder();
+  for (size_t i = 0; i < sources.size(); i++) {
+    NS_LOG_DEBUG("Reachability from Node: " << sources[i]->GetId());
+    for (const auto& route : routes[i]) {
+      for (const auto& prefix : graph.getRouter(route.origin)->GetLocalPrefixes()) {
+        NS_LOG_DEBUG(" prefix " << prefix << " reachable via face " << *route.face
+                     << " with distance " << route.metric);
 
-    NS_LOG_DEBUG("Reachability from Node: " << source->GetObject<Node>()->GetId());
-    for (const auto& dist : distances) {
-      if (dist.first == source)
-        continue;
-      else {
-        // cout << "  Node " << dist.first->GetObject<Node> ()->GetId ();
-        if (std::get<0>(dist.second) == 0) {
-          // cout << " is unreachable" << endl;
-        }
-        else {
-          for (const auto& prefix : dist.first->GetLocalPrefixes()) {
-            NS_LOG_DEBUG(" prefix " << prefix << " reachable via face " << *std::get<0>(dist.second)
-                         << " with distance " << std::get<1>(dist.second) << " with delay "
-                         << std::get<2>(dist.second));
-
-            FibHelper::AddRoute(*node, *prefix, std::get<0>(dist.second),
-                                std::get<1>(dist.second));
-          }
-        }
+        FibHelper::AddRoute(sources[i], *prefix, graph.getFace(route.face), route.metric);
       }
     }
   }
@@ -290,13 +509,22 @@ GlobalRoutingHelper::CalculateAllPossibleRoutes()
   BOOST_CONCEPT_ASSERT((boost::VertexListGraphConcept<boost::NdnGlobalRouterGraph>));
   BOOST_CONCEPT_ASSERT((boost::IncidenceGraphConcept<boost::NdnGlobalRouterGraph>));
 
-  boost::NdnGlobalRouterGraph graph;
-  // typedef graph_traits < NdnGlobalRouterGraph >::vertex_descriptor vertex_descriptor;
+  RouterGraphSnapshot graph;
 
   // For now we doing Dijkstra for every node.  Can be replaced with Bellman-Ford or Floyd-Warshall.
   // Other algorithms should be faster, but they need additional EdgeListGraph concept provided by
   // the graph, which
   // is not obviously how implement in an efficient manner
+
+  // one computation per node and face, using only that face of the node
+  struct FaceTask
+  {
+    Ptr<Node> node;
+    size_t source;
+    Face* face;
+  };
+  std::vector<FaceTask> tasks;
+
   for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
     Ptr<GlobalRouter> source = (*node)->GetObject<GlobalRouter>();
     if (source == 0) {
@@ -304,84 +532,43 @@ GlobalRoutingHelper::CalculateAllPossibleRoutes()
       continue;
     }
 
-    Ptr<L3Protocol> L3protocol = (*node)->GetObject<L3Protocol>();
-    shared_ptr<nfd::Forwarder> forwarder = L3protocol->getForwarder();
-
-    NS_LOG_DEBUG("Reachability from Node: " << source->GetObject<Node>()->GetId() << " ("
-                                            << Names::FindName(source->GetObject<Node>()) << ")");
-
     Ptr<L3Protocol> l3 = source->GetObject<L3Protocol>();
     NS_ASSERT(l3 != 0);
 
-    // remember interface statuses
-    std::list<nfd::FaceId> faceIds;
-    std::unordered_map<nfd::FaceId, uint16_t> originalMetrics;
-    for (auto& nfdFace : l3->getFaceTable()) {
-      faceIds.push_back(nfdFace.getId());
-      originalMetrics[nfdFace.getId()] = nfdFace.getMetric();
-      nfdFace.setMetric(std::numeric_limits<uint16_t>::max() - 1);
-      // value std::numeric_limits<uint16_t>::max () MUST NOT be used (reserved)
-    }
-
-    for (auto& faceId : faceIds) {
-      auto* face = l3->getFaceTable().get(faceId);
-      NS_ASSERT(face != nullptr);
-      auto transport = dynamic_cast<NetDeviceTransport*>(face->getTransport());
+    size_t sourceIndex = graph.getIndex(source);
+    for (auto& face : l3->getFaceTable()) {
+      auto transport = dynamic_cast<NetDeviceTransport*>(face.getTransport());
       if (transport == nullptr) {
         NS_LOG_DEBUG("Skipping non ndnSIM-specific transport face");
         continue;
       }
+      tasks.push_back({*node, sourceIndex, &face});
+    }
+  }
 
-      // enabling only faceId
-      face->setMetric(originalMetrics[faceId]);
-
-      boost::DistancesMap distances;
+  std::vector<std::vector<FoundRoute>> routes(tasks.size());
+  runInParallel(tasks.size(), m_nCalculationThreads, [&] (size_t i) {
+    routes[i] = graph.findRoutes(tasks[i].source, tasks[i].face);
+  });
 
-      NS_LOG_DEBUG("-----------");
+  for (size_t i = 0; i < tasks.size(); i++) {
+    if (i == 0 || tasks[i].node != tasks[i - 1].node) {
+      NS_LOG_DEBUG("Reachability from Node: " << tasks[i].node->GetId() << " ("
+                                              << Names::FindName(tasks[i].node) << ")");
+    }
+    NS_LOG_DEBUG("-----------");
 
-      dijkstra_shortest_paths(graph, source,
-                              // predecessor_map (boost::ref(predecessors))
-                              // .
-                              distance_map(boost::ref(distances))
-                                .distance_inf(boost::WeightInf)
-                                .distance_zero(boost::WeightZero)
-                                .distance_compare(boost::WeightCompare())
-                                .distance_combine(boost::WeightCombine()));
+    for (const auto& route : routes[i]) {
+      // only the task face is enabled, paths through the other faces of the source are dropped
+      if (route.face != tasks[i].face)
+        continue;
 
-      // NS_LOG_DEBUG (predecessors.size () << ", " << distances.size ());
+      for (const auto& prefix : graph.getRouter(route.origin)->GetLocalPrefixes()) {
+        NS_LOG_DEBUG(" prefix " << *prefix << " reachable via face " << *route.face
+                     << " with distance " << route.metric);
 
-      for (const auto& dist : distances) {
-        if (dist.first == source)
-          continue;
-        else {
-          // cout << "  Node " << dist.first->GetObject<Node> ()->GetId ();
-          if (std::get<0>(dist.second) == 0) {
-            // cout << " is unreachable" << endl;
-          }
-          else {
-            for (const auto& prefix : dist.first->GetLocalPrefixes()) {
-              NS_LOG_DEBUG(" prefix " << *prefix << " reachable via face "
-                           << *std::get<0>(dist.second)
-                           << " with distance " << std::get<1>(dist.second)
-                           << " with delay " << std::get<2>(dist.second));
-
-              if (std::get<0>(dist.second)->getMetric() == std::numeric_limits<uint16_t>::max() - 1)
-                continue;
-
-              FibHelper::AddRoute(*node, *prefix, std::get<0>(dist.second),
-                                  std::get<1>(dist.second));
-            }
-          }
-        }
+        FibHelper::AddRoute(tasks[i].node, *prefix, graph.getFace(route.face), route.metric);
       }
-
-      // disabling the face again
-      face->setMetric(std::numeric_limits<uint16_t>::max() - 1);
-    }
-
-    // recover original interface statuses
-    for (auto& i : originalMetrics) {
-      l3->getFaceTable().get(i.first)->setMetric(i.second);
     }
   }
 }
@@ -124,9 +124,24 @@ public:
   static void
   CalculateAllPossibleRoutes();
 
+  /**
+   * @brief Set the number of threads computing shortest paths in CalculateRoutes() and
+   *        CalculateAllPossibleRoutes()
+   *
+   * Shortest paths are computed on a read-only copy of the graph and all routes are installed
+   * afterwards, in the same order and with the same result whatever the number of threads.
+   *
+   * @param nThreads number of threads, 0 (default) for one per hardware thread
+   */
+  static void
+  SetCalculationThreads(uint32_t nThreads);
+
 private:
   void
   Install(Ptr<Channel> channel);
+
+private:
+  static uint32_t m_nCalculationThreads;
 };
 
 } // namespace ndn
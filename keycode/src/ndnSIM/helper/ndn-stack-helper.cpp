@@ -43,6 +43,7 @@
 #include "ns3/ndnSIM/NFD/daemon/face/generic-link-service.hpp"
 #include "ns3/ndnSIM/NFD/daemon/table/cs-policy-priority-fifo.hpp"
 #include "ns3/ndnSIM/NFD/daemon/table/cs-policy-lru.hpp"
+#include "ns3/ndnSIM/NFD/daemon/table/bloom-dead-nonce-list.hpp"
 
 NS_LOG_COMPONENT_DEFINE("ndn.StackHelper");
 
@@ -61,6 +62,9 @@ StackHelper::StackHelper()
 
   m_csPolicyCreationFunc = m_csPolicies["nfd::cs::lru"];
 
+  m_dnlTypes.insert({"nfd::DeadNonceList", [] { return make_unique<nfd::DeadNonceList>(); }});
+  m_dnlTypes.insert({"nfd::BloomDeadNonceList", [] { return make_unique<nfd::BloomDeadNonceList>(); }});
+
   m_ndnFactory.SetTypeId("ns3::ndn::L3Protocol");
 
   m_netDeviceCallbacks.push_back(
@@ -132,6 +136,18 @@ StackHelper::setPolicy(const std::string& policy)
   }
 }
 
+void
+StackHelper::setDeadNonceList(const std::string& dnl)
+{
+  auto found = m_dnlTypes.find(dnl);
+  if (found != m_dnlTypes.end()) {
+    m_dnlCreationFunc = found->second;
+  }
+  else {
+    NS_FATAL_ERROR("Dead Nonce List " << dnl << " not found");
+  }
+}
+
 void
 StackHelper::Install(const NodeContainer& c) const
 {
@@ -172,9 +188,15 @@ StackHelper::doInstall(Ptr<Node> node) const
     ndn->getConfig().put("ndnSIM.disable_strategy_choice_manager", true);
   }
 
+  if (m_isManagementDisabled) {
+    ndn->getConfig().put("ndnSIM.disable_management", true);
+  }
+
+  ndn->getConfig().put("ndnSIM.name_tree_buckets", m_nNameTreeBuckets);
   ndn->getConfig().put("tables.cs_max_packets", m_maxCsSize);
 
   ndn->setCsReplacementPolicy(m_csPolicyCreationFunc);
+  ndn->setDeadNonceList(m_dnlCreationFunc);
 
   // Aggregate L3Protocol on node (must be after setting ndnSIM CS)
   node->AggregateObject(ndn);
@@ -383,6 +405,25 @@ StackHelper::disableForwarderStatusManager()
   m_isForwarderStatusManagerDisabled = true;
 }
 
+void
+StackHelper::disableManagement()
+{
+  m_isManagementDisabled = true;
+}
+
+void
+StackHelper::setNameTreeBuckets(size_t nBuckets)
+{
+  m_nNameTreeBuckets = nBuckets;
+}
+
+void
+StackHelper::setLeanProfile()
+{
+  disableManagement();
+  setNameTreeBuckets(16);
+}
+
 void
 StackHelper::SetLinkDelayAsFaceMetric()
 {
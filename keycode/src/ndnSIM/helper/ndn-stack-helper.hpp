@@ -31,6 +31,7 @@
 #include "ndn-strategy-choice-helper.hpp"
 
 namespace nfd {
+class DeadNonceListBase;
 namespace cs {
 class Policy;
 } // namespace cs
@@ -85,6 +86,15 @@ public:
   void
   setPolicy(const std::string& policy);
 
+  /**
+   * @brief Set the Dead Nonce List implementation of NFD's forwarder
+   *
+   * Available implementations are "nfd::DeadNonceList" (default, exact 64-bit hashes)
+   * and "nfd::BloomDeadNonceList" (time-sliced Bloom filters, a few bytes per nonce).
+   */
+  void
+  setDeadNonceList(const std::string& dnl);
+
   typedef Callback<shared_ptr<Face>, Ptr<Node>, Ptr<L3Protocol>, Ptr<NetDevice>>
     FaceCreateCallback;
 
@@ -221,6 +231,39 @@ public:
   void
   disableForwarderStatusManager();
 
+  /**
+   * \brief Disable NFD management and RIB
+   *
+   * Nodes are installed without dispatcher, managers, internal faces and RIB service, and
+   * with a single strategy instance for "/".  FibHelper and StrategyChoiceHelper then update
+   * the tables directly; ndn::Face prefix registrations are not served, so applications must
+   * get their routes from FibHelper or GlobalRoutingHelper.
+   */
+  void
+  disableManagement();
+
+  /**
+   * \brief Set the initial number of NameTree buckets of each node (1024 by default)
+   *
+   * The NameTree grows as entries are added, a small value only saves memory on nodes
+   * with few names.
+   */
+  void
+  setNameTreeBuckets(size_t nBuckets);
+
+  /**
+   * \brief Install nodes with the smallest footprint, for topologies of many thousand nodes
+   *
+   * Disables management and starts with 16 NameTree buckets.  The Dead Nonce List of a node
+   * is allocated only when the node records its first Nonce; the other tables are created at
+   * install time as usual, and every node has its own tables and strategy instances.
+   *
+   * Strategies that use the RIB or Strategy Choice manager, such as self-learning, cannot run
+   * without management.
+   */
+  void
+  setLeanProfile();
+
   /**
    * @brief Set face metric of all faces connected through PointToPoint channel to channel latency
    */
@@ -246,6 +289,8 @@ private:
 
   bool m_isForwarderStatusManagerDisabled;
   bool m_isStrategyChoiceManagerDisabled;
+  bool m_isManagementDisabled = false;
+  size_t m_nNameTreeBuckets = 1024;
 
 public:
   void
@@ -262,6 +307,11 @@ private:
 
   std::map<std::string, PolicyCreationCallback> m_csPolicies;
 
+  typedef std::function<std::unique_ptr<nfd::DeadNonceListBase>()> DeadNonceListCreationCallback;
+  DeadNonceListCreationCallback m_dnlCreationFunc;
+
+  std::map<std::string, DeadNonceListCreationCallback> m_dnlTypes;
+
   typedef std::list<std::pair<TypeId, FaceCreateCallback>> NetDeviceCallbackList;
   NetDeviceCallbackList m_netDeviceCallbacks;
 };
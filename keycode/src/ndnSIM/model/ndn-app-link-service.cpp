@@ -32,11 +32,37 @@ NS_LOG_COMPONENT_DEFINE("ndn.AppLinkService");
 namespace ns3 {
 namespace ndn {
 
-AppLinkService::AppLinkService(Ptr<App> app)
+std::deque<AppLinkService::Deferred> AppLinkService::s_deferred;
+int AppLinkService::s_nOngoingCalls = 0;
+int AppLinkService::s_nScopes = 0;
+bool AppLinkService::s_isDrainScheduled = false;
+bool AppLinkService::s_isResetScheduled = false;
+
+AppLinkService::DeliveryScope::DeliveryScope()
+{
+  ++s_nScopes;
+}
+
+AppLinkService::DeliveryScope::~DeliveryScope()
+{
+  if (--s_nScopes > 0 || s_deferred.empty()) {
+    return;
+  }
+
+  if (s_nOngoingCalls == 0) {
+    drainDeferred();
+  }
+  else if (!s_isDrainScheduled) {
+    scheduleDrain();
+  }
+}
+
+AppLinkService::AppLinkService(Ptr<App> app, bool isSynchronous)
   : m_node(app->GetNode())
   , m_app(app)
+  , m_isSynchronous(isSynchronous)
 {
-  NS_LOG_FUNCTION(this << app);
+  NS_LOG_FUNCTION(this << app << isSynchronous);
 
   NS_ASSERT(m_app != 0);
 }
@@ -51,6 +77,11 @@ AppLinkService::doSendInterest(const Interest& interest)
 {
   NS_LOG_FUNCTION(this << &interest);
 
+  if (m_isSynchronous) {
+    deliver({m_app, nullptr, interest.shared_from_this(), nullptr, nullptr});
+    return;
+  }
+
   // to decouple callbacks
   Simulator::ScheduleNow(&App::OnInterest, m_app, interest.shared_from_this());
 }
@@ -60,6 +91,11 @@ AppLinkService::doSendData(const Data& data)
 {
   NS_LOG_FUNCTION(this << &data);
 
+  if (m_isSynchronous) {
+    deliver({m_app, nullptr, nullptr, data.shared_from_this(), nullptr});
+    return;
+  }
+
   // to decouple callbacks
   Simulator::ScheduleNow(&App::OnData, m_app, data.shared_from_this());
 }
@@ -69,28 +105,153 @@ AppLinkService::doSendNack(const lp::Nack& nack)
 {
   NS_LOG_FUNCTION(this << &nack);
 
+  if (m_isSynchronous) {
+    deliver({m_app, nullptr, nullptr, nullptr, make_shared<lp::Nack>(nack)});
+    return;
+  }
+
   // to decouple callbacks
   Simulator::ScheduleNow(&App::OnNack, m_app, make_shared<lp::Nack>(nack));
 }
 
 //
 
+template<class Packet>
+static shared_ptr<const Packet>
+sharePacket(const Packet& packet)
+{
+  // applications usually send packets they own through a shared_ptr
+  shared_ptr<const Packet> shared = packet.weak_from_this().lock();
+  return shared != nullptr ? shared : make_shared<Packet>(packet);
+}
+
 void
 AppLinkService::onReceiveInterest(const Interest& interest)
 {
+  if (s_nOngoingCalls > 0) {
+    // the forwarder is busy with the packet being handed to an application
+    defer({m_app, this, sharePacket(interest), nullptr, nullptr});
+    return;
+  }
+
+  ++s_nOngoingCalls;
   this->receiveInterest(interest, 0);
+  --s_nOngoingCalls;
 }
 
 void
 AppLinkService::onReceiveData(const Data& data)
 {
+  if (s_nOngoingCalls > 0) {
+    defer({m_app, this, nullptr, sharePacket(data), nullptr});
+    return;
+  }
+
+  ++s_nOngoingCalls;
   this->receiveData(data, 0);
+  --s_nOngoingCalls;
 }
 
 void
 AppLinkService::onReceiveNack(const lp::Nack& nack)
 {
+  if (s_nOngoingCalls > 0) {
+    defer({m_app, this, nullptr, nullptr, make_shared<lp::Nack>(nack)});
+    return;
+  }
+
+  ++s_nOngoingCalls;
   this->receiveNack(nack, 0);
+  --s_nOngoingCalls;
+}
+
+//
+
+void
+AppLinkService::deliver(Deferred&& deferred)
+{
+  if (s_nOngoingCalls > 0) {
+    // an application is still sending the packet that led to this one
+    defer(std::move(deferred));
+    return;
+  }
+
+  ++s_nOngoingCalls;
+  if (deferred.link != nullptr) {
+    if (deferred.interest != nullptr) {
+      deferred.link->receiveInterest(*deferred.interest, 0);
+    }
+    else if (deferred.data != nullptr) {
+      deferred.link->receiveData(*deferred.data, 0);
+    }
+    else {
+      deferred.link->receiveNack(*deferred.nack, 0);
+    }
+  }
+  else if (deferred.interest != nullptr) {
+    deferred.app->OnInterest(deferred.interest);
+  }
+  else if (deferred.data != nullptr) {
+    deferred.app->OnData(deferred.data);
+  }
+  else {
+    deferred.app->OnNack(deferred.nack);
+  }
+  --s_nOngoingCalls;
+}
+
+void
+AppLinkService::defer(Deferred&& deferred)
+{
+  s_deferred.push_back(std::move(deferred));
+
+  // the end of the outermost scope drains the packets without an event
+  if (s_nScopes == 0 && !s_isDrainScheduled) {
+    scheduleDrain();
+  }
+}
+
+void
+AppLinkService::scheduleDrain()
+{
+  if (!s_isResetScheduled) {
+    // packets still deferred when the simulation is destroyed are dropped with it
+    s_isResetScheduled = true;
+    Simulator::ScheduleDestroy(&AppLinkService::reset);
+  }
+
+  s_isDrainScheduled = true;
+  Simulator::ScheduleNow(&AppLinkService::onDrainEvent);
+}
+
+void
+AppLinkService::onDrainEvent()
+{
+  s_isDrainScheduled = false;
+  drainDeferred();
+}
+
+void
+AppLinkService::reset()
+{
+  s_deferred.clear();
+  s_isDrainScheduled = false;
+  s_isResetScheduled = false;
+}
+
+void
+AppLinkService::drainDeferred()
+{
+  NS_ASSERT(s_nOngoingCalls == 0);
+
+  // packets deferred while draining are handed over by the same loop
+  ++s_nScopes;
+  while (!s_deferred.empty()) {
+    Deferred deferred = std::move(s_deferred.front());
+    s_deferred.pop_front();
+    deliver(std::move(deferred));
+  }
+  --s_nScopes;
 }
 
 } // namespace ndn
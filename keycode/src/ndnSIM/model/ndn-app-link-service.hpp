@@ -23,6 +23,8 @@
 #include "ns3/ndnSIM/model/ndn-common.hpp"
 #include "ns3/ndnSIM/NFD/daemon/face/link-service.hpp"
 
+#include <deque>
+
 namespace ns3 {
 
 class Packet;
@@ -36,15 +38,40 @@ class App;
  * \ingroup ndn-face
  * \brief Implementation of LinkService for ndnSIM application
  *
+ * By default, every packet for the application is handed over in a new ScheduleNow event.
+ * A synchronous link service calls the application right away instead, unless the call would
+ * re-enter the forwarder or an application that is still sending: such packets, and the
+ * packets that applications send while being called, are deferred and handed over in order
+ * once the outermost call has returned, at the end of a DeliveryScope or in one event for the
+ * whole batch.
+ *
  * \see NetDeviceLinkService
  */
 class AppLinkService : public nfd::face::LinkService
 {
+public:
+  /**
+   * \brief Scope in which deferred packets wait for the end of the scope rather than for a
+   *        new event
+   *
+   * Meant for the entry points of the simulator events that run the forwarder, e.g. the
+   * reception of a packet from a NetDevice.
+   */
+  class DeliveryScope : boost::noncopyable
+  {
+  public:
+    DeliveryScope();
+
+    ~DeliveryScope();
+  };
+
 public:
   /**
    * \brief Default constructor
+   * \param isSynchronous whether packets for the application are handed over without a new
+   *        event
    */
-  AppLinkService(Ptr<App> app);
+  AppLinkService(Ptr<App> app, bool isSynchronous = false);
 
   virtual ~AppLinkService();
 
@@ -75,9 +102,46 @@ private:
     BOOST_ASSERT(false);
   }
 
+  /**
+   * \brief Packet waiting to be handed over to an application or to the forwarder
+   */
+  struct Deferred
+  {
+    Ptr<App> app;
+    AppLinkService* link; ///< nullptr for packets to the application
+    shared_ptr<const Interest> interest;
+    shared_ptr<const Data> data;
+    shared_ptr<const lp::Nack> nack;
+  };
+
+  static void
+  deliver(Deferred&& deferred);
+
+  static void
+  defer(Deferred&& deferred);
+
+  static void
+  scheduleDrain();
+
+  static void
+  onDrainEvent();
+
+  static void
+  drainDeferred();
+
+  static void
+  reset();
+
 private:
   Ptr<Node> m_node;
   Ptr<App> m_app;
+  bool m_isSynchronous;
+
+  static std::deque<Deferred> s_deferred;
+  static int s_nOngoingCalls; ///< calls into applications and from applications into forwarders
+  static int s_nScopes;
+  static bool s_isDrainScheduled;
+  static bool s_isResetScheduled;
 };
 
 } // namespace ndn
@@ -19,16 +19,13 @@
 
 #include "ndn-block-header.hpp"
 
-#include <iosfwd>
-#include <boost/iostreams/concepts.hpp>
-#include <boost/iostreams/stream.hpp>
+#include <array>
 
 #include <ndn-cxx/encoding/tlv.hpp>
 #include <ndn-cxx/interest.hpp>
 #include <ndn-cxx/data.hpp>
 #include <ndn-cxx/lp/packet.hpp>
 
-namespace io = boost::iostreams;
 namespace nfdFace = nfd::face;
 
 namespace ns3 {
@@ -70,40 +67,36 @@ BlockHeader::GetSerializedSize(void) const
 void
 BlockHeader::Serialize(ns3::Buffer::Iterator start) const
 {
-  start.Write(m_block.wire(), m_block.size());
+  // header fields and payload are written from their own buffers, without encoding
+  // a composite block into an intermediate buffer first
+  m_block.gather([&start] (::ndn::span<const uint8_t> part) {
+    start.Write(part.data(), part.size());
+  });
 }
 
-class Ns3BufferIteratorSource : public io::source {
-public:
-  Ns3BufferIteratorSource(ns3::Buffer::Iterator& is)
-    : m_is(is)
-  {
-  }
-
-  std::streamsize
-  read(char* buf, std::streamsize nMaxRead)
-  {
-    std::streamsize i = 0;
-    for (; i < nMaxRead && !m_is.IsEnd(); ++i) {
-      buf[i] = m_is.ReadU8();
-    }
-    if (i == 0) {
-      return -1;
-    }
-    else {
-      return i;
-    }
-  }
-
-private:
-  ns3::Buffer::Iterator& m_is;
-};
-
 uint32_t
 BlockHeader::Deserialize(ns3::Buffer::Iterator start)
 {
-  io::stream<Ns3BufferIteratorSource> is(start);
-  m_block = ::ndn::Block::fromStream(is);
+  // TLV-TYPE and TLV-LENGTH take at most 9 bytes each
+  std::array<uint8_t, 18> tl;
+  uint32_t nRemaining = start.GetRemainingSize();
+  ns3::Buffer::Iterator peek = start;
+  peek.Read(tl.data(), std::min<uint32_t>(tl.size(), nRemaining));
+
+  auto pos = tl.cbegin();
+  auto end = pos + std::min<uint32_t>(tl.size(), nRemaining);
+  ::ndn::tlv::readType(pos, end);
+  uint64_t length = ::ndn::tlv::readVarNumber(pos, end);
+  size_t tlSize = std::distance(tl.cbegin(), pos);
+  if (length > nRemaining - tlSize) {
+    throw ::ndn::tlv::Error("Not enough bytes in the packet to fully parse TLV");
+  }
+
+  // the TLV is copied once, into the buffer that the block then shares; trailing bytes, such as
+  // link layer padding, are left in the packet
+  auto buffer = std::make_shared<::ndn::Buffer>(tlSize + length);
+  start.Read(buffer->data(), buffer->size());
+  m_block = Block(std::move(buffer));
   return m_block.size();
 }
 
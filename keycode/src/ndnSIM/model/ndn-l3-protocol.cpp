@@ -194,6 +194,7 @@ private:
   nfd::ConfigSection m_config;
 
   PolicyCreationCallback m_policy;
+  DeadNonceListCreationCallback m_deadNonceList;
 };
 
 L3Protocol::L3Protocol()
@@ -211,11 +212,13 @@ void
 L3Protocol::initialize()
 {
   m_impl->m_faceTable = make_unique<::nfd::FaceTable>();
-  m_impl->m_forwarder = make_shared<::nfd::Forwarder>(*m_impl->m_faceTable);
-  m_impl->m_faceSystem = make_unique<::nfd::face::FaceSystem>(*m_impl->m_faceTable, nullptr);
+  m_impl->m_forwarder = make_shared<::nfd::Forwarder>(*m_impl->m_faceTable,
+                                                      this->getConfig().get<size_t>("ndnSIM.name_tree_buckets", 1024));
 
   initializeManagement();
-  initializeRibManager();
+  if (isManagementEnabled()) {
+    initializeRibManager();
+  }
 
   m_impl->m_forwarder->beforeSatisfyInterest.connect(std::ref(m_satisfiedInterests));
   m_impl->m_forwarder->beforeExpirePendingInterest.connect(std::ref(m_timedOutInterests));
@@ -242,9 +245,17 @@ private:
   std::vector<std::string> m_ignored;
 };
 
+bool
+L3Protocol::isManagementEnabled()
+{
+  return !this->getConfig().get<bool>("ndnSIM.disable_management", false);
+}
+
 void
 L3Protocol::injectInterest(const Interest& interest)
 {
+  NS_ASSERT_MSG(m_impl->m_internalClientFaceForInjects != nullptr,
+                "Management is disabled on this node");
   m_impl->m_internalClientFaceForInjects->expressInterest(interest, nullptr, nullptr, nullptr);
 }
 
@@ -254,12 +265,47 @@ L3Protocol::setCsReplacementPolicy(const PolicyCreationCallback& policy)
   m_impl->m_policy = policy;
 }
 
+void
+L3Protocol::setDeadNonceList(const DeadNonceListCreationCallback& dnl)
+{
+  m_impl->m_deadNonceList = dnl;
+}
+
 void
 L3Protocol::initializeManagement()
 {
   auto& forwarder = m_impl->m_forwarder;
   using namespace nfd;
 
+  ConfigFile config(&ConfigFile::ignoreUnknownSection);
+
+  forwarder->getCs().setPolicy(m_impl->m_policy());
+
+  // the Dead Nonce List is allocated when the first Nonce is recorded
+  if (m_impl->m_deadNonceList) {
+    forwarder->setDeadNonceListFactory(m_impl->m_deadNonceList);
+  }
+  else {
+    forwarder->setDeadNonceListFactory([] { return make_unique<DeadNonceList>(); });
+  }
+
+  TablesConfigSection tablesConfig(*forwarder);
+  tablesConfig.setConfigFile(config);
+
+  if (!isManagementEnabled()) {
+    // without the management prefixes, every name is served by the strategy instance of "/"
+    auto& strategyChoice = this->getConfig().get_child("tables").get_child("strategy_choice");
+    strategyChoice.erase("/localhost");
+    strategyChoice.erase("/localhost/nfd");
+    strategyChoice.erase("/ndn/multicast");
+
+    config.parse(m_impl->m_config, false, "ndnSIM.conf");
+    tablesConfig.ensureConfigured();
+    return;
+  }
+
+  m_impl->m_faceSystem = make_unique<::nfd::face::FaceSystem>(*m_impl->m_faceTable, nullptr);
+
   std::tie(m_impl->m_internalFace, m_impl->m_internalClientFace) = face::makeInternalFace(StackHelper::getKeyChain());
   m_impl->m_faceTable->addReserved(m_impl->m_internalFace, face::FACEID_INTERNAL_FACE);
 
@@ -286,13 +332,6 @@ L3Protocol::initializeManagement()
     this->getConfig().get_child("authorizations").get_child("authorize").get_child("privileges").erase("strategy-choice");
   }
 
-  ConfigFile config(&ConfigFile::ignoreUnknownSection);
-
-  forwarder->getCs().setPolicy(m_impl->m_policy());
-
-  TablesConfigSection tablesConfig(*forwarder);
-  tablesConfig.setConfigFile(config);
-
   m_impl->m_authenticator->setConfigFile(config);
 
   // if (!this->getConfig().get<bool>("ndnSIM.disable_face_manager", false)) {
@@ -345,12 +384,20 @@ L3Protocol::getFibManager()
 nfd::StrategyChoiceManager&
 L3Protocol::getStrategyChoiceManager()
 {
+  if (m_impl->m_strategyChoiceManager == nullptr) {
+    NS_FATAL_ERROR("Strategy Choice manager is not available, management is disabled on node "
+                   << GetObject<Node>()->GetId());
+  }
   return *m_impl->m_strategyChoiceManager;
 }
 
 ::nfd::rib::Service&
 L3Protocol::getRibService()
 {
+  if (m_impl->m_ribService == nullptr) {
+    NS_FATAL_ERROR("RIB service is not available, management is disabled on node "
+                   << GetObject<Node>()->GetId());
+  }
   return *m_impl->m_ribService;
 }
 
@@ -37,6 +37,7 @@ class Forwarder;
 class FibManager;
 class FaceTable;
 class StrategyChoiceManager;
+class DeadNonceListBase;
 typedef boost::property_tree::ptree ConfigSection;
 namespace pit {
 class Entry;
@@ -116,13 +117,31 @@ public:
 
   /**
    * \brief Get nfd::StrategyChoiceManager, used by node's NFD
+   *
+   * Not available when management is disabled: the simulation is then aborted.
    */
   nfd::StrategyChoiceManager&
   getStrategyChoiceManager();
 
+  /**
+   * \brief Get the RIB service of node's NFD
+   *
+   * Not available when management is disabled, e.g., to a self-learning strategy: the
+   * simulation is then aborted.
+   */
   ::nfd::rib::Service&
   getRibService();
 
+  /**
+   * \brief Check whether node's NFD runs its management and RIB
+   *
+   * Management is disabled with the "ndnSIM.disable_management" config option, see
+   * StackHelper::disableManagement().  Without it, the helpers change the FIB and the
+   * Strategy Choice table directly, and ndn::Face prefix registrations are not served.
+   */
+  bool
+  isManagementEnabled();
+
   /**
    * \brief Add face to NDN stack
    *
@@ -162,6 +181,8 @@ public:
 
   /**
    * \brief Inject interest through internal Face
+   *
+   * Not available when management is disabled.
    */
   void
   injectInterest(const Interest& interest);
@@ -174,6 +195,16 @@ public:
   void
   setCsReplacementPolicy(const PolicyCreationCallback& policy);
 
+  typedef std::function<std::unique_ptr<nfd::DeadNonceListBase>()> DeadNonceListCreationCallback;
+
+  /**
+   * \brief Set the Dead Nonce List implementation of NFD's forwarder
+   *
+   * If not set, the forwarder keeps its default nfd::DeadNonceList.
+   */
+  void
+  setDeadNonceList(const DeadNonceListCreationCallback& dnl);
+
 public: // Workaround for python bindings
   static Ptr<L3Protocol>
   getL3Protocol(Ptr<Object> node);
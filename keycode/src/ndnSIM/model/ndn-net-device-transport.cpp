@@ -21,6 +21,7 @@
 
 #include "../helper/ndn-stack-helper.hpp"
 #include "ndn-block-header.hpp"
+#include "ndn-app-link-service.hpp"
 #include "../utils/ndn-ns3-packet-tag.hpp"
 
 #include <ndn-cxx/encoding/block.hpp>
@@ -50,6 +51,7 @@ NetDeviceTransport::NetDeviceTransport(Ptr<Node> node,
   this->setPersistency(persistency);
   this->setLinkType(linkType);
   this->setMtu(m_netDevice->GetMtu()); // Use the MTU of the netDevice
+  this->setCanSendComposite(true); // BlockHeader gathers the packet into the ns-3 buffer
 
   // Get send queue capacity for congestion marking
   PointerValue txQueueAttribute;
@@ -132,13 +134,22 @@ NetDeviceTransport::receiveFromNetDevice(Ptr<NetDevice> device,
 {
   NS_LOG_FUNCTION(device << p << protocol << from << to << packetType);
 
-  // Convert NS3 packet to NFD packet
-  Ptr<ns3::Packet> packet = p->Copy();
-
-  BlockHeader header;
-  packet->RemoveHeader(header);
+  // Convert NS3 packet to NFD packet: the TLV is copied once, straight out of the received packet,
+  // into the buffer that the block then shares
+  auto buffer = make_shared<::ndn::Buffer>(p->GetSize());
+  p->CopyData(buffer->data(), buffer->size());
+
+  bool isOk = false;
+  Block block;
+  std::tie(isOk, block) = Block::fromBuffer(std::move(buffer));
+  if (!isOk) {
+    NS_LOG_WARN("Dropping a packet that is not a complete TLV block");
+    return;
+  }
 
-  this->receive(std::move(header.getBlock()));
+  // synchronous applications reached by this packet reply at the end of the scope
+  AppLinkService::DeliveryScope scope;
+  this->receive(std::move(block));
 }
 
 Ptr<NetDevice>
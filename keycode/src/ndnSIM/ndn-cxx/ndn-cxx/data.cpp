@@ -31,6 +31,8 @@ BOOST_CONCEPT_ASSERT((WireDecodable<Data>));
 static_assert(std::is_base_of<tlv::Error, Data::Error>::value,
               "Data::Error must inherit from tlv::Error");
 
+bool Data::s_lazyDecoding = false;
+
 Data::Data(const Name& name)
   : m_name(name)
 {
@@ -57,14 +59,14 @@ Data::wireEncode(EncodingImpl<TAG>& encoder, bool wantUnsignedPortionOnly) const
 
   // SignatureValue
   if (!wantUnsignedPortionOnly) {
-    if (!m_signatureInfo) {
+    if (!getSignatureInfo()) {
       NDN_THROW(Error("Requested wire format, but Data has not been signed"));
     }
     totalLength += prependBlock(encoder, m_signatureValue);
   }
 
   // SignatureInfo
-  totalLength += m_signatureInfo.wireEncode(encoder, SignatureInfo::Type::Data);
+  totalLength += getSignatureInfo().wireEncode(encoder, SignatureInfo::Type::Data);
 
   // Content
   if (hasContent()) {
@@ -72,7 +74,7 @@ Data::wireEncode(EncodingImpl<TAG>& encoder, bool wantUnsignedPortionOnly) const
   }
 
   // MetaInfo
-  totalLength += m_metaInfo.wireEncode(encoder);
+  totalLength += getMetaInfo().wireEncode(encoder);
 
   // Name
   totalLength += m_name.wireEncode(encoder);
@@ -147,6 +149,8 @@ Data::wireDecode(const Block& wire)
   m_content = {};
   m_signatureInfo = {};
   m_signatureValue = {};
+  m_pendingMetaInfo = {};
+  m_pendingSignatureInfo = {};
   m_fullName.clear();
 
   int lastElement = 1; // last recognized element index, in spec order
@@ -156,7 +160,12 @@ Data::wireDecode(const Block& wire)
         if (lastElement >= 2) {
           NDN_THROW(Error("MetaInfo element is out of order"));
         }
-        m_metaInfo.wireDecode(*element);
+        if (s_lazyDecoding) {
+          m_pendingMetaInfo = *element;
+        }
+        else {
+          m_metaInfo.wireDecode(*element);
+        }
         lastElement = 2;
         break;
       }
@@ -172,7 +181,12 @@ Data::wireDecode(const Block& wire)
         if (lastElement >= 4) {
           NDN_THROW(Error("SignatureInfo element is out of order"));
         }
-        m_signatureInfo.wireDecode(*element);
+        if (s_lazyDecoding) {
+          m_pendingSignatureInfo = *element;
+        }
+        else {
+          m_signatureInfo.wireDecode(*element);
+        }
         lastElement = 4;
         break;
       }
@@ -195,7 +209,7 @@ Data::wireDecode(const Block& wire)
     }
   }
 
-  if (!m_signatureInfo) {
+  if (!m_signatureInfo && !m_pendingSignatureInfo.isValid()) {
     NDN_THROW(Error("SignatureInfo element is missing"));
   }
   if (!m_signatureValue.isValid()) {
@@ -203,6 +217,35 @@ Data::wireDecode(const Block& wire)
   }
 }
 
+void
+Data::decodePendingMetaInfo() const
+{
+  BOOST_ASSERT(m_pendingMetaInfo.isValid());
+  try {
+    m_metaInfo.wireDecode(m_pendingMetaInfo);
+  }
+  catch (const tlv::Error&) {
+    // leave the element pending, so that every access reports the error
+    m_metaInfo = {};
+    throw;
+  }
+  m_pendingMetaInfo = {};
+}
+
+void
+Data::decodePendingSignatureInfo() const
+{
+  BOOST_ASSERT(m_pendingSignatureInfo.isValid());
+  try {
+    m_signatureInfo.wireDecode(m_pendingSignatureInfo);
+  }
+  catch (const tlv::Error&) {
+    m_signatureInfo = {};
+    throw;
+  }
+  m_pendingSignatureInfo = {};
+}
+
 const Name&
 Data::getFullName() const
 {
@@ -210,8 +253,10 @@ Data::getFullName() const
     if (!m_wire.hasWire()) {
       NDN_THROW(Error("Cannot compute full name because Data has no wire encoding (not signed)"));
     }
+    uint8_t digest[util::Sha256::DIGEST_SIZE];
+    util::Sha256::computeDigest({m_wire}, digest);
     m_fullName = m_name;
-    m_fullName.appendImplicitSha256Digest(util::Sha256::computeDigest(m_wire));
+    m_fullName.appendImplicitSha256Digest(digest);
   }
 
   return m_fullName;
@@ -238,6 +283,7 @@ Data&
 Data::setMetaInfo(const MetaInfo& metaInfo)
 {
   m_metaInfo = metaInfo;
+  m_pendingMetaInfo = {};
   resetWire();
   return *this;
 }
@@ -302,6 +348,7 @@ Data&
 Data::setSignatureInfo(const SignatureInfo& info)
 {
   m_signatureInfo = info;
+  m_pendingSignatureInfo = {};
   resetWire();
   return *this;
 }
@@ -335,7 +382,7 @@ Data::extractSignedRanges() const
 Data&
 Data::setContentType(uint32_t type)
 {
-  if (type != m_metaInfo.getType()) {
+  if (type != getMetaInfo().getType()) {
     m_metaInfo.setType(type);
     resetWire();
   }
@@ -345,7 +392,7 @@ Data::setContentType(uint32_t type)
 Data&
 Data::setFreshnessPeriod(time::milliseconds freshnessPeriod)
 {
-  if (freshnessPeriod != m_metaInfo.getFreshnessPeriod()) {
+  if (freshnessPeriod != getMetaInfo().getFreshnessPeriod()) {
     m_metaInfo.setFreshnessPeriod(freshnessPeriod);
     resetWire();
   }
@@ -355,7 +402,7 @@ Data::setFreshnessPeriod(time::milliseconds freshnessPeriod)
 Data&
 Data::setFinalBlock(optional<name::Component> finalBlockId)
 {
-  if (finalBlockId != m_metaInfo.getFinalBlock()) {
+  if (finalBlockId != getMetaInfo().getFinalBlock()) {
     m_metaInfo.setFinalBlock(std::move(finalBlockId));
     resetWire();
   }
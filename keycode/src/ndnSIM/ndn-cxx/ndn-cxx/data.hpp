@@ -136,10 +136,14 @@ public: // Data fields
   setName(const Name& name);
 
   /** @brief Get MetaInfo
+   *  @throw tlv::Error MetaInfo deferred by lazy decoding is malformed
    */
   const MetaInfo&
-  getMetaInfo() const noexcept
+  getMetaInfo() const
   {
+    if (m_pendingMetaInfo.isValid()) {
+      decodePendingMetaInfo();
+    }
     return m_metaInfo;
   }
 
@@ -224,10 +228,14 @@ public: // Data fields
   unsetContent();
 
   /** @brief Get SignatureInfo
+   *  @throw tlv::Error SignatureInfo deferred by lazy decoding is malformed
    */
   const SignatureInfo&
-  getSignatureInfo() const noexcept
+  getSignatureInfo() const
   {
+    if (m_pendingSignatureInfo.isValid()) {
+      decodePendingSignatureInfo();
+    }
     return m_signatureInfo;
   }
 
@@ -274,7 +282,7 @@ public: // MetaInfo fields
   uint32_t
   getContentType() const
   {
-    return m_metaInfo.getType();
+    return getMetaInfo().getType();
   }
 
   Data&
@@ -283,7 +291,7 @@ public: // MetaInfo fields
   time::milliseconds
   getFreshnessPeriod() const
   {
-    return m_metaInfo.getFreshnessPeriod();
+    return getMetaInfo().getFreshnessPeriod();
   }
 
   Data&
@@ -292,7 +300,7 @@ public: // MetaInfo fields
   const optional<name::Component>&
   getFinalBlock() const
   {
-    return m_metaInfo.getFinalBlock();
+    return getMetaInfo().getFinalBlock();
   }
 
   Data&
@@ -303,17 +311,60 @@ public: // SignatureInfo fields
    *  @return tlv::SignatureTypeValue, or -1 to indicate the signature is invalid
    */
   int32_t
-  getSignatureType() const noexcept
+  getSignatureType() const
   {
-    return m_signatureInfo.getSignatureType();
+    return getSignatureInfo().getSignatureType();
   }
 
   /** @brief Get KeyLocator
    */
   optional<KeyLocator>
-  getKeyLocator() const noexcept
+  getKeyLocator() const
   {
-    return m_signatureInfo.hasKeyLocator() ? make_optional(m_signatureInfo.getKeyLocator()) : nullopt;
+    const auto& info = getSignatureInfo();
+    return info.hasKeyLocator() ? make_optional(info.getKeyLocator()) : nullopt;
+  }
+
+public: // lazy decoding
+  static bool
+  getLazyDecoding()
+  {
+    return s_lazyDecoding;
+  }
+
+  /** @brief Enable or disable lazy decoding in wireDecode()
+   *
+   *  With lazy decoding, wireDecode() indexes every top-level element and decodes the Name,
+   *  but keeps MetaInfo and SignatureInfo undecoded until getMetaInfo() or getSignatureInfo()
+   *  (or a getter of one of their fields) is first called. Content and SignatureValue are never
+   *  copied in either mode.
+   *
+   *  These getters can therefore throw, and are not `noexcept` since lazy decoding was added.
+   *  The first call also modifies the packet: a lazily decoded Data must be read by a single
+   *  thread, unless decodeDeferred() is called before the packet is shared.
+   */
+  static void
+  setLazyDecoding(bool b)
+  {
+    s_lazyDecoding = b;
+  }
+
+  /** @brief Decode the elements deferred by lazy decoding
+   *
+   *  Afterwards, no const member function modifies the decoded fields, so the const getters of
+   *  this Data can be called from several threads.
+   *
+   *  @throw tlv::Error a deferred element is malformed
+   */
+  void
+  decodeDeferred() const
+  {
+    if (m_pendingMetaInfo.isValid()) {
+      decodePendingMetaInfo();
+    }
+    if (m_pendingSignatureInfo.isValid()) {
+      decodePendingSignatureInfo();
+    }
   }
 
 protected:
@@ -324,12 +375,25 @@ protected:
   resetWire();
 
 private:
+  void
+  decodePendingMetaInfo() const;
+
+  void
+  decodePendingSignatureInfo() const;
+
+private:
+  static bool s_lazyDecoding;
+
   Name m_name;
-  MetaInfo m_metaInfo;
+  mutable MetaInfo m_metaInfo;
   Block m_content;
-  SignatureInfo m_signatureInfo;
+  mutable SignatureInfo m_signatureInfo;
   Block m_signatureValue;
 
+  // MetaInfo and SignatureInfo elements whose decoding was deferred by lazy decoding
+  mutable Block m_pendingMetaInfo;
+  mutable Block m_pendingSignatureInfo;
+
   mutable Block m_wire;
   mutable Name m_fullName; // cached FullName computed from m_wire
 };
@@ -22,6 +22,21 @@
 #ifndef NDN_CXX_DETAIL_ASIO_FWD_HPP
 #define NDN_CXX_DETAIL_ASIO_FWD_HPP
 
+#include <boost/version.hpp>
+
+namespace boost {
+namespace asio {
+
+#if BOOST_VERSION >= 106600
+class io_context;
+using io_service = io_context;
+#else
+class io_service;
+#endif // BOOST_VERSION >= 106600
+
+} // namespace asio
+} // namespace boost
+
 namespace ndn {
 
 class DummyIoService
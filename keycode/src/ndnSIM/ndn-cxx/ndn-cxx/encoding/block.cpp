@@ -408,6 +408,80 @@ Block::encode(EncodingBuffer& encoder)
   return len;
 }
 
+void
+Block::compose()
+{
+  if (hasWire() || hasValue())
+    return;
+
+  size_t len = 0;
+  for (Block& element : m_elements) {
+    element.compose();
+    len += element.size();
+  }
+  m_size = tlv::sizeOfVarNumber(m_type) + tlv::sizeOfVarNumber(len) + len;
+}
+
+static size_t
+writeVarNumber(uint8_t* out, uint64_t number)
+{
+  size_t nBytes = 0;
+  if (number < 253) {
+    out[0] = static_cast<uint8_t>(number);
+    return 1;
+  }
+  else if (number <= std::numeric_limits<uint16_t>::max()) {
+    out[0] = 253;
+    nBytes = 2;
+  }
+  else if (number <= std::numeric_limits<uint32_t>::max()) {
+    out[0] = 254;
+    nBytes = 4;
+  }
+  else {
+    out[0] = 255;
+    nBytes = 8;
+  }
+
+  for (size_t i = nBytes; i > 0; --i) {
+    out[i] = static_cast<uint8_t>(number);
+    number >>= 8;
+  }
+  return 1 + nBytes;
+}
+
+void
+Block::gather(const GatherCallback& write) const
+{
+  if (!isValid()) {
+    NDN_THROW(Error("Cannot gather invalid block"));
+  }
+
+  if (hasWire()) {
+    write(make_span(&*m_begin, std::distance(m_begin, m_end)));
+    return;
+  }
+
+  EncodingEstimator estimator;
+  size_t valueSize = hasValue() ? value_size() : encodeValue(estimator);
+
+  uint8_t header[2 * 9];
+  size_t headerSize = writeVarNumber(header, m_type);
+  headerSize += writeVarNumber(header + headerSize, valueSize);
+  write(make_span(header, headerSize));
+
+  if (hasValue()) {
+    if (valueSize > 0) {
+      write(make_span(&*m_valueBegin, valueSize));
+    }
+    return;
+  }
+
+  for (const Block& element : m_elements) {
+    element.gather(write);
+  }
+}
+
 const Block&
 Block::get(uint32_t type) const
 {
@@ -366,6 +366,32 @@ public: // sub-elements
   void
   encode();
 
+  /** @brief Compute the size of sub-elements without encoding them into TLV-VALUE
+   *
+   *  Unlike encode(), the sub-elements are not copied into a new buffer: each of them keeps
+   *  referencing its own buffer, so the block can refer to header fields and to a shared payload
+   *  at the same time. Such a composite block can be written out with gather().
+   *  This method has no effect if hasWire() or hasValue() is true.
+   *  @post size() includes all sub-elements
+   */
+  void
+  compose();
+
+  /** @brief Callback that receives one contiguous part of the TLV encoding
+   */
+  using GatherCallback = std::function<void(span<const uint8_t>)>;
+
+  /** @brief Invoke @p write with the TLV encoding of this block, one contiguous part at a time
+   *
+   *  A block that hasWire() is a single part. Otherwise, TLV-TYPE and TLV-LENGTH are followed
+   *  by TLV-VALUE if hasValue(), or by the parts of each sub-element, so that the encoding can be
+   *  copied straight into its destination without an intermediate buffer.
+   *  The parts are valid only until @p write returns.
+   *  @throw Error this is an invalid block
+   */
+  void
+  gather(const GatherCallback& write) const;
+
   /** @brief Return the first sub-element of the specified TLV-TYPE
    *  @pre parse() has been executed
    *  @throw tlv::Error a sub-element of the specified type does not exist
@@ -149,6 +149,7 @@ enum : uint32_t {
   NotAfter = 255,
 
   AdditionalDescription = 258,
+  MerkleLeafIndex = 260, ///< position of the packet in a Merkle-batched signature (non-standard)
   DescriptionEntry = 512,
   DescriptionKey = 513,
   DescriptionValue = 514
@@ -0,0 +1,388 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/ims/in-memory-storage-sharded.hpp"
+
+#include <boost/functional/hash.hpp>
+
+namespace ndn {
+
+const time::milliseconds InMemoryStorageSharded::INFINITE_WINDOW(-1);
+
+namespace {
+
+/** @brief Returns the number of components of @p name, excluding a trailing implicit digest
+ */
+size_t
+getDataNameSize(const Name& name)
+{
+  if (!name.empty() && name[-1].isImplicitSha256Digest()) {
+    return name.size() - 1;
+  }
+  return name.size();
+}
+
+/** @brief Hashes the first @p nComponents components of @p name
+ *  @param[out] prefixHash hash of the first @p prefixLength components, or of all
+ *              @p nComponents components if fewer
+ */
+size_t
+hashComponents(const Name& name, size_t nComponents, size_t prefixLength, size_t& prefixHash)
+{
+  size_t h = 0;
+  for (size_t i = 0; i < nComponents; ++i) {
+    if (i == prefixLength) {
+      prefixHash = h;
+    }
+    auto value = name[i].value_bytes();
+    boost::hash_combine(h, name[i].type());
+    boost::hash_combine(h, boost::hash_range(value.begin(), value.end()));
+  }
+  if (nComponents <= prefixLength) {
+    prefixHash = h;
+  }
+  return h;
+}
+
+} // namespace
+
+InMemoryStorageSharded::FrequencySketch::FrequencySketch(size_t capacity)
+  : m_sampleSize(10 * capacity)
+{
+  size_t width = 16;
+  while (width < capacity) {
+    width *= 2;
+  }
+  m_counters.resize(N_ROWS * width);
+  m_mask = width - 1;
+}
+
+size_t
+InMemoryStorageSharded::FrequencySketch::indexOf(size_t h, size_t row) const
+{
+  static const uint64_t SEEDS[N_ROWS] = {
+    0xc3a5c85c97cb3127ULL, 0xb492b66fbe98f273ULL, 0x9ae16a3b2f90404fULL, 0xcbf29ce484222325ULL};
+  uint64_t x = (static_cast<uint64_t>(h) + SEEDS[row]) * SEEDS[row];
+  x ^= x >> 32;
+  return row * (m_mask + 1) + static_cast<size_t>(x & m_mask);
+}
+
+void
+InMemoryStorageSharded::FrequencySketch::increment(size_t h)
+{
+  for (size_t row = 0; row < N_ROWS; ++row) {
+    uint8_t& counter = m_counters[indexOf(h, row)];
+    if (counter < 15) {
+      ++counter;
+    }
+  }
+
+  // aging: halve all counters so that the sketch reflects recent popularity
+  if (++m_nIncrements >= m_sampleSize) {
+    for (auto& counter : m_counters) {
+      counter >>= 1;
+    }
+    m_nIncrements /= 2;
+  }
+}
+
+uint8_t
+InMemoryStorageSharded::FrequencySketch::estimate(size_t h) const
+{
+  uint8_t result = 15;
+  for (size_t row = 0; row < N_ROWS; ++row) {
+    result = std::min(result, m_counters[indexOf(h, row)]);
+  }
+  return result;
+}
+
+InMemoryStorageSharded::InMemoryStorageSharded(size_t limit, size_t nShards,
+                                               size_t shardPrefixLength)
+  : m_limit(limit)
+  , m_shardCapacity(std::numeric_limits<size_t>::max())
+  , m_shardPrefixLength(shardPrefixLength)
+{
+  BOOST_ASSERT(nShards > 0);
+  BOOST_ASSERT(shardPrefixLength > 0);
+
+  if (m_limit != std::numeric_limits<size_t>::max()) {
+    m_shardCapacity = std::max<size_t>(m_limit / nShards, 1);
+  }
+
+  m_shards.reserve(nShards);
+  for (size_t i = 0; i < nShards; ++i) {
+    m_shards.push_back(make_unique<Shard>());
+    if (m_limit != std::numeric_limits<size_t>::max()) {
+      m_shards.back()->sketch = make_unique<FrequencySketch>(m_shardCapacity);
+    }
+  }
+}
+
+InMemoryStorageSharded::~InMemoryStorageSharded() = default;
+
+InMemoryStorageSharded::Shard*
+InMemoryStorageSharded::selectShard(const Name& name, bool isExact, size_t& nameHash) const
+{
+  size_t nComponents = getDataNameSize(name);
+  size_t prefixHash = 0;
+  nameHash = hashComponents(name, nComponents, m_shardPrefixLength, prefixHash);
+
+  // a lookup by a shorter name may match packets in any shard
+  if (nComponents < m_shardPrefixLength && !isExact) {
+    return nullptr;
+  }
+  return m_shards[prefixHash % m_shards.size()].get();
+}
+
+bool
+InMemoryStorageSharded::insert(const Data& data, time::milliseconds mustBeFreshProcessingWindow)
+{
+  size_t nameHash = 0;
+  Shard& shard = *selectShard(data.getName(), true, nameHash);
+
+  auto staleTime = time::steady_clock::TimePoint::max();
+  if (mustBeFreshProcessingWindow > 0_ms) {
+    staleTime = time::steady_clock::now() + mustBeFreshProcessingWindow;
+  }
+
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  // readers share the packet without a lock, so nothing may be left for a const getter to decode
+  try {
+    data.decodeDeferred();
+  }
+  catch (const tlv::Error&) {
+    return false;
+  }
+  // computed under the lock, as the same packet may be inserted concurrently
+  const Name& fullName = data.getFullName();
+  auto it = shard.entries.lower_bound(fullName);
+  if (it != shard.entries.end() && it->first == fullName) {
+    return true;
+  }
+
+  recordAccess(shard, nameHash);
+  if (shard.entries.size() >= m_shardCapacity) {
+    // TinyLFU admission: replace the LRU victim only with a more popular packet
+    Entry& victim = shard.lru.front();
+    if (shard.sketch->estimate(nameHash) <= shard.sketch->estimate(victim.nameHash)) {
+      ++shard.nRejected;
+      return false;
+    }
+    eraseEntry(shard, shard.entries.find(victim.data->getFullName()));
+    it = shard.entries.lower_bound(fullName);
+  }
+
+  it = shard.entries.emplace_hint(it, fullName, Entry());
+  it->second.data = data.shared_from_this();
+  it->second.nameHash = nameHash;
+  it->second.staleTime = staleTime;
+  shard.lru.push_back(it->second);
+  return true;
+}
+
+InMemoryStorageSharded::Entry*
+InMemoryStorageSharded::findInShard(Shard& shard, const Interest& interest,
+                                    time::steady_clock::TimePoint now)
+{
+  // if the interest contains implicit digest, it is possible to directly locate a packet
+  auto it = shard.entries.find(interest.getName());
+  if (it != shard.entries.end()) {
+    return &it->second;
+  }
+
+  // otherwise, the leftmost packet under the Interest name that satisfies the Interest
+  for (it = shard.entries.lower_bound(interest.getName());
+       it != shard.entries.end() && interest.getName().isPrefixOf(it->first); ++it) {
+    if (interest.getMustBeFresh() && now >= it->second.staleTime) {
+      continue;
+    }
+    if (interest.matchesData(*it->second.data)) {
+      return &it->second;
+    }
+  }
+  return nullptr;
+}
+
+template<typename F>
+shared_ptr<const Data>
+InMemoryStorageSharded::findAcrossShards(const F& findInShard)
+{
+  shared_ptr<const Data> best;
+  Shard* bestShard = nullptr;
+  for (const auto& shard : m_shards) {
+    std::lock_guard<std::mutex> lock(shard->mutex);
+    Entry* entry = findInShard(*shard);
+    if (entry != nullptr && (best == nullptr || entry->data->getFullName() < best->getFullName())) {
+      best = entry->data;
+      bestShard = shard.get();
+    }
+  }
+
+  if (best == nullptr) {
+    ++m_shards.front()->nMisses;
+    return nullptr;
+  }
+
+  // only the returned packet becomes most recently used, unless it was erased meanwhile
+  std::lock_guard<std::mutex> lock(bestShard->mutex);
+  ++bestShard->nHits;
+  auto it = bestShard->entries.find(best->getFullName());
+  if (it != bestShard->entries.end() && it->second.data == best) {
+    auto& lru = bestShard->lru;
+    lru.splice(lru.end(), lru, lru.iterator_to(it->second));
+  }
+  return best;
+}
+
+shared_ptr<const Data>
+InMemoryStorageSharded::find(const Interest& interest)
+{
+  auto now = time::steady_clock::now();
+  size_t nameHash = 0;
+  Shard* shard = selectShard(interest.getName(), !interest.getCanBePrefix(), nameHash);
+  if (shard == nullptr) {
+    return findAcrossShards([&] (Shard& s) { return findInShard(s, interest, now); });
+  }
+
+  std::lock_guard<std::mutex> lock(shard->mutex);
+  Entry* entry = findInShard(*shard, interest, now);
+  if (entry == nullptr) {
+    ++shard->nMisses;
+    recordAccess(*shard, nameHash);
+    return nullptr;
+  }
+
+  ++shard->nHits;
+  recordAccess(*shard, entry->nameHash);
+  shard->lru.splice(shard->lru.end(), shard->lru, shard->lru.iterator_to(*entry));
+  return entry->data;
+}
+
+shared_ptr<const Data>
+InMemoryStorageSharded::find(const Name& name)
+{
+  auto findFirst = [&name] (Shard& s) -> Entry* {
+    auto it = s.entries.lower_bound(name);
+    if (it == s.entries.end() || !name.isPrefixOf(it->first)) {
+      return nullptr;
+    }
+    return &it->second;
+  };
+
+  size_t nameHash = 0;
+  Shard* shard = selectShard(name, false, nameHash);
+  if (shard == nullptr) {
+    return findAcrossShards(findFirst);
+  }
+
+  std::lock_guard<std::mutex> lock(shard->mutex);
+  Entry* entry = findFirst(*shard);
+  if (entry == nullptr) {
+    ++shard->nMisses;
+    return nullptr;
+  }
+
+  ++shard->nHits;
+  recordAccess(*shard, entry->nameHash);
+  shard->lru.splice(shard->lru.end(), shard->lru, shard->lru.iterator_to(*entry));
+  return entry->data;
+}
+
+void
+InMemoryStorageSharded::eraseEntry(Shard& shard, std::map<Name, Entry>::iterator it)
+{
+  shard.lru.erase(shard.lru.iterator_to(it->second));
+  shard.entries.erase(it);
+}
+
+void
+InMemoryStorageSharded::erase(const Name& prefix, bool isPrefix)
+{
+  auto eraseInShard = [&] (Shard& s) {
+    std::lock_guard<std::mutex> lock(s.mutex);
+    if (isPrefix) {
+      auto it = s.entries.lower_bound(prefix);
+      while (it != s.entries.end() && prefix.isPrefixOf(it->second.data->getName())) {
+        eraseEntry(s, it++);
+      }
+    }
+    else {
+      auto it = s.entries.find(prefix);
+      if (it != s.entries.end()) {
+        eraseEntry(s, it);
+      }
+    }
+  };
+
+  size_t nameHash = 0;
+  Shard* shard = selectShard(prefix, !isPrefix, nameHash);
+  if (shard != nullptr) {
+    eraseInShard(*shard);
+  }
+  else {
+    for (const auto& s : m_shards) {
+      eraseInShard(*s);
+    }
+  }
+}
+
+size_t
+InMemoryStorageSharded::size() const
+{
+  size_t n = 0;
+  for (const auto& shard : m_shards) {
+    std::lock_guard<std::mutex> lock(shard->mutex);
+    n += shard->entries.size();
+  }
+  return n;
+}
+
+uint64_t
+InMemoryStorageSharded::getNHits() const
+{
+  uint64_t n = 0;
+  for (const auto& shard : m_shards) {
+    n += shard->nHits;
+  }
+  return n;
+}
+
+uint64_t
+InMemoryStorageSharded::getNMisses() const
+{
+  uint64_t n = 0;
+  for (const auto& shard : m_shards) {
+    n += shard->nMisses;
+  }
+  return n;
+}
+
+uint64_t
+InMemoryStorageSharded::getNRejected() const
+{
+  uint64_t n = 0;
+  for (const auto& shard : m_shards) {
+    n += shard->nRejected;
+  }
+  return n;
+}
+
+} // namespace ndn
@@ -0,0 +1,245 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_IMS_IN_MEMORY_STORAGE_SHARDED_HPP
+#define NDN_CXX_IMS_IN_MEMORY_STORAGE_SHARDED_HPP
+
+#include "ndn-cxx/data.hpp"
+#include "ndn-cxx/interest.hpp"
+
+#include <atomic>
+#include <map>
+#include <mutex>
+
+#include <boost/intrusive/list.hpp>
+
+namespace ndn {
+
+/** @brief Provides thread-safe in-memory storage partitioned into independently locked shards.
+ *
+ *  A Data packet is placed in the shard selected by the hash of the first few components of its
+ *  name (see @p shardPrefixLength). A lookup whose name has at least that many components, or
+ *  that can only match packets with exactly its name, is served by a single shard; other lookups
+ *  are performed in every shard. Within a shard, packets
+ *  are ordered by full name so that find() has the same semantics as InMemoryStorage::find(),
+ *  and are kept in an intrusive LRU list that is updated in O(1) on every hit.
+ *
+ *  When the storage has a limit and the shard is full, a new packet is admitted only if its
+ *  estimated access frequency exceeds that of the LRU victim (TinyLFU). Frequencies are
+ *  approximated with a count-min sketch of 4-bit counters that are halved periodically, so
+ *  that one-hit wonders cannot flush popular packets out of the storage.
+ *
+ *  Unlike InMemoryStorage, the MustBeFresh processing window is enforced with
+ *  time::steady_clock rather than with scheduled events, so no io_service is needed.
+ */
+class InMemoryStorageSharded : noncopyable
+{
+public:
+  /** @brief Create a storage with up to @p limit packets
+   *  @param limit maximum number of packets, distributed evenly among the shards
+   *  @param nShards number of shards, must be positive
+   *  @param shardPrefixLength number of name components used to select the shard, must be
+   *         positive; by default the whole name is used, which spreads packets evenly but sends
+   *         every Interest with CanBePrefix to all shards
+   */
+  explicit
+  InMemoryStorageSharded(size_t limit = std::numeric_limits<size_t>::max(), size_t nShards = 16,
+                         size_t shardPrefixLength = std::numeric_limits<size_t>::max());
+
+  ~InMemoryStorageSharded();
+
+  /** @brief Inserts a Data packet
+   *
+   *  @param data the packet to insert, must be signed and have wire encoding
+   *  @param mustBeFreshProcessingWindow Beyond this time period after the data is inserted, the
+   *         data can only be used to answer interest without MustBeFresh selector.
+   *  @return whether the packet is in the storage afterwards, i.e., false if it was rejected
+   *          by the admission policy or is malformed
+   *
+   *  Elements of @p data deferred by lazy decoding are decoded here, before the packet is
+   *  shared with concurrent readers (see Data::decodeDeferred()).
+   *
+   *  @note Packets are considered duplicate if the name with implicit digest matches.
+   */
+  bool
+  insert(const Data& data,
+         time::milliseconds mustBeFreshProcessingWindow = InMemoryStorageSharded::INFINITE_WINDOW);
+
+  /** @brief Finds the best match Data for an Interest, as InMemoryStorage::find(const Interest&)
+   *  @return the best match, if any; otherwise a null shared_ptr
+   */
+  shared_ptr<const Data>
+  find(const Interest& interest);
+
+  /** @brief Finds the first Data whose full name has @p name as a prefix
+   *  @return the match, if any; otherwise a null shared_ptr
+   */
+  shared_ptr<const Data>
+  find(const Name& name);
+
+  /** @brief Deletes the packets under @p prefix, or the packet with full name @p prefix if
+   *         @p isPrefix is false
+   */
+  void
+  erase(const Name& prefix, bool isPrefix = true);
+
+  /** @return maximum number of packets that can be stored
+   */
+  size_t
+  getLimit() const
+  {
+    return m_limit;
+  }
+
+  /** @return number of shards
+   */
+  size_t
+  getNShards() const
+  {
+    return m_shards.size();
+  }
+
+  /** @return number of packets currently stored
+   */
+  size_t
+  size() const;
+
+  /** @return number of lookups that returned a packet
+   */
+  uint64_t
+  getNHits() const;
+
+  /** @return number of lookups that did not return a packet
+   */
+  uint64_t
+  getNMisses() const;
+
+  /** @return number of packets that were not admitted, because the LRU victim of their shard
+   *          was estimated to be more popular
+   */
+  uint64_t
+  getNRejected() const;
+
+public:
+  static const time::milliseconds INFINITE_WINDOW;
+
+private:
+  /** @brief Count-min sketch with saturating 4-bit counters, stored one per octet
+   */
+  class FrequencySketch
+  {
+  public:
+    explicit
+    FrequencySketch(size_t capacity);
+
+    /** @brief Count one access to the item with hash @p h
+     */
+    void
+    increment(size_t h);
+
+    /** @brief Returns the estimated number of recent accesses to the item with hash @p h
+     */
+    uint8_t
+    estimate(size_t h) const;
+
+  private:
+    size_t
+    indexOf(size_t h, size_t row) const;
+
+  private:
+    static constexpr size_t N_ROWS = 4;
+    std::vector<uint8_t> m_counters;
+    size_t m_mask;
+    /// number of increments after which all counters are halved
+    size_t m_sampleSize;
+    size_t m_nIncrements = 0;
+  };
+
+  struct Entry : boost::intrusive::list_base_hook<>
+  {
+    shared_ptr<const Data> data;
+    /// hash of the Data name, for the frequency sketch
+    size_t nameHash;
+    /// the packet cannot satisfy MustBeFresh from this time on
+    time::steady_clock::TimePoint staleTime;
+  };
+
+  struct Shard
+  {
+    std::mutex mutex;
+    std::map<Name, Entry> entries; // by full name
+    boost::intrusive::list<Entry> lru; // least recently used first
+    unique_ptr<FrequencySketch> sketch;
+    std::atomic<uint64_t> nHits{0};
+    std::atomic<uint64_t> nMisses{0};
+    std::atomic<uint64_t> nRejected{0};
+  };
+
+  /** @brief Returns the shard for a name, or nullptr if all shards must be searched
+   *  @param name a Data name, or a name with an implicit digest
+   *  @param isExact whether only packets with exactly this name are looked up
+   *  @param[out] nameHash hash of @p name without the implicit digest, for the frequency sketch
+   */
+  Shard*
+  selectShard(const Name& name, bool isExact, size_t& nameHash) const;
+
+  /** @brief Returns the first packet in @p shard matching @p interest
+   *
+   *  The LRU list is not updated: the caller moves the packet it returns to the end.
+   *
+   *  @pre the shard is locked
+   */
+  static Entry*
+  findInShard(Shard& shard, const Interest& interest, time::steady_clock::TimePoint now);
+
+  /** @brief Counts an access to the name with hash @p nameHash in the frequency sketch
+   *  @pre the shard is locked
+   */
+  static void
+  recordAccess(Shard& shard, size_t nameHash)
+  {
+    if (shard.sketch != nullptr) {
+      shard.sketch->increment(nameHash);
+    }
+  }
+
+  /** @brief Looks up every shard with @p findInShard and returns the match with the lowest
+   *         full name, as a single ordered storage would
+   *
+   *  Only the returned packet is moved to the end of the LRU list of its shard.
+   */
+  template<typename F>
+  shared_ptr<const Data>
+  findAcrossShards(const F& findInShard);
+
+  void
+  eraseEntry(Shard& shard, std::map<Name, Entry>::iterator it);
+
+private:
+  std::vector<unique_ptr<Shard>> m_shards;
+  size_t m_limit;
+  size_t m_shardCapacity;
+  size_t m_shardPrefixLength;
+};
+
+} // namespace ndn
+
+#endif // NDN_CXX_IMS_IN_MEMORY_STORAGE_SHARDED_HPP
@@ -0,0 +1,151 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/interest-view.hpp"
+
+#include <cstring>
+
+namespace ndn {
+
+InterestView::InterestView(const Block& wire, ViewArena& arena)
+  : m_wire(&wire)
+{
+  if (wire.type() != tlv::Interest) {
+    NDN_THROW(Error("Interest", wire.type()));
+  }
+
+  // The element order and validity checks below follow Interest::wireDecode(),
+  // but elements are read directly from the buffer instead of through Block::parse().
+  auto value = wire.value_bytes();
+  const uint8_t* pos = value.data();
+  const uint8_t* end = pos + value.size();
+
+  int lastElement = 0; // last recognized element index, in spec order
+  while (pos != end) {
+    uint32_t type = 0;
+    uint64_t length = 0;
+    if (!tlv::readType(pos, end, type) || !tlv::readVarNumber(pos, end, length) ||
+        length > static_cast<uint64_t>(end - pos)) {
+      NDN_THROW(Error("Malformed element in Interest"));
+    }
+    span<const uint8_t> element(pos, static_cast<size_t>(length));
+    pos += length;
+
+    if (lastElement == 0) {
+      if (type != tlv::Name) {
+        NDN_THROW(Error("Name element is missing or out of order"));
+      }
+      m_name.parse(element, arena);
+      if (m_name.empty()) {
+        NDN_THROW(Error("Name has zero name components"));
+      }
+      lastElement = 1;
+      continue;
+    }
+
+    switch (type) {
+      case tlv::CanBePrefix: {
+        if (lastElement >= 2) {
+          NDN_THROW(Error("CanBePrefix element is out of order"));
+        }
+        if (length != 0) {
+          NDN_THROW(Error("CanBePrefix element has non-zero TLV-LENGTH"));
+        }
+        m_canBePrefix = true;
+        lastElement = 2;
+        break;
+      }
+      case tlv::MustBeFresh: {
+        if (lastElement >= 3) {
+          NDN_THROW(Error("MustBeFresh element is out of order"));
+        }
+        if (length != 0) {
+          NDN_THROW(Error("MustBeFresh element has non-zero TLV-LENGTH"));
+        }
+        m_mustBeFresh = true;
+        lastElement = 3;
+        break;
+      }
+      case tlv::ForwardingHint: {
+        if (lastElement >= 4) {
+          NDN_THROW(Error("ForwardingHint element is out of order"));
+        }
+        m_hasForwardingHint = true;
+        lastElement = 4;
+        break;
+      }
+      case tlv::Nonce: {
+        if (lastElement >= 5) {
+          NDN_THROW(Error("Nonce element is out of order"));
+        }
+        if (length != Interest::Nonce().size()) {
+          NDN_THROW(Error("Nonce element is malformed"));
+        }
+        m_nonce.emplace();
+        std::memcpy(m_nonce->data(), element.data(), m_nonce->size());
+        lastElement = 5;
+        break;
+      }
+      case tlv::InterestLifetime: {
+        if (lastElement >= 6) {
+          NDN_THROW(Error("InterestLifetime element is out of order"));
+        }
+        auto begin = element.data();
+        m_interestLifetime = time::milliseconds(tlv::readNonNegativeInteger(element.size(), begin,
+                                                                            begin + element.size()));
+        lastElement = 6;
+        break;
+      }
+      case tlv::HopLimit: {
+        if (lastElement >= 7) {
+          break; // HopLimit is non-critical, ignore out-of-order appearance
+        }
+        if (length != 1) {
+          NDN_THROW(Error("HopLimit element is malformed"));
+        }
+        m_hopLimit = element[0];
+        lastElement = 7;
+        break;
+      }
+      case tlv::ApplicationParameters: {
+        if (lastElement >= 8) {
+          break; // ApplicationParameters is non-critical, ignore out-of-order appearance
+        }
+        m_hasParameters = true;
+        lastElement = 8;
+        break;
+      }
+      default: { // unrecognized element
+        // if the TLV-TYPE is critical, abort decoding
+        if (tlv::isCriticalType(type)) {
+          NDN_THROW(Error("Unrecognized element of critical type " + to_string(type)));
+        }
+        break;
+      }
+    }
+  }
+
+  if (lastElement == 0) {
+    NDN_THROW(Error("Name element is missing or out of order"));
+  }
+}
+
+} // namespace ndn
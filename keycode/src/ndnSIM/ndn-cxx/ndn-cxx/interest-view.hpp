@@ -0,0 +1,126 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_INTEREST_VIEW_HPP
+#define NDN_CXX_INTEREST_VIEW_HPP
+
+#include "ndn-cxx/interest.hpp"
+#include "ndn-cxx/name-view.hpp"
+
+namespace ndn {
+
+/** @brief Non-owning view of an Interest over its TLV encoding
+ *
+ *  An InterestView decodes the fields that forwarding decisions need in place, without
+ *  creating the Name, ForwardingHint and ApplicationParameters objects that Interest::wireDecode()
+ *  allocates. Use toInterest() when an owning Interest is required.
+ *
+ *  The view refers to @p wire and to memory from the ViewArena; both must outlive it.
+ *  Unlike Interest::wireDecode(), the ParametersSha256DigestComponent is not verified and
+ *  the content of ForwardingHint is not decoded.
+ */
+class InterestView
+{
+public:
+  using Error = Interest::Error;
+
+  /** @brief Decode an Interest TLV in place
+   *  @throw Error the TLV-TYPE is not tlv::Interest, or the encoding is malformed
+   */
+  InterestView(const Block& wire, ViewArena& arena);
+
+  const Block&
+  wireEncode() const noexcept
+  {
+    return *m_wire;
+  }
+
+  const NameView&
+  getName() const noexcept
+  {
+    return m_name;
+  }
+
+  bool
+  getCanBePrefix() const noexcept
+  {
+    return m_canBePrefix;
+  }
+
+  bool
+  getMustBeFresh() const noexcept
+  {
+    return m_mustBeFresh;
+  }
+
+  bool
+  hasForwardingHint() const noexcept
+  {
+    return m_hasForwardingHint;
+  }
+
+  const optional<Interest::Nonce>&
+  getNonce() const noexcept
+  {
+    return m_nonce;
+  }
+
+  time::milliseconds
+  getInterestLifetime() const noexcept
+  {
+    return m_interestLifetime;
+  }
+
+  optional<uint8_t>
+  getHopLimit() const noexcept
+  {
+    return m_hopLimit;
+  }
+
+  bool
+  hasApplicationParameters() const noexcept
+  {
+    return m_hasParameters;
+  }
+
+  /** @brief Creates an owning Interest, sharing the underlying buffer
+   */
+  Interest
+  toInterest() const
+  {
+    return Interest(*m_wire);
+  }
+
+private:
+  const Block* m_wire;
+  NameView m_name;
+  bool m_canBePrefix = false;
+  bool m_mustBeFresh = false;
+  bool m_hasForwardingHint = false;
+  bool m_hasParameters = false;
+  optional<Interest::Nonce> m_nonce;
+  time::milliseconds m_interestLifetime = DEFAULT_INTEREST_LIFETIME;
+  optional<uint8_t> m_hopLimit;
+};
+
+} // namespace ndn
+
+#endif // NDN_CXX_INTEREST_VIEW_HPP
@@ -21,11 +21,8 @@
 
 #include "ndn-cxx/interest.hpp"
 #include "ndn-cxx/data.hpp"
-#include "ndn-cxx/encoding/buffer-stream.hpp"
-#include "ndn-cxx/security/transform/digest-filter.hpp"
-#include "ndn-cxx/security/transform/step-source.hpp"
-#include "ndn-cxx/security/transform/stream-sink.hpp"
 #include "ndn-cxx/util/random.hpp"
+#include "ndn-cxx/util/sha256.hpp"
 
 #include <boost/range/adaptor/reversed.hpp>
 
@@ -41,6 +38,7 @@ static_assert(std::is_base_of<tlv::Error, Interest::Error>::value,
               "Interest::Error must inherit from tlv::Error");
 
 bool Interest::s_autoCheckParametersDigest = true;
+bool Interest::s_lazyDecoding = false;
 
 Interest::Interest(const Name& name, time::milliseconds lifetime)
 {
@@ -105,6 +103,9 @@ Interest::wireEncode(EncodingImpl<TAG>& encoder) const
   totalLength += prependBinaryBlock(encoder, tlv::Nonce, *m_nonce);
 
   // ForwardingHint
+  if (m_pendingForwardingHint.isValid()) {
+    decodePendingForwardingHint();
+  }
   if (!m_forwardingHint.empty()) {
     totalLength += prependNestedBlock(encoder, tlv::ForwardingHint,
                                       m_forwardingHint.begin(), m_forwardingHint.end());
@@ -136,18 +137,28 @@ Interest::wireEncode() const
   if (m_wire.hasWire())
     return m_wire;
 
+  // Name and parameters are copied from their cached encodings,
+  // so the estimator pass only sums the sizes of the top-level elements
   EncodingEstimator estimator;
   size_t estimatedSize = wireEncode(estimator);
 
   EncodingBuffer encoder(estimatedSize, 0);
   wireEncode(encoder);
 
-  const_cast<Interest*>(this)->wireDecode(encoder.block());
+  // the setters computed the ParametersSha256DigestComponent from m_parameters,
+  // so it does not need to be verified again
+  const_cast<Interest*>(this)->decodeWire(encoder.block(), false);
   return m_wire;
 }
 
 void
 Interest::wireDecode(const Block& wire)
+{
+  decodeWire(wire, s_autoCheckParametersDigest);
+}
+
+void
+Interest::decodeWire(const Block& wire, bool checkParametersDigest)
 {
   if (wire.type() != tlv::Interest) {
     NDN_THROW(Error("Interest", wire.type()));
@@ -183,6 +194,7 @@ Interest::wireDecode(const Block& wire)
 
   m_canBePrefix = m_mustBeFresh = false;
   m_forwardingHint.clear();
+  m_pendingForwardingHint = {};
   m_nonce.reset();
   m_interestLifetime = DEFAULT_INTEREST_LIFETIME;
   m_hopLimit.reset();
@@ -217,36 +229,11 @@ Interest::wireDecode(const Block& wire)
         if (lastElement >= 4) {
           NDN_THROW(Error("ForwardingHint element is out of order"));
         }
-        // ForwardingHint = FORWARDING-HINT-TYPE TLV-LENGTH 1*Name
-        // [previous format]
-        // ForwardingHint = FORWARDING-HINT-TYPE TLV-LENGTH 1*Delegation
-        // Delegation = DELEGATION-TYPE TLV-LENGTH Preference Name
-        element->parse();
-        for (const auto& del : element->elements()) {
-          switch (del.type()) {
-            case tlv::Name:
-              try {
-                m_forwardingHint.emplace_back(del);
-              }
-              catch (const tlv::Error&) {
-                NDN_THROW_NESTED(Error("Invalid Name in ForwardingHint"));
-              }
-              break;
-            case tlv::LinkDelegation:
-              try {
-                del.parse();
-                m_forwardingHint.emplace_back(del.get(tlv::Name));
-              }
-              catch (const tlv::Error&) {
-                NDN_THROW_NESTED(Error("Invalid Name in ForwardingHint.Delegation"));
-              }
-              break;
-            default:
-              if (tlv::isCriticalType(del.type())) {
-                NDN_THROW(Error("Unexpected TLV-TYPE " + to_string(del.type()) + " while decoding ForwardingHint"));
-              }
-              break;
-          }
+        if (s_lazyDecoding) {
+          m_pendingForwardingHint = *element;
+        }
+        else {
+          decodeForwardingHint(*element);
         }
         lastElement = 4;
         break;
@@ -306,9 +293,77 @@ Interest::wireDecode(const Block& wire)
     }
   }
 
-  if (s_autoCheckParametersDigest && !isParametersDigestValid()) {
+  m_isParametersDigestPending = false;
+  if (checkParametersDigest) {
+    if (s_lazyDecoding) {
+      m_isParametersDigestPending = true;
+    }
+    else if (!isParametersDigestValid()) {
+      NDN_THROW(Error("ParametersSha256DigestComponent does not match the SHA-256 of Interest parameters"));
+    }
+  }
+}
+
+void
+Interest::decodeForwardingHint(const Block& element) const
+{
+  // ForwardingHint = FORWARDING-HINT-TYPE TLV-LENGTH 1*Name
+  // [previous format]
+  // ForwardingHint = FORWARDING-HINT-TYPE TLV-LENGTH 1*Delegation
+  // Delegation = DELEGATION-TYPE TLV-LENGTH Preference Name
+  element.parse();
+  for (const auto& del : element.elements()) {
+    switch (del.type()) {
+      case tlv::Name:
+        try {
+          m_forwardingHint.emplace_back(del);
+        }
+        catch (const tlv::Error&) {
+          NDN_THROW_NESTED(Error("Invalid Name in ForwardingHint"));
+        }
+        break;
+      case tlv::LinkDelegation:
+        try {
+          del.parse();
+          m_forwardingHint.emplace_back(del.get(tlv::Name));
+        }
+        catch (const tlv::Error&) {
+          NDN_THROW_NESTED(Error("Invalid Name in ForwardingHint.Delegation"));
+        }
+        break;
+      default:
+        if (tlv::isCriticalType(del.type())) {
+          NDN_THROW(Error("Unexpected TLV-TYPE " + to_string(del.type()) + " while decoding ForwardingHint"));
+        }
+        break;
+    }
+  }
+}
+
+void
+Interest::decodePendingForwardingHint() const
+{
+  BOOST_ASSERT(m_pendingForwardingHint.isValid());
+  m_forwardingHint.clear();
+  try {
+    decodeForwardingHint(m_pendingForwardingHint);
+  }
+  catch (const Error&) {
+    // leave the element pending, so that every access reports the error
+    m_forwardingHint.clear();
+    throw;
+  }
+  m_pendingForwardingHint = {};
+}
+
+void
+Interest::checkPendingParametersDigest() const
+{
+  BOOST_ASSERT(m_isParametersDigestPending);
+  if (!isParametersDigestValid()) {
     NDN_THROW(Error("ParametersSha256DigestComponent does not match the SHA-256 of Interest parameters"));
   }
+  m_isParametersDigestPending = false;
 }
 
 std::string
@@ -385,6 +440,7 @@ Interest&
 Interest::setForwardingHint(std::vector<Name> value)
 {
   m_forwardingHint = std::move(value);
+  m_pendingForwardingHint = {};
   m_wire.reset();
   return *this;
 }
@@ -522,6 +578,7 @@ Interest&
 Interest::unsetApplicationParameters()
 {
   m_parameters.clear();
+  m_isParametersDigestPending = false;
   ssize_t digestIndex = findParametersDigestComponent(getName());
   if (digestIndex >= 0) {
     m_name.erase(digestIndex);
@@ -641,6 +698,9 @@ Interest::extractSignedRanges() const
   bufs.reserve(2); // For Name range and parameters range
 
   wireEncode();
+  if (m_isParametersDigestPending) {
+    checkPendingParametersDigest();
+  }
 
   // Get Interest name minus any ParametersSha256DigestComponent
   // Name is guaranteed to be non-empty if wireEncode() does not throw
@@ -693,18 +753,15 @@ Interest::isParametersDigestValid() const
 shared_ptr<Buffer>
 Interest::computeParametersDigest() const
 {
-  using namespace security::transform;
-
-  StepSource in;
-  OBufferStream out;
-  in >> digestFilter(DigestAlgorithm::SHA256) >> streamSink(out);
-
+  InputBuffers bufs;
+  bufs.reserve(m_parameters.size());
   for (const auto& block : m_parameters) {
-    in.write(block);
+    bufs.emplace_back(block);
   }
-  in.end();
 
-  return out.buf();
+  auto digest = make_shared<Buffer>(util::Sha256::DIGEST_SIZE);
+  util::Sha256::computeDigest(bufs, *digest);
+  return digest;
 }
 
 void
@@ -725,6 +782,7 @@ Interest::addOrReplaceParametersDigestComponent()
     // replace the existing digest component
     m_name.set(digestIndex, std::move(digestComponent));
   }
+  m_isParametersDigestPending = false;
 }
 
 ssize_t
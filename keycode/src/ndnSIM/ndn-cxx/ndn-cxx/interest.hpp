@@ -218,9 +218,25 @@ public: // element access
     return *this;
   }
 
+  /** @brief Check if the ForwardingHint element is present.
+   *
+   *  Unlike getForwardingHint(), this does not decode a ForwardingHint deferred by lazy decoding.
+   */
+  bool
+  hasForwardingHint() const noexcept
+  {
+    return !m_forwardingHint.empty() || m_pendingForwardingHint.isValid();
+  }
+
+  /** @brief Get the delegation names in ForwardingHint.
+   *  @throw Error ForwardingHint deferred by lazy decoding is malformed
+   */
   span<const Name>
-  getForwardingHint() const noexcept
+  getForwardingHint() const
   {
+    if (m_pendingForwardingHint.isValid()) {
+      decodePendingForwardingHint();
+    }
     return m_forwardingHint;
   }
 
@@ -296,11 +312,15 @@ public: // element access
    *
    * If the element is not present, an invalid Block will be returned.
    *
+   * @throw Error the ParametersSha256DigestComponent check deferred by lazy decoding fails
    * @sa hasApplicationParameters()
    */
   Block
   getApplicationParameters() const
   {
+    if (m_isParametersDigestPending)
+      checkPendingParametersDigest();
+
     if (m_parameters.empty())
       return {};
     else
@@ -415,6 +435,53 @@ public: // element access
   InputBuffers
   extractSignedRanges() const;
 
+public: // lazy decoding
+  static bool
+  getLazyDecoding()
+  {
+    return s_lazyDecoding;
+  }
+
+  /** @brief Enable or disable lazy decoding in wireDecode()
+   *
+   *  With lazy decoding, wireDecode() still indexes every top-level element and decodes the
+   *  Name and the fixed-size fields that forwarding needs, but defers the remaining work until
+   *  the field is first accessed:
+   *  - the ForwardingHint delegation names are decoded by getForwardingHint();
+   *  - if getAutoCheckParametersDigest() is enabled, the ParametersSha256DigestComponent is
+   *    verified by getApplicationParameters() or extractSignedRanges(), which throw Error if it
+   *    does not match. This avoids hashing the parameters at every forwarding hop.
+   *
+   *  The wire encoding is unaffected; an Interest that is only forwarded is never fully decoded.
+   *
+   *  getForwardingHint() can therefore throw, and is not `noexcept` since lazy decoding was
+   *  added. The first access also modifies the packet: a lazily decoded Interest must be read by
+   *  a single thread, unless decodeDeferred() is called before the packet is shared.
+   */
+  static void
+  setLazyDecoding(bool b)
+  {
+    s_lazyDecoding = b;
+  }
+
+  /** @brief Decode the elements and run the checks deferred by lazy decoding
+   *
+   *  Afterwards, the const getters of this Interest can be called from several threads.
+   *
+   *  @throw Error a deferred element is malformed, or the ParametersSha256DigestComponent does
+   *               not match
+   */
+  void
+  decodeDeferred() const
+  {
+    if (m_pendingForwardingHint.isValid()) {
+      decodePendingForwardingHint();
+    }
+    if (m_isParametersDigestPending) {
+      checkPendingParametersDigest();
+    }
+  }
+
 public: // ParametersSha256DigestComponent support
   static bool
   getAutoCheckParametersDigest()
@@ -439,6 +506,20 @@ public: // ParametersSha256DigestComponent support
   isParametersDigestValid() const;
 
 private:
+  void
+  decodeWire(const Block& wire, bool checkParametersDigest);
+
+  /** @brief Decode @p element into m_forwardingHint
+   */
+  void
+  decodeForwardingHint(const Block& element) const;
+
+  void
+  decodePendingForwardingHint() const;
+
+  void
+  checkPendingParametersDigest() const;
+
   void
   setApplicationParametersInternal(Block parameters);
 
@@ -469,9 +550,10 @@ private:
 
 private:
   static bool s_autoCheckParametersDigest;
+  static bool s_lazyDecoding;
 
   Name m_name;
-  std::vector<Name> m_forwardingHint;
+  mutable std::vector<Name> m_forwardingHint;
   mutable optional<Nonce> m_nonce;
   time::milliseconds m_interestLifetime = DEFAULT_INTEREST_LIFETIME;
   optional<uint8_t> m_hopLimit;
@@ -486,6 +568,11 @@ private:
   // digest in the ParametersSha256DigestComponent.
   std::vector<Block> m_parameters;
 
+  // Work deferred by lazy decoding: the undecoded ForwardingHint element, and whether the
+  // ParametersSha256DigestComponent has yet to be checked against m_parameters
+  mutable Block m_pendingForwardingHint;
+  mutable bool m_isParametersDigestPending = false;
+
   mutable Block m_wire;
 };
 
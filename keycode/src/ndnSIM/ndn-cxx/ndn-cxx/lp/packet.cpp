@@ -129,12 +129,26 @@ Packet::wireEncode() const
   return m_wire;
 }
 
+Block
+Packet::wireEncodeComposite() const
+{
+  const Block::element_container& elements = m_wire.elements();
+  if (elements.size() == 1 && elements.front().type() == FragmentField::TlvType::value) {
+    elements.front().parse();
+    return elements.front().elements().front();
+  }
+
+  m_wire.compose();
+  return m_wire;
+}
+
 void
 Packet::wireDecode(const Block& wire)
 {
   if (wire.type() == ndn::tlv::Interest || wire.type() == ndn::tlv::Data) {
+    // the fragment refers to the network packet's buffer instead of copying it
     m_wire = Block(tlv::LpPacket);
-    add<FragmentField>({wire.begin(), wire.end()});
+    m_wire.push_back(Block(tlv::Fragment, wire));
     return;
   }
 
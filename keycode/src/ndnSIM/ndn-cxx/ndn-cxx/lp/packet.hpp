@@ -47,6 +47,16 @@ public:
   Block
   wireEncode() const;
 
+  /**
+   * \brief encode packet without copying its fields into a single buffer
+   *
+   * Like wireEncode(), a packet with only a fragment is returned as the bare network packet.
+   * Otherwise the returned LpPacket has no wire: its header fields and its fragment reference
+   * their own buffers, and it should be serialized with Block::gather().
+   */
+  Block
+  wireEncodeComposite() const;
+
   /**
    * \brief decode packet from wire format
    * \throws Error unknown TLV-TYPE
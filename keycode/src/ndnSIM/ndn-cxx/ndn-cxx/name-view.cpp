@@ -0,0 +1,274 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/name-view.hpp"
+#include "ndn-cxx/encoding/encoding-buffer.hpp"
+#include "ndn-cxx/util/sha256.hpp"
+
+#include <cstring>
+
+namespace ndn {
+
+void*
+ViewArena::allocateBytes(size_t size, size_t alignment)
+{
+  auto pos = reinterpret_cast<uintptr_t>(m_pos);
+  auto aligned = (pos + alignment - 1) & ~(uintptr_t(alignment) - 1);
+  if (aligned + size <= reinterpret_cast<uintptr_t>(m_end)) {
+    m_pos = reinterpret_cast<uint8_t*>(aligned + size);
+    return reinterpret_cast<void*>(aligned);
+  }
+
+  // new[] storage is suitably aligned for any fundamental type
+  size_t chunkSize = std::max<size_t>(size, 4 * sizeof(m_inline));
+  m_chunks.emplace_back(new uint8_t[chunkSize]);
+  uint8_t* chunk = m_chunks.back().get();
+  m_pos = chunk + size;
+  m_end = chunk + chunkSize;
+  return chunk;
+}
+
+namespace {
+
+/** @brief Decoded TLV-TYPE and TLV-VALUE of a name component encoding
+ */
+struct ComponentTlv
+{
+  uint32_t type;
+  span<const uint8_t> value;
+};
+
+} // namespace
+
+/** @brief Reads the TLV-TYPE and TLV-LENGTH of the name component at @p pos
+ *  @return whether they could be read and the TLV-VALUE fits in the remaining input;
+ *          on success, @p pos points to the TLV-VALUE
+ */
+static bool
+readComponentHeader(const uint8_t*& pos, const uint8_t* end, uint32_t& type, uint64_t& length) noexcept
+{
+  return tlv::readType(pos, end, type) &&
+         tlv::readVarNumber(pos, end, length) &&
+         length <= static_cast<uint64_t>(end - pos);
+}
+
+static ComponentTlv
+decodeComponent(span<const uint8_t> wire) noexcept
+{
+  // the encoding has been validated by NameView::parse()
+  const uint8_t* pos = wire.data();
+  uint32_t type = 0;
+  uint64_t length = 0;
+  readComponentHeader(pos, wire.data() + wire.size(), type, length);
+  return {type, {pos, static_cast<size_t>(length)}};
+}
+
+static int
+compareComponents(const ComponentTlv& lhs, uint32_t rhsType, span<const uint8_t> rhsValue) noexcept
+{
+  // NDN canonical order: TLV-TYPE, then TLV-LENGTH, then TLV-VALUE
+  if (lhs.type != rhsType) {
+    return lhs.type < rhsType ? -1 : 1;
+  }
+  if (lhs.value.size() != rhsValue.size()) {
+    return lhs.value.size() < rhsValue.size() ? -1 : 1;
+  }
+  if (lhs.value.empty()) {
+    return 0;
+  }
+  return std::memcmp(lhs.value.data(), rhsValue.data(), lhs.value.size());
+}
+
+NameView::NameView(const Block& wire, ViewArena& arena)
+{
+  if (wire.type() != tlv::Name) {
+    NDN_THROW(tlv::Error("Name", wire.type()));
+  }
+  parse(wire.value_bytes(), arena);
+}
+
+NameView::NameView(const Name& name, ViewArena& arena)
+{
+  parse(name.wireEncode().value_bytes(), arena);
+}
+
+void
+NameView::parse(span<const uint8_t> value, ViewArena& arena)
+{
+  const uint8_t* begin = value.data();
+  const uint8_t* end = begin + value.size();
+
+  // validate and count the components before allocating their index
+  size_t n = 0;
+  for (const uint8_t* pos = begin; pos != end; ++n) {
+    uint32_t type = 0;
+    uint64_t length = 0;
+    if (!readComponentHeader(pos, end, type, length)) {
+      NDN_THROW(Error("Malformed name component at index " + to_string(n)));
+    }
+    if (type < tlv::NameComponentMin || type > tlv::NameComponentMax) {
+      NDN_THROW(Error("TLV-TYPE " + to_string(type) + " is not a valid NameComponent"));
+    }
+    if ((type == tlv::ImplicitSha256DigestComponent ||
+         type == tlv::ParametersSha256DigestComponent) &&
+        length != util::Sha256::DIGEST_SIZE) {
+      NDN_THROW(Error("TLV-TYPE " + to_string(type) + " component must be " +
+                      to_string(util::Sha256::DIGEST_SIZE) + " octets"));
+    }
+    pos += length;
+  }
+
+  uint32_t* offsets = arena.allocate<uint32_t>(n + 1);
+  const uint8_t* pos = begin;
+  for (size_t i = 0; i < n; ++i) {
+    offsets[i] = static_cast<uint32_t>(pos - begin);
+    uint32_t type = 0;
+    uint64_t length = 0;
+    readComponentHeader(pos, end, type, length);
+    pos += length;
+  }
+  offsets[n] = static_cast<uint32_t>(value.size());
+
+  m_base = begin;
+  m_offsets = offsets;
+  m_size = n;
+}
+
+name::Component
+NameView::at(ssize_t i) const
+{
+  auto ssize = static_cast<ssize_t>(size());
+  if (i < -ssize || i >= ssize) {
+    NDN_THROW(Error("Component at offset " + to_string(i) + " does not exist (out of bounds)"));
+  }
+
+  if (i < 0) {
+    i += ssize;
+  }
+  return name::Component(Block(getComponentWire(static_cast<size_t>(i))));
+}
+
+NameView
+NameView::getSubName(ssize_t iStartComponent, size_t nComponents) const noexcept
+{
+  if (iStartComponent < 0)
+    iStartComponent += static_cast<ssize_t>(size());
+  size_t iStart = std::min(iStartComponent < 0 ? 0 : static_cast<size_t>(iStartComponent), size());
+
+  size_t iEnd = size();
+  if (nComponents != Name::npos)
+    iEnd = std::min(size(), iStart + nComponents);
+
+  NameView result;
+  result.m_base = m_base;
+  result.m_offsets = m_offsets == nullptr ? nullptr : m_offsets + iStart;
+  result.m_size = iEnd - iStart;
+  return result;
+}
+
+bool
+NameView::isPrefixOf(const Name& other) const noexcept
+{
+  if (size() > other.size()) {
+    return false;
+  }
+
+  for (size_t i = 0; i < size(); ++i) {
+    const auto& comp = other[i];
+    if (compareComponents(decodeComponent(getComponentWire(i)), comp.type(),
+                          comp.value_bytes()) != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool
+NameView::isPrefixOf(const NameView& other) const noexcept
+{
+  if (size() > other.size()) {
+    return false;
+  }
+
+  for (size_t i = 0; i < size(); ++i) {
+    auto rhs = decodeComponent(other.getComponentWire(i));
+    if (compareComponents(decodeComponent(getComponentWire(i)), rhs.type, rhs.value) != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+int
+NameView::compare(const Name& other) const noexcept
+{
+  size_t count = std::min(size(), other.size());
+  for (size_t i = 0; i < count; ++i) {
+    const auto& comp = other[i];
+    int cmp = compareComponents(decodeComponent(getComponentWire(i)), comp.type(),
+                                comp.value_bytes());
+    if (cmp != 0) {
+      return cmp;
+    }
+  }
+  return static_cast<int>(size()) - static_cast<int>(other.size());
+}
+
+int
+NameView::compare(const NameView& other) const noexcept
+{
+  size_t count = std::min(size(), other.size());
+  for (size_t i = 0; i < count; ++i) {
+    auto rhs = decodeComponent(other.getComponentWire(i));
+    int cmp = compareComponents(decodeComponent(getComponentWire(i)), rhs.type, rhs.value);
+    if (cmp != 0) {
+      return cmp;
+    }
+  }
+  return static_cast<int>(size()) - static_cast<int>(other.size());
+}
+
+Name
+NameView::toName() const
+{
+  auto value = getValue();
+  EncodingBuffer encoder(value.size() + 2 * tlv::sizeOfVarNumber(value.size()), 0);
+  encoder.prependBytes(value);
+  encoder.prependVarNumber(value.size());
+  encoder.prependVarNumber(tlv::Name);
+  return Name(encoder.block());
+}
+
+void
+NameView::toUri(std::ostream& os, name::UriFormat format) const
+{
+  if (empty()) {
+    os << "/";
+    return;
+  }
+
+  for (size_t i = 0; i < size(); ++i) {
+    os << "/";
+    name::Component(Block(getComponentWire(i))).toUri(os, format);
+  }
+}
+
+} // namespace ndn
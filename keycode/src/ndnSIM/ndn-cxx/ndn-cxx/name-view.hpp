@@ -0,0 +1,265 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_NAME_VIEW_HPP
+#define NDN_CXX_NAME_VIEW_HPP
+
+#include "ndn-cxx/name.hpp"
+#include "ndn-cxx/util/span.hpp"
+
+namespace ndn {
+
+/** @brief Bump allocator for the component index of NameView and InterestView
+ *
+ *  Small allocations are served from storage inside the arena object, so an arena on the stack
+ *  parses typical names without touching the heap. Larger allocations fall back to heap chunks.
+ *  All memory is released at once by reset() or when the arena is destroyed; views created
+ *  with this arena must not be used afterwards.
+ */
+class ViewArena : noncopyable
+{
+public:
+  ViewArena() noexcept
+    : m_pos(m_inline)
+    , m_end(m_inline + sizeof(m_inline))
+  {
+  }
+
+  /** @brief Allocates uninitialized storage for @p n objects of trivial type @p T
+   */
+  template<typename T>
+  T*
+  allocate(size_t n)
+  {
+    static_assert(std::is_trivially_destructible<T>::value, "T must be trivially destructible");
+    return static_cast<T*>(allocateBytes(n * sizeof(T), alignof(T)));
+  }
+
+  /** @brief Releases all allocations, invalidating every view created with this arena
+   */
+  void
+  reset() noexcept
+  {
+    m_chunks.clear();
+    m_pos = m_inline;
+    m_end = m_inline + sizeof(m_inline);
+  }
+
+private:
+  void*
+  allocateBytes(size_t size, size_t alignment);
+
+private:
+  alignas(std::max_align_t) uint8_t m_inline[256];
+  uint8_t* m_pos;
+  uint8_t* m_end;
+  std::vector<std::unique_ptr<uint8_t[]>> m_chunks;
+};
+
+/** @brief Non-owning view of a Name over its TLV encoding
+ *
+ *  A NameView parses the components of a Name TLV in place: it records the offset of each
+ *  component in an array obtained from a ViewArena and refers to the encoded bytes without
+ *  copying them. Prefixes and sub-names are O(1) and share the same offset array. Use toName()
+ *  to obtain an owning Name.
+ *
+ *  A NameView is valid as long as both the underlying buffer and the arena are alive and
+ *  unmodified. When created from a Name, modifying that Name invalidates the view.
+ */
+class NameView
+{
+public:
+  using Error = name::Component::Error;
+
+  /** @brief Create an empty view
+   */
+  NameView() noexcept = default;
+
+  /** @brief Parse a Name TLV in place
+   *  @param wire TLV element of type tlv::Name
+   *  @throw Error the TLV-TYPE is not tlv::Name, or a name component is malformed
+   */
+  NameView(const Block& wire, ViewArena& arena);
+
+  /** @brief Create a view of the encoding of @p name
+   *
+   *  The encoding of @p name is created if it does not have one.
+   */
+  NameView(const Name& name, ViewArena& arena);
+
+  /** @brief Returns the number of components
+   */
+  size_t
+  size() const noexcept
+  {
+    return m_size;
+  }
+
+  /** @brief Checks if the view contains no components
+   */
+  bool
+  empty() const noexcept
+  {
+    return m_size == 0;
+  }
+
+  /** @brief Returns the TLV encoding of the i-th component
+   *  @pre i < size()
+   */
+  span<const uint8_t>
+  getComponentWire(size_t i) const noexcept
+  {
+    BOOST_ASSERT(i < m_size);
+    return {m_base + m_offsets[i], m_base + m_offsets[i + 1]};
+  }
+
+  /** @brief Returns the TLV encoding of all components, i.e., the TLV-VALUE of the Name
+   */
+  span<const uint8_t>
+  getValue() const noexcept
+  {
+    if (m_size == 0) {
+      return {};
+    }
+    return {m_base + m_offsets[0], m_base + m_offsets[m_size]};
+  }
+
+  /** @brief Returns an owning copy of the i-th component
+   *  @param i zero-based index; if negative, it is interpreted as offset from the end of the name
+   *  @throw Error the index is out of bounds
+   */
+  name::Component
+  at(ssize_t i) const;
+
+  /** @brief Extracts some components as a sub-view, without copying
+   *
+   *  Bounds are handled in the same way as Name::getSubName().
+   */
+  NameView
+  getSubName(ssize_t iStartComponent, size_t nComponents = Name::npos) const noexcept;
+
+  /** @brief Returns a prefix of the view, without copying
+   *  @param nComponents number of components; if negative, size()+nComponents is used instead
+   */
+  NameView
+  getPrefix(ssize_t nComponents) const noexcept
+  {
+    if (nComponents < 0)
+      return getSubName(0, size() + nComponents);
+    else
+      return getSubName(0, nComponents);
+  }
+
+  /** @brief Check if this view is a prefix of @p other
+   */
+  bool
+  isPrefixOf(const Name& other) const noexcept;
+
+  /** @brief Check if this view is a prefix of @p other
+   */
+  bool
+  isPrefixOf(const NameView& other) const noexcept;
+
+  /** @brief Compare to @p other using NDN canonical ordering, as Name::compare() does
+   */
+  int
+  compare(const Name& other) const noexcept;
+
+  /** @brief Compare to @p other using NDN canonical ordering, as Name::compare() does
+   */
+  int
+  compare(const NameView& other) const noexcept;
+
+  /** @brief Creates an owning Name with the same components
+   */
+  Name
+  toName() const;
+
+  /** @brief Write the URI representation of the name to the output stream
+   */
+  void
+  toUri(std::ostream& os, name::UriFormat format = name::UriFormat::DEFAULT) const;
+
+private: // non-member operators
+  // NOTE: the following "hidden friend" operators are available via
+  //       argument-dependent lookup only and must be defined inline.
+
+  friend bool
+  operator==(const NameView& lhs, const NameView& rhs) noexcept
+  {
+    return lhs.size() == rhs.size() && lhs.compare(rhs) == 0;
+  }
+
+  friend bool
+  operator!=(const NameView& lhs, const NameView& rhs) noexcept
+  {
+    return !(lhs == rhs);
+  }
+
+  friend bool
+  operator==(const NameView& lhs, const Name& rhs) noexcept
+  {
+    return lhs.size() == rhs.size() && lhs.compare(rhs) == 0;
+  }
+
+  friend bool
+  operator!=(const NameView& lhs, const Name& rhs) noexcept
+  {
+    return !(lhs == rhs);
+  }
+
+  friend bool
+  operator==(const Name& lhs, const NameView& rhs) noexcept
+  {
+    return rhs == lhs;
+  }
+
+  friend bool
+  operator!=(const Name& lhs, const NameView& rhs) noexcept
+  {
+    return !(rhs == lhs);
+  }
+
+  friend std::ostream&
+  operator<<(std::ostream& os, const NameView& name)
+  {
+    name.toUri(os);
+    return os;
+  }
+
+private:
+  /** @brief Parse the TLV-VALUE of a Name
+   */
+  void
+  parse(span<const uint8_t> value, ViewArena& arena);
+
+  friend class InterestView;
+
+private:
+  const uint8_t* m_base = nullptr;
+  /// offset of each component from m_base, followed by the end offset of the last one
+  const uint32_t* m_offsets = nullptr;
+  size_t m_size = 0;
+};
+
+} // namespace ndn
+
+#endif // NDN_CXX_NAME_VIEW_HPP
@@ -116,6 +116,12 @@ template<encoding::Tag TAG>
 size_t
 Name::wireEncode(EncodingImpl<TAG>& encoder) const
 {
+  // a Name that has been encoded or decoded is copied as a whole,
+  // which also makes estimating its size O(1)
+  if (m_wire.hasWire()) {
+    return encoder.prependBytes(m_wire);
+  }
+
   size_t totalLength = 0;
   for (const Component& comp : *this | boost::adaptors::reversed) {
     totalLength += comp.wireEncode(encoder);
@@ -0,0 +1,128 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/security/impl/merkle-tree.hpp"
+#include "ndn-cxx/util/sha256.hpp"
+
+#include <cstring>
+
+namespace ndn {
+namespace security {
+namespace detail {
+
+const uint8_t LEAF_PREFIX = 0x00;
+const uint8_t NODE_PREFIX = 0x01;
+const size_t MAX_HEIGHT = 64;
+
+static MerkleDigest
+hashNode(const MerkleDigest& left, const MerkleDigest& right)
+{
+  MerkleDigest result;
+  util::Sha256::computeDigest({{&NODE_PREFIX, 1}, left, right}, result);
+  return result;
+}
+
+MerkleDigest
+computeMerkleLeaf(const InputBuffers& signedPortion)
+{
+  InputBuffers bufs;
+  bufs.reserve(1 + signedPortion.size());
+  bufs.emplace_back(&LEAF_PREFIX, 1);
+  bufs.insert(bufs.end(), signedPortion.begin(), signedPortion.end());
+
+  MerkleDigest result;
+  util::Sha256::computeDigest(bufs, result);
+  return result;
+}
+
+MerkleTree::MerkleTree(std::vector<MerkleDigest> leaves)
+{
+  BOOST_ASSERT(!leaves.empty());
+
+  m_levels.push_back(std::move(leaves));
+  while (m_levels.back().size() > 1) {
+    const auto& below = m_levels.back();
+    std::vector<MerkleDigest> level;
+    level.reserve((below.size() + 1) / 2);
+    for (size_t i = 0; i < below.size(); i += 2) {
+      level.push_back(hashNode(below[i], i + 1 < below.size() ? below[i + 1] : below[i]));
+    }
+    m_levels.push_back(std::move(level));
+  }
+}
+
+std::vector<MerkleDigest>
+MerkleTree::getPath(size_t index) const
+{
+  BOOST_ASSERT(index < m_levels.front().size());
+
+  std::vector<MerkleDigest> path;
+  path.reserve(m_levels.size() - 1);
+  for (size_t i = 0; i + 1 < m_levels.size(); ++i, index /= 2) {
+    const auto& level = m_levels[i];
+    size_t sibling = index ^ 1;
+    path.push_back(sibling < level.size() ? level[sibling] : level[index]);
+  }
+  return path;
+}
+
+ConstBufferPtr
+encodeMerkleSignatureValue(const std::vector<MerkleDigest>& path, span<const uint8_t> rootSig)
+{
+  BOOST_ASSERT(path.size() <= MAX_HEIGHT);
+
+  auto value = make_shared<Buffer>();
+  value->reserve(1 + path.size() * std::tuple_size<MerkleDigest>::value + rootSig.size());
+  value->push_back(static_cast<uint8_t>(path.size()));
+  for (const auto& digest : path) {
+    value->insert(value->end(), digest.begin(), digest.end());
+  }
+  value->insert(value->end(), rootSig.begin(), rootSig.end());
+  return value;
+}
+
+optional<std::pair<MerkleDigest, span<const uint8_t>>>
+computeMerkleRoot(const MerkleDigest& leaf, uint64_t index, span<const uint8_t> sigValue)
+{
+  if (sigValue.empty()) {
+    return nullopt;
+  }
+
+  size_t height = sigValue[0];
+  size_t pathSize = height * std::tuple_size<MerkleDigest>::value;
+  if (height > MAX_HEIGHT || sigValue.size() <= 1 + pathSize ||
+      (height < MAX_HEIGHT && (index >> height) != 0)) {
+    return nullopt;
+  }
+
+  MerkleDigest node = leaf;
+  auto pos = sigValue.data() + 1;
+  for (size_t i = 0; i < height; ++i, pos += node.size()) {
+    MerkleDigest sibling;
+    std::memcpy(sibling.data(), pos, sibling.size());
+    node = ((index >> i) & 1) ? hashNode(sibling, node) : hashNode(node, sibling);
+  }
+  return std::make_pair(node, sigValue.subspan(1 + pathSize));
+}
+
+} // namespace detail
+} // namespace security
+} // namespace ndn
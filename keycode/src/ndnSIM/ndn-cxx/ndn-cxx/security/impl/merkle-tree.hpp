@@ -0,0 +1,105 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_SECURITY_IMPL_MERKLE_TREE_HPP
+#define NDN_CXX_SECURITY_IMPL_MERKLE_TREE_HPP
+
+#include "ndn-cxx/encoding/buffer.hpp"
+#include "ndn-cxx/security/security-common.hpp"
+#include "ndn-cxx/util/optional.hpp"
+
+#include <array>
+
+namespace ndn {
+namespace security {
+namespace detail {
+
+/**
+ * @brief SHA-256 digest of a node in the Merkle tree of a batch signature
+ */
+using MerkleDigest = std::array<uint8_t, 32>;
+
+/**
+ * @brief Computes the leaf digest of a packet from its signed portion
+ *
+ * Leaves and interior nodes are hashed with distinct one-octet prefixes (0x00 and 0x01),
+ * so that an interior node cannot be presented as the leaf of another packet.
+ */
+MerkleDigest
+computeMerkleLeaf(const InputBuffers& signedPortion);
+
+/**
+ * @brief Binary Merkle tree over the leaf digests of a batch of packets
+ *
+ * When a level has an odd number of nodes, the last node is paired with itself. The height
+ * of the tree is therefore ceil(log2(number of leaves)), and every audit path has exactly
+ * that many sibling digests.
+ */
+class MerkleTree
+{
+public:
+  /**
+   * @pre @p leaves is not empty
+   */
+  explicit
+  MerkleTree(std::vector<MerkleDigest> leaves);
+
+  const MerkleDigest&
+  getRoot() const
+  {
+    return m_levels.back().front();
+  }
+
+  /**
+   * @brief Returns the sibling digests from leaf @p index up to the root
+   */
+  std::vector<MerkleDigest>
+  getPath(size_t index) const;
+
+private:
+  std::vector<std::vector<MerkleDigest>> m_levels;
+};
+
+/**
+ * @brief Encodes the TLV-VALUE of the SignatureValue of a Merkle-batched signature
+ *
+ * The encoding is one octet with the number of sibling digests in @p path, followed by the
+ * sibling digests from the leaf upwards, followed by the signature over the root.
+ */
+ConstBufferPtr
+encodeMerkleSignatureValue(const std::vector<MerkleDigest>& path, span<const uint8_t> rootSig);
+
+/**
+ * @brief Recomputes the root of a Merkle-batched signature
+ * @param leaf leaf digest of the packet
+ * @param index position of the packet in the batch
+ * @param sigValue TLV-VALUE of the SignatureValue of the packet
+ * @return The root digest and the signature over it, or nullopt if @p sigValue is malformed
+ *         or inconsistent with @p index
+ */
+optional<std::pair<MerkleDigest, span<const uint8_t>>>
+computeMerkleRoot(const MerkleDigest& leaf, uint64_t index, span<const uint8_t> sigValue);
+
+} // namespace detail
+} // namespace security
+} // namespace ndn
+
+#endif // NDN_CXX_SECURITY_IMPL_MERKLE_TREE_HPP
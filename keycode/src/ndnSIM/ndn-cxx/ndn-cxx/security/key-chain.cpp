@@ -21,10 +21,12 @@
 
 #include "ndn-cxx/security/key-chain.hpp"
 #include "ndn-cxx/security/signing-helpers.hpp"
+#include "ndn-cxx/security/impl/merkle-tree.hpp"
 
 #include "ndn-cxx/encoding/buffer-stream.hpp"
 #include "ndn-cxx/util/config-file.hpp"
 #include "ndn-cxx/util/logger.hpp"
+#include "ndn-cxx/util/sha256.hpp"
 
 #include "ndn-cxx/security/pib/impl/pib-memory.hpp"
 #include "ndn-cxx/security/pib/impl/pib-sqlite3.hpp"
@@ -37,14 +39,14 @@
 
 #include "ndn-cxx/security/transform/bool-sink.hpp"
 #include "ndn-cxx/security/transform/buffer-source.hpp"
-#include "ndn-cxx/security/transform/digest-filter.hpp"
 #include "ndn-cxx/security/transform/private-key.hpp"
 #include "ndn-cxx/security/transform/public-key.hpp"
-#include "ndn-cxx/security/transform/stream-sink.hpp"
 #include "ndn-cxx/security/transform/verifier-filter.hpp"
 
 #include <boost/lexical_cast.hpp>
 
+#include <deque>
+
 namespace ndn {
 namespace security {
 
@@ -440,6 +442,31 @@ KeyChain::importPrivateKey(const Name& keyName, shared_ptr<transform::PrivateKey
 
 // public: signing
 
+/**
+ * @brief Room reserved after the signed portion of a Data for its SignatureValue element
+ *
+ * The SignatureInfo, with a KeyLocator of any length, is part of the signed portion and is
+ * measured exactly, so only the SignatureValue needs a bound.  It is the largest value that
+ * KeyChain creates with the key types it generates: 512 octets for RSA-4096 (ECDSA P-521 is at
+ * most 139, HMAC-SHA256 and DigestSha256 are 32), plus 1 octet of TLV-TYPE and 3 of TLV-LENGTH.
+ * Larger RSA keys still produce correct packets, at the cost of one reallocation.
+ */
+const size_t SIGNATURE_VALUE_RESERVE = 1 + 3 + 512;
+
+/**
+ * @brief Returns the capacity of an EncodingBuffer for signing @p data
+ *
+ * Room is reserved in front for the signed portion and the outer TLV-TYPE and TLV-LENGTH
+ * (at most 1 + 9 octets), and at the back for a SignatureValue of @p sigValueReserve octets,
+ * so that large Content does not cause a reallocation.
+ */
+static size_t
+getSigningBufferSize(const Data& data, size_t sigValueReserve = SIGNATURE_VALUE_RESERVE)
+{
+  EncodingEstimator estimator;
+  return data.wireEncode(estimator, true) + 1 + 9 + sigValueReserve;
+}
+
 void
 KeyChain::sign(Data& data, const SigningInfo& params)
 {
@@ -449,13 +476,84 @@ KeyChain::sign(Data& data, const SigningInfo& params)
 
   data.setSignatureInfo(sigInfo);
 
-  EncodingBuffer encoder;
+  EncodingBuffer encoder(getSigningBufferSize(data), SIGNATURE_VALUE_RESERVE);
   data.wireEncode(encoder, true);
 
   auto sigValue = sign({encoder}, keyName, params.getDigestAlgorithm());
   data.wireEncode(encoder, *sigValue);
 }
 
+void
+KeyChain::sign(span<const shared_ptr<Data>> batch, const SigningInfo& params)
+{
+  if (batch.empty()) {
+    return;
+  }
+
+  Name keyName;
+  SignatureInfo sigInfo;
+  std::tie(keyName, sigInfo) = prepareSignatureInfo(params);
+
+  std::deque<EncodingBuffer> encoders;
+  std::vector<InputBuffers> unsignedPortions;
+  unsignedPortions.reserve(batch.size());
+  for (const auto& data : batch) {
+    data->setSignatureInfo(sigInfo);
+    encoders.emplace_back(getSigningBufferSize(*data), SIGNATURE_VALUE_RESERVE);
+    data->wireEncode(encoders.back(), true);
+    unsignedPortions.push_back({encoders.back()});
+  }
+
+  auto sigValues = sign(unsignedPortions, keyName, params.getDigestAlgorithm());
+  for (size_t i = 0; i < batch.size(); ++i) {
+    batch[i]->wireEncode(encoders[i], *sigValues[i]);
+  }
+}
+
+void
+KeyChain::signMerkleBatch(span<const shared_ptr<Data>> batch, const SigningInfo& params)
+{
+  if (batch.empty()) {
+    return;
+  }
+
+  Name keyName;
+  SignatureInfo sigInfo;
+  std::tie(keyName, sigInfo) = prepareSignatureInfo(params);
+  if (keyName == SigningInfo::getDigestSha256Identity()) {
+    NDN_THROW(InvalidSigningInfoError("Merkle-batched signatures require a signing key"));
+  }
+
+  // the SignatureValue also carries the sibling digests from the leaf to the root, and their count
+  size_t height = 0;
+  while ((size_t(1) << height) < batch.size()) {
+    ++height;
+  }
+  size_t sigValueReserve = SIGNATURE_VALUE_RESERVE + 1 +
+                           height * std::tuple_size<detail::MerkleDigest>::value;
+
+  std::deque<EncodingBuffer> encoders;
+  std::vector<detail::MerkleDigest> leaves;
+  leaves.reserve(batch.size());
+  for (size_t i = 0; i < batch.size(); ++i) {
+    // the leaf index is part of the signed portion, so a packet cannot claim another position
+    sigInfo.addCustomTlv(makeNonNegativeIntegerBlock(tlv::MerkleLeafIndex, i));
+    batch[i]->setSignatureInfo(sigInfo);
+    encoders.emplace_back(getSigningBufferSize(*batch[i], sigValueReserve), sigValueReserve);
+    batch[i]->wireEncode(encoders.back(), true);
+    leaves.push_back(detail::computeMerkleLeaf({encoders.back()}));
+  }
+
+  detail::MerkleTree tree(std::move(leaves));
+  auto rootSig = sign({tree.getRoot()}, keyName, params.getDigestAlgorithm());
+  NDN_LOG_TRACE("Signed Merkle root of " << batch.size() << " packets with " << keyName);
+
+  for (size_t i = 0; i < batch.size(); ++i) {
+    auto sigValue = detail::encodeMerkleSignatureValue(tree.getPath(i), *rootSig);
+    batch[i]->wireEncode(encoders[i], *sigValue);
+  }
+}
+
 void
 KeyChain::sign(Interest& interest, const SigningInfo& params)
 {
@@ -771,12 +869,10 @@ KeyChain::prepareSignatureInfoWithKey(const SigningInfo& params, const pib::Key&
 ConstBufferPtr
 KeyChain::sign(const InputBuffers& bufs, const Name& keyName, DigestAlgorithm digestAlgorithm) const
 {
-  using namespace transform;
-
   if (keyName == SigningInfo::getDigestSha256Identity()) {
-    OBufferStream os;
-    bufferSource(bufs) >> digestFilter(DigestAlgorithm::SHA256) >> streamSink(os);
-    return os.buf();
+    auto digest = make_shared<Buffer>(util::Sha256::DIGEST_SIZE);
+    util::Sha256::computeDigest(bufs, *digest);
+    return digest;
   }
 
   auto signature = m_tpm->sign(bufs, keyName, digestAlgorithm);
@@ -789,6 +885,29 @@ KeyChain::sign(const InputBuffers& bufs, const Name& keyName, DigestAlgorithm di
   return signature;
 }
 
+std::vector<ConstBufferPtr>
+KeyChain::sign(span<const InputBuffers> batch, const Name& keyName,
+               DigestAlgorithm digestAlgorithm) const
+{
+  if (keyName == SigningInfo::getDigestSha256Identity()) {
+    std::vector<ConstBufferPtr> digests;
+    digests.reserve(batch.size());
+    for (const auto& bufs : batch) {
+      digests.push_back(sign(bufs, keyName, digestAlgorithm));
+    }
+    return digests;
+  }
+
+  auto signatures = m_tpm->sign(batch, keyName, digestAlgorithm);
+  if (signatures.size() != batch.size()) {
+    NDN_THROW(InvalidSigningInfoError("TPM signing failed for key `" + keyName.toUri() + "` "
+                                      "(e.g., PIB contains info about the key, but TPM is missing "
+                                      "the corresponding private key)"));
+  }
+
+  return signatures;
+}
+
 tlv::SignatureTypeValue
 KeyChain::getSignatureType(KeyType keyType, DigestAlgorithm)
 {
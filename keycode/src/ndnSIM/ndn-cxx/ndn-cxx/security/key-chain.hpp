@@ -330,6 +330,44 @@ public: // signing
   void
   sign(Interest& interest, const SigningInfo& params = SigningInfo());
 
+  /**
+   * @brief Sign a batch of Data packets according to the supplied signing information.
+   *
+   * The result is the same as calling sign(Data&, const SigningInfo&) on every packet, but the
+   * signing key and SignatureInfo are determined once for the whole batch, and the TPM may
+   * reuse one signing context for all signatures.
+   *
+   * @param batch The Data packets to sign
+   * @param params The signing parameters
+   * @throw Error Signing failed
+   * @throw InvalidSigningInfoError Invalid @p params was specified or the specified identity, key,
+   *                                or certificate does not exist
+   */
+  void
+  sign(span<const shared_ptr<Data>> batch, const SigningInfo& params = SigningInfo());
+
+  /**
+   * @brief Sign a batch of Data packets with one Merkle-batched signature.
+   *
+   * A Merkle tree is built over the signed portions of the packets and only its root is signed,
+   * so the batch costs a single private-key operation. The SignatureInfo of each packet contains
+   * a tlv::MerkleLeafIndex element with the position of the packet in @p batch, and its
+   * SignatureValue contains the audit path of the packet followed by the signature over the root.
+   * Each packet can be verified on its own by verifySignature() and Validator.
+   *
+   * The SignatureValue grows by 32 octets per level of the tree, and packets signed this way can
+   * only be verified by this library.
+   *
+   * @param batch The Data packets to sign
+   * @param params The signing parameters
+   * @throw Error Signing failed
+   * @throw InvalidSigningInfoError Invalid @p params was specified, @p params requests a
+   *                                DigestSha256 signature, or the specified identity, key,
+   *                                or certificate does not exist
+   */
+  void
+  signMerkleBatch(span<const shared_ptr<Data>> batch, const SigningInfo& params = SigningInfo());
+
   /**
    * @brief Create and sign a certificate packet.
    * @param publicKey Public key being certified. It does not need to exist in this KeyChain.
@@ -522,6 +560,13 @@ private: // signing
   ConstBufferPtr
   sign(const InputBuffers& bufs, const Name& keyName, DigestAlgorithm digestAlgorithm) const;
 
+  /**
+   * @brief Generate and return a raw signature for each element of @p batch using
+   *        the specified key and digest algorithm.
+   */
+  std::vector<ConstBufferPtr>
+  sign(span<const InputBuffers> batch, const Name& keyName, DigestAlgorithm digestAlgorithm) const;
+
 private:
   unique_ptr<Pib> m_pib;
   unique_ptr<Tpm> m_tpm;
@@ -48,6 +48,12 @@ KeyHandleMem::doSign(DigestAlgorithm digestAlgo, const InputBuffers& bufs) const
   return sigOs.buf();
 }
 
+std::vector<ConstBufferPtr>
+KeyHandleMem::doSignBatch(DigestAlgorithm digestAlgo, span<const InputBuffers> batch) const
+{
+  return m_key->sign(batch, digestAlgo);
+}
+
 bool
 KeyHandleMem::doVerify(DigestAlgorithm digestAlgo, const InputBuffers& bufs,
                        span<const uint8_t> sig) const
@@ -46,6 +46,9 @@ private:
   ConstBufferPtr
   doSign(DigestAlgorithm digestAlgo, const InputBuffers& bufs) const final;
 
+  std::vector<ConstBufferPtr>
+  doSignBatch(DigestAlgorithm digestAlgo, span<const InputBuffers> batch) const final;
+
   bool
   doVerify(DigestAlgorithm digestAlgo, const InputBuffers& bufs, span<const uint8_t> sig) const final;
 
@@ -33,6 +33,12 @@ KeyHandle::sign(DigestAlgorithm digestAlgorithm, const InputBuffers& bufs) const
   return doSign(digestAlgorithm, bufs);
 }
 
+std::vector<ConstBufferPtr>
+KeyHandle::sign(DigestAlgorithm digestAlgorithm, span<const InputBuffers> batch) const
+{
+  return doSignBatch(digestAlgorithm, batch);
+}
+
 bool
 KeyHandle::verify(DigestAlgorithm digestAlgorithm, const InputBuffers& bufs,
                   span<const uint8_t> sig) const
@@ -52,6 +58,17 @@ KeyHandle::derivePublicKey() const
   return doDerivePublicKey();
 }
 
+std::vector<ConstBufferPtr>
+KeyHandle::doSignBatch(DigestAlgorithm digestAlgo, span<const InputBuffers> batch) const
+{
+  std::vector<ConstBufferPtr> sigs;
+  sigs.reserve(batch.size());
+  for (const auto& bufs : batch) {
+    sigs.push_back(doSign(digestAlgo, bufs));
+  }
+  return sigs;
+}
+
 } // namespace tpm
 } // namespace security
 } // namespace ndn
@@ -53,6 +53,14 @@ public:
   ConstBufferPtr
   sign(DigestAlgorithm digestAlgorithm, const InputBuffers& bufs) const;
 
+  /**
+   * @brief Generate a digital signature for each element of @p batch using this key with
+   *        @p digestAlgorithm.
+   * @return The signatures, in the same order as @p batch.
+   */
+  std::vector<ConstBufferPtr>
+  sign(DigestAlgorithm digestAlgorithm, span<const InputBuffers> batch) const;
+
   /**
    * @brief Verify the signature @p sig over @p bufs using this key and @p digestAlgorithm.
    */
@@ -87,6 +95,15 @@ private:
   virtual ConstBufferPtr
   doSign(DigestAlgorithm digestAlgo, const InputBuffers& bufs) const = 0;
 
+  /**
+   * @brief Sign every element of @p batch.
+   *
+   * The default implementation calls doSign() on each element. Back-ends that can amortize
+   * the per-signature setup should override it.
+   */
+  virtual std::vector<ConstBufferPtr>
+  doSignBatch(DigestAlgorithm digestAlgo, span<const InputBuffers> batch) const;
+
   virtual bool
   doVerify(DigestAlgorithm digestAlgo, const InputBuffers& bufs, span<const uint8_t> sig) const = 0;
 
@@ -83,6 +83,16 @@ Tpm::sign(const InputBuffers& bufs, const Name& keyName, DigestAlgorithm digestA
   return key ? key->sign(digestAlgorithm, bufs) : nullptr;
 }
 
+std::vector<ConstBufferPtr>
+Tpm::sign(span<const InputBuffers> batch, const Name& keyName, DigestAlgorithm digestAlgorithm) const
+{
+  const KeyHandle* key = findKey(keyName);
+  if (key == nullptr)
+    return {};
+
+  return key->sign(digestAlgorithm, batch);
+}
+
 boost::logic::tribool
 Tpm::verify(const InputBuffers& bufs, span<const uint8_t> sig, const Name& keyName,
             DigestAlgorithm digestAlgorithm) const
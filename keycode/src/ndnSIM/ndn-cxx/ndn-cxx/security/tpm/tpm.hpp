@@ -103,6 +103,16 @@ public:
   ConstBufferPtr
   sign(const InputBuffers& bufs, const Name& keyName, DigestAlgorithm digestAlgorithm) const;
 
+  /**
+   * @brief Sign each element of @p batch using the key with name @p keyName and using the
+   *        digest @p digestAlgorithm.
+   *
+   * @return The signatures in the same order as @p batch, or an empty vector if the key does
+   *         not exist.
+   */
+  std::vector<ConstBufferPtr>
+  sign(span<const InputBuffers> batch, const Name& keyName, DigestAlgorithm digestAlgorithm) const;
+
   /**
    * @brief Verify discontiguous ranges using the key with name @p keyName and using the digest
    *        @p digestAlgorithm.
@@ -333,6 +333,47 @@ PrivateKey::decrypt(span<const uint8_t> cipherText) const
   }
 }
 
+std::vector<ConstBufferPtr>
+PrivateKey::sign(span<const InputBuffers> batch, DigestAlgorithm algo) const
+{
+  ENSURE_PRIVATE_KEY_LOADED(m_impl->key);
+
+  const EVP_MD* md = detail::digestAlgorithmToEvpMd(algo);
+  if (md == nullptr)
+    NDN_THROW(Error("Unsupported digest algorithm " + boost::lexical_cast<std::string>(algo)));
+
+  detail::EvpMdCtx initCtx;
+  if (EVP_DigestSignInit(initCtx, nullptr, md, nullptr, m_impl->key) != 1)
+    NDN_THROW(Error("Failed to initialize signing context with " +
+                    boost::lexical_cast<std::string>(algo) + " digest and " +
+                    boost::lexical_cast<std::string>(getKeyType()) + " key"));
+
+  std::vector<ConstBufferPtr> sigs;
+  sigs.reserve(batch.size());
+  detail::EvpMdCtx ctx;
+  for (const auto& bufs : batch) {
+    if (EVP_MD_CTX_copy_ex(ctx, initCtx) != 1)
+      NDN_THROW(Error("Failed to duplicate signing context"));
+
+    for (const auto& buf : bufs) {
+      if (EVP_DigestSignUpdate(ctx, buf.data(), buf.size()) != 1)
+        NDN_THROW(Error("Failed to accept more input"));
+    }
+
+    size_t sigLen = 0;
+    if (EVP_DigestSignFinal(ctx, nullptr, &sigLen) != 1)
+      NDN_THROW(Error("Failed to estimate buffer length"));
+
+    auto sig = make_shared<Buffer>(sigLen);
+    if (EVP_DigestSignFinal(ctx, sig->data(), &sigLen) != 1)
+      NDN_THROW(Error("Failed to finalize signature"));
+
+    sig->resize(sigLen);
+    sigs.push_back(std::move(sig));
+  }
+  return sigs;
+}
+
 void*
 PrivateKey::getEvpPkey() const
 {
@@ -238,6 +238,16 @@ public:
   ConstBufferPtr
   decrypt(span<const uint8_t> cipherText) const;
 
+  /**
+   * @brief Sign each element of @p batch using this private key and @p algo.
+   * @return The signatures, in the same order as @p batch.
+   *
+   * The result is the same as passing each element through a SignerFilter, but the signing
+   * context is initialized with the key only once and duplicated for every element.
+   */
+  std::vector<ConstBufferPtr>
+  sign(span<const InputBuffers> batch, DigestAlgorithm algo) const;
+
 private:
   friend class SignerFilter;
   friend class VerifierFilter;
@@ -41,6 +41,11 @@ typedef function<void(const Data& data)> DataValidationSuccessCallback;
  */
 typedef function<void(const Data& data, const ValidationError& error)> DataValidationFailureCallback;
 
+/**
+ * @brief Callback to report the Data packets of a batch that passed validation.
+ */
+typedef function<void(const std::vector<Data>& validated)> DataBatchValidationSuccessCallback;
+
 /**
  * @brief Callback to report a successful Interest validation.
  */
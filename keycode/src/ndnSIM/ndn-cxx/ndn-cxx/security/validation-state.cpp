@@ -21,6 +21,7 @@
 
 #include "ndn-cxx/security/validation-state.hpp"
 #include "ndn-cxx/security/validator.hpp"
+#include "ndn-cxx/security/verification-cache.hpp"
 #include "ndn-cxx/security/verification-helpers.hpp"
 #include "ndn-cxx/util/logger.hpp"
 
@@ -107,7 +108,22 @@ DataValidationState::~DataValidationState()
 void
 DataValidationState::verifyOriginalPacket(const optional<Certificate>& trustedCert)
 {
-  if (verifySignature(m_data, trustedCert)) {
+  // DigestSha256 is checked directly, since it costs no more than a cache lookup
+  bool useCache = m_verificationCache != nullptr && trustedCert && m_data.hasWire();
+  if (useCache && m_verificationCache->contains(m_data.getFullName(), *trustedCert)) {
+    NDN_LOG_TRACE_DEPTH("Cached OK signature for data `" << m_data.getName() << "`");
+    m_successCb(m_data);
+    BOOST_ASSERT(boost::logic::indeterminate(m_outcome));
+    m_outcome = true;
+    return;
+  }
+
+  bool isValid = m_merkleRoots ? verifySignature(m_data, trustedCert, *m_merkleRoots)
+                               : verifySignature(m_data, trustedCert);
+  if (isValid) {
+    if (useCache) {
+      m_verificationCache->insert(m_data.getFullName(), *trustedCert);
+    }
     NDN_LOG_TRACE_DEPTH("OK signature for data `" << m_data.getName() << "`");
     m_successCb(m_data);
     BOOST_ASSERT(boost::logic::indeterminate(m_outcome));
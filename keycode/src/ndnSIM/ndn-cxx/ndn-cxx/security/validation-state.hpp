@@ -34,9 +34,13 @@
 
 namespace ndn {
 namespace security {
+
+class MerkleRootCache;
+
 inline namespace v2 {
 
 class Validator;
+class VerificationCache;
 
 /**
  * @brief Validation state
@@ -188,6 +192,27 @@ public:
   const Data&
   getOriginalData() const;
 
+  /**
+   * @brief Share verified Merkle roots with the other packets of a batch
+   * @sa MerkleRootCache
+   */
+  void
+  setMerkleRootCache(shared_ptr<MerkleRootCache> cache)
+  {
+    m_merkleRoots = std::move(cache);
+  }
+
+  /**
+   * @brief Skip the signature verification of data already verified with the same certificate,
+   *        and record successful verifications in @p cache
+   * @sa VerificationCache
+   */
+  void
+  setVerificationCache(shared_ptr<VerificationCache> cache)
+  {
+    m_verificationCache = std::move(cache);
+  }
+
 private:
   void
   verifyOriginalPacket(const optional<Certificate>& trustedCert) final;
@@ -199,6 +224,8 @@ private:
   Data m_data;
   DataValidationSuccessCallback m_successCb;
   DataValidationFailureCallback m_failureCb;
+  shared_ptr<MerkleRootCache> m_merkleRoots;
+  shared_ptr<VerificationCache> m_verificationCache;
 };
 
 /**
@@ -134,12 +134,18 @@ RegexChecker::RegexChecker(tlv::SignatureTypeValue sigType, const Regex& regex)
   : Checker(sigType)
   , m_regex(regex)
 {
+  try {
+    m_compiledRegex.emplace(regex.getExpr());
+  }
+  catch (const CompiledRegex::Error&) {
+    // matched with the backtracking Regex instead
+  }
 }
 
 Checker::Result
 RegexChecker::checkNames(const Name& pktName, const Name& klName)
 {
-  if (m_regex.match(klName)) {
+  if (m_compiledRegex ? m_compiledRegex->match(klName) : m_regex.match(klName)) {
     return accept();
   }
 
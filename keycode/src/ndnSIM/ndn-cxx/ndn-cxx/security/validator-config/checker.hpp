@@ -26,6 +26,7 @@
 #include "ndn-cxx/security/validator-config/common.hpp"
 #include "ndn-cxx/security/validator-config/name-relation.hpp"
 #include "ndn-cxx/util/regex.hpp"
+#include "ndn-cxx/util/regex/compiled-regex.hpp"
 
 namespace ndn {
 namespace security {
@@ -164,6 +165,7 @@ protected:
 
 private:
   Regex m_regex;
+  optional<CompiledRegex> m_compiledRegex; ///< used instead of m_regex if the regex can be compiled
 };
 
 class HyperRelationChecker : public Checker
@@ -79,12 +79,18 @@ RelationNameFilter::matchName(const Name& name)
 RegexNameFilter::RegexNameFilter(const Regex& regex)
   : m_regex(regex)
 {
+  try {
+    m_compiledRegex.emplace(regex.getExpr());
+  }
+  catch (const CompiledRegex::Error&) {
+    // matched with the backtracking Regex instead
+  }
 }
 
 bool
 RegexNameFilter::matchName(const Name& name)
 {
-  return m_regex.match(name);
+  return m_compiledRegex ? m_compiledRegex->match(name) : m_regex.match(name);
 }
 
 unique_ptr<Filter>
@@ -27,6 +27,7 @@
 #include "ndn-cxx/security/validator-config/common.hpp"
 #include "ndn-cxx/security/validator-config/name-relation.hpp"
 #include "ndn-cxx/util/regex.hpp"
+#include "ndn-cxx/util/regex/compiled-regex.hpp"
 
 namespace ndn {
 namespace security {
@@ -121,6 +122,8 @@ private:
  * RegexNameFilter("^[^<KEY>]*<KEY><>*<ksk-.*>$");
  * @endcode
  *
+ * The regex is matched with CompiledRegex, or with Regex if it cannot be compiled.
+ *
  * @sa Regex
  */
 class RegexNameFilter : public Filter
@@ -135,6 +138,7 @@ private:
 
 private:
   Regex m_regex;
+  optional<CompiledRegex> m_compiledRegex;
 };
 
 } // namespace validator_config
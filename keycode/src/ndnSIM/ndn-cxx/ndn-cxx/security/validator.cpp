@@ -23,6 +23,7 @@
 
 #include "ndn-cxx/face.hpp"
 #include "ndn-cxx/security/transform/public-key.hpp"
+#include "ndn-cxx/security/verification-helpers.hpp"
 #include "ndn-cxx/util/logger.hpp"
 
 namespace ndn {
@@ -71,14 +72,89 @@ Validator::getMaxDepth() const
   return m_maxDepth;
 }
 
+void
+Validator::setVerificationCache(shared_ptr<VerificationCache> cache)
+{
+  m_verificationCache = std::move(cache);
+}
+
+const shared_ptr<VerificationCache>&
+Validator::getVerificationCache() const
+{
+  return m_verificationCache;
+}
+
 void
 Validator::validate(const Data& data,
                     const DataValidationSuccessCallback& successCb,
                     const DataValidationFailureCallback& failureCb)
 {
-  auto state = make_shared<DataValidationState>(data, successCb, failureCb);
+  validate(make_shared<DataValidationState>(data, successCb, failureCb));
+}
+
+void
+Validator::validate(span<const Data> batch,
+                    const DataBatchValidationSuccessCallback& successCb,
+                    const DataValidationFailureCallback& failureCb)
+{
+  BOOST_ASSERT(successCb != nullptr);
+  BOOST_ASSERT(failureCb != nullptr);
+
+  if (batch.empty()) {
+    successCb({});
+    return;
+  }
+
+  struct Batch
+  {
+    std::vector<Data> packets;
+    std::vector<bool> isValid;
+    size_t nPending;
+  };
+  auto ctx = make_shared<Batch>();
+  ctx->packets.assign(batch.begin(), batch.end());
+  ctx->isValid.resize(batch.size());
+  ctx->nPending = batch.size();
+
+  auto finishOne = [ctx, successCb] {
+    if (--ctx->nPending > 0) {
+      return;
+    }
+    std::vector<Data> validated;
+    for (size_t i = 0; i < ctx->packets.size(); ++i) {
+      if (ctx->isValid[i]) {
+        validated.push_back(std::move(ctx->packets[i]));
+      }
+    }
+    successCb(validated);
+  };
+
+  auto merkleRoots = make_shared<MerkleRootCache>();
+  for (size_t i = 0; i < batch.size(); ++i) {
+    auto state = make_shared<DataValidationState>(batch[i],
+      [ctx, finishOne, i] (const Data&) {
+        ctx->isValid[i] = true;
+        finishOne();
+      },
+      [finishOne, failureCb] (const Data& data, const ValidationError& error) {
+        failureCb(data, error);
+        finishOne();
+      });
+    state->setMerkleRootCache(merkleRoots);
+    validate(state);
+  }
+}
+
+void
+Validator::validate(const shared_ptr<DataValidationState>& state)
+{
+  const Data& data = state->getOriginalData();
   NDN_LOG_DEBUG_DEPTH("Start validating data " << data.getName());
 
+  if (m_verificationCache != nullptr) {
+    state->setVerificationCache(m_verificationCache);
+  }
+
   m_policy->checkPolicy(data, state,
       [this] (const shared_ptr<CertificateRequest>& certRequest, const shared_ptr<ValidationState>& state) {
       if (certRequest == nullptr) {
@@ -28,6 +28,7 @@
 #include "ndn-cxx/security/validation-callback.hpp"
 #include "ndn-cxx/security/validation-policy.hpp"
 #include "ndn-cxx/security/validation-state.hpp"
+#include "ndn-cxx/security/verification-cache.hpp"
 
 namespace ndn {
 
@@ -89,6 +90,24 @@ public:
   size_t
   getMaxDepth() const;
 
+  /**
+   * @brief Enable or disable caching of Data signature verification results
+   *
+   * When @p cache is set, a Data packet that has already been verified against the same
+   * trusted certificate is accepted without verifying its signature again. The validation
+   * policy is still applied to every packet. Caching is disabled by default.
+   *
+   * @param cache the cache to use, which may be shared among validators; nullptr to disable
+   */
+  void
+  setVerificationCache(shared_ptr<VerificationCache> cache);
+
+  /**
+   * @return The verification result cache, nullptr if caching is disabled
+   */
+  const shared_ptr<VerificationCache>&
+  getVerificationCache() const;
+
   /**
    * @brief Asynchronously validate @p data
    *
@@ -99,6 +118,22 @@ public:
            const DataValidationSuccessCallback& successCb,
            const DataValidationFailureCallback& failureCb);
 
+  /**
+   * @brief Asynchronously validate a batch of Data packets
+   *
+   * Each packet is validated as by validate(const Data&, ...), and @p failureCb is invoked for
+   * every packet that fails validation. Once all packets have been validated, @p successCb is
+   * invoked once with the packets that passed, in their original order, even if none did.
+   * Packets of the batch that carry the same Merkle-batched signature (see
+   * KeyChain::signMerkleBatch()) have the signature over their common root verified only once.
+   *
+   * @note @p successCb and @p failureCb must not be nullptr
+   */
+  void
+  validate(span<const Data> batch,
+           const DataBatchValidationSuccessCallback& successCb,
+           const DataValidationFailureCallback& failureCb);
+
   /**
    * @brief Asynchronously validate @p interest
    *
@@ -157,6 +192,12 @@ public: // anchor management
   resetVerifiedCertificates();
 
 private: // Common validator operations
+  /**
+   * @brief Start the validation of the Data packet in @p state
+   */
+  void
+  validate(const shared_ptr<DataValidationState>& state);
+
   /**
    * @brief Recursive validation of the certificate in the certification chain
    *
@@ -179,6 +220,7 @@ private: // Common validator operations
 private:
   unique_ptr<ValidationPolicy> m_policy;
   unique_ptr<CertificateFetcher> m_certFetcher;
+  shared_ptr<VerificationCache> m_verificationCache;
   size_t m_maxDepth;
 };
 
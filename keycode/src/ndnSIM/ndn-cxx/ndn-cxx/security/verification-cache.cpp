@@ -0,0 +1,118 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/security/verification-cache.hpp"
+#include "ndn-cxx/util/logger.hpp"
+
+namespace ndn {
+namespace security {
+inline namespace v2 {
+
+NDN_LOG_INIT(ndn.security.VerificationCache);
+
+size_t
+VerificationCache::getDefaultCapacity()
+{
+  return 10000;
+}
+
+time::nanoseconds
+VerificationCache::getDefaultLifetime()
+{
+  return 1_h;
+}
+
+VerificationCache::VerificationCache(size_t capacity, const time::nanoseconds& maxLifetime)
+  : m_capacity(capacity)
+  , m_maxLifetime(maxLifetime)
+{
+  BOOST_ASSERT(m_capacity > 0);
+}
+
+void
+VerificationCache::insert(const Name& fullName, const Certificate& cert)
+{
+  auto notAfterTime = cert.getValidityPeriod().getPeriod().second;
+  auto now = time::system_clock::now();
+  if (notAfterTime < now || !cert.hasWire()) {
+    return;
+  }
+  refresh(now);
+
+  auto removalTime = std::min(notAfterTime, now + m_maxLifetime);
+  auto& byName = m_entries.get<1>();
+  auto it = byName.find(fullName);
+  if (it != byName.end()) {
+    byName.modify(it, [&] (Entry& entry) {
+      entry.certFullName = cert.getFullName();
+      entry.removalTime = removalTime;
+    });
+    m_entries.relocate(m_entries.begin(), m_entries.project<0>(it));
+    return;
+  }
+
+  if (m_entries.size() >= m_capacity) {
+    NDN_LOG_TRACE("Evicting " << m_entries.back().fullName);
+    m_entries.pop_back();
+  }
+  m_entries.push_front({fullName, cert.getFullName(), removalTime});
+}
+
+bool
+VerificationCache::contains(const Name& fullName, const Certificate& cert)
+{
+  auto& byName = m_entries.get<1>();
+  auto it = byName.find(fullName);
+  if (it == byName.end() || !cert.hasWire() || it->certFullName != cert.getFullName()) {
+    ++m_nMisses;
+    return false;
+  }
+
+  if (it->removalTime < time::system_clock::now()) {
+    byName.erase(it);
+    ++m_nMisses;
+    return false;
+  }
+
+  m_entries.relocate(m_entries.begin(), m_entries.project<0>(it));
+  ++m_nHits;
+  return true;
+}
+
+void
+VerificationCache::clear()
+{
+  m_entries.clear();
+}
+
+void
+VerificationCache::refresh(const time::system_clock::TimePoint& now)
+{
+  auto& byTime = m_entries.get<2>();
+  auto it = byTime.begin();
+  while (it != byTime.end() && it->removalTime < now) {
+    it = byTime.erase(it);
+  }
+}
+
+} // inline namespace v2
+} // namespace security
+} // namespace ndn
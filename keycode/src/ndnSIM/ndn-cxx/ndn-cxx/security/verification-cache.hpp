@@ -0,0 +1,155 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_SECURITY_VERIFICATION_CACHE_HPP
+#define NDN_CXX_SECURITY_VERIFICATION_CACHE_HPP
+
+#include "ndn-cxx/security/certificate.hpp"
+
+#include <boost/multi_index_container.hpp>
+#include <boost/multi_index/hashed_index.hpp>
+#include <boost/multi_index/member.hpp>
+#include <boost/multi_index/ordered_index.hpp>
+#include <boost/multi_index/sequenced_index.hpp>
+
+namespace ndn {
+namespace security {
+inline namespace v2 {
+
+/**
+ * @brief Bounded cache of successful Data signature verifications.
+ *
+ * An entry records that the Data packet with a given full name (i.e., including the implicit
+ * digest) carries a valid signature by a given certificate, also identified by its full name, so
+ * that another certificate published under the same name does not match. The validator still applies its
+ * policy and builds the certificate chain for every packet, but skips the signature
+ * verification when the packet was already verified against the same trusted certificate.
+ *
+ * An entry is removed no later than the NotAfter time of the certificate, or maxLifetime after
+ * it has been inserted. When the cache is full, the least recently used entry is evicted.
+ */
+class VerificationCache : noncopyable
+{
+public:
+  /**
+   * @brief Create a verification cache.
+   *
+   * @param capacity     maximum number of entries, must be positive
+   * @param maxLifetime  maximum time that an entry could live inside the cache (default: 1 hour)
+   */
+  explicit
+  VerificationCache(size_t capacity = getDefaultCapacity(),
+                    const time::nanoseconds& maxLifetime = getDefaultLifetime());
+
+  /**
+   * @brief Record that the Data with @p fullName has a valid signature by @p cert.
+   *
+   * Nothing is recorded if @p cert has no wire encoding, as it has no full name.
+   */
+  void
+  insert(const Name& fullName, const Certificate& cert);
+
+  /**
+   * @brief Check whether the Data with @p fullName is known to have a valid signature by @p cert.
+   *
+   * Every call is counted as either a hit or a miss.
+   */
+  bool
+  contains(const Name& fullName, const Certificate& cert);
+
+  /**
+   * @brief Remove all entries; the hit and miss counters are preserved.
+   */
+  void
+  clear();
+
+  size_t
+  size() const
+  {
+    return m_entries.size();
+  }
+
+  size_t
+  getCapacity() const
+  {
+    return m_capacity;
+  }
+
+  uint64_t
+  getNHits() const
+  {
+    return m_nHits;
+  }
+
+  uint64_t
+  getNMisses() const
+  {
+    return m_nMisses;
+  }
+
+public:
+  static size_t
+  getDefaultCapacity();
+
+  static time::nanoseconds
+  getDefaultLifetime();
+
+private:
+  /**
+   * @brief Remove all outdated entries.
+   */
+  void
+  refresh(const time::system_clock::TimePoint& now);
+
+private:
+  struct Entry
+  {
+    Name fullName;
+    Name certFullName;
+    time::system_clock::TimePoint removalTime;
+  };
+
+  using EntryIndex = boost::multi_index::multi_index_container<
+    Entry,
+    boost::multi_index::indexed_by<
+      boost::multi_index::sequenced<>,
+      boost::multi_index::hashed_unique<
+        boost::multi_index::member<Entry, Name, &Entry::fullName>,
+        std::hash<Name>
+      >,
+      boost::multi_index::ordered_non_unique<
+        boost::multi_index::member<Entry, time::system_clock::TimePoint, &Entry::removalTime>
+      >
+    >
+  >;
+
+  EntryIndex m_entries;
+  size_t m_capacity;
+  time::nanoseconds m_maxLifetime;
+  uint64_t m_nHits = 0;
+  uint64_t m_nMisses = 0;
+};
+
+} // inline namespace v2
+} // namespace security
+} // namespace ndn
+
+#endif // NDN_CXX_SECURITY_VERIFICATION_CACHE_HPP
@@ -25,6 +25,7 @@
 #include "ndn-cxx/encoding/buffer-stream.hpp"
 #include "ndn-cxx/interest.hpp"
 #include "ndn-cxx/security/certificate.hpp"
+#include "ndn-cxx/security/impl/merkle-tree.hpp"
 #include "ndn-cxx/security/impl/openssl.hpp"
 #include "ndn-cxx/security/pib/key.hpp"
 #include "ndn-cxx/security/tpm/tpm.hpp"
@@ -35,6 +36,8 @@
 #include "ndn-cxx/security/transform/stream-sink.hpp"
 #include "ndn-cxx/security/transform/verifier-filter.hpp"
 
+#include <boost/endian/conversion.hpp>
+
 namespace ndn {
 namespace security {
 
@@ -56,6 +59,8 @@ public:
   SignatureInfo info;
   InputBuffers bufs;
   span<const uint8_t> sig;
+  /// for a Merkle-batched signature, the root digest that @c bufs refers to
+  shared_ptr<const Buffer> merkleRoot;
 };
 
 } // namespace
@@ -94,8 +99,27 @@ static ParseResult
 parse(const Data& data)
 {
   try {
-    return {data.getSignatureInfo(), data.extractSignedRanges(),
-            data.getSignatureValue().value_bytes()};
+    auto leafIndex = data.getSignatureInfo().getCustomTlv(tlv::MerkleLeafIndex);
+    if (!leafIndex) {
+      return {data.getSignatureInfo(), data.extractSignedRanges(),
+              data.getSignatureValue().value_bytes()};
+    }
+
+    // Merkle-batched signature: the signature covers the root recomputed from the audit path
+    if (data.getSignatureType() == tlv::DigestSha256) {
+      return {};
+    }
+    auto leaf = detail::computeMerkleLeaf(data.extractSignedRanges());
+    auto root = detail::computeMerkleRoot(leaf, readNonNegativeInteger(*leafIndex),
+                                          data.getSignatureValue().value_bytes());
+    if (!root) {
+      return {};
+    }
+
+    auto rootBuf = make_shared<const Buffer>(root->first.begin(), root->first.end());
+    ParseResult result(data.getSignatureInfo(), {*rootBuf}, root->second);
+    result.merkleRoot = std::move(rootBuf);
+    return result;
   }
   catch (const tlv::Error&) {
     return {};
@@ -214,15 +238,14 @@ verifySignature(const Interest& interest, const pib::Key& key)
   return verifySignature(parse(interest), key.getPublicKey());
 }
 
-bool
-verifySignature(const Data& data, const optional<Certificate>& cert)
+static bool
+verifySignature(const ParseResult& params, const optional<Certificate>& cert)
 {
-  auto parsed = parse(data);
   if (cert) {
-    return verifySignature(parsed, cert->getContent().value_bytes());
+    return verifySignature(params, cert->getContent().value_bytes());
   }
-  else if (parsed.info.getSignatureType() == tlv::SignatureTypeValue::DigestSha256) {
-    return verifyDigest(parsed, DigestAlgorithm::SHA256);
+  else if (params.info.getSignatureType() == tlv::SignatureTypeValue::DigestSha256) {
+    return verifyDigest(params, DigestAlgorithm::SHA256);
   }
   // Add any other self-verifying signatures here (if any)
   else {
@@ -230,6 +253,65 @@ verifySignature(const Data& data, const optional<Certificate>& cert)
   }
 }
 
+bool
+verifySignature(const Data& data, const optional<Certificate>& cert)
+{
+  return verifySignature(parse(data), cert);
+}
+
+Buffer
+MerkleRootCache::makeEntry(span<const uint8_t> root, span<const uint8_t> sig, span<const uint8_t> key)
+{
+  // root and signature are preceded by their size in network byte order, so that the boundaries
+  // between the fields are unambiguous and the entry is the same on every host
+  auto appendSize = [] (Buffer& entry, uint64_t size) {
+    size = boost::endian::native_to_big(size);
+    auto sizeBytes = reinterpret_cast<const uint8_t*>(&size);
+    entry.insert(entry.end(), sizeBytes, sizeBytes + sizeof(size));
+  };
+
+  Buffer entry;
+  entry.reserve(2 * sizeof(uint64_t) + root.size() + sig.size() + key.size());
+  appendSize(entry, root.size());
+  entry.insert(entry.end(), root.begin(), root.end());
+  appendSize(entry, sig.size());
+  entry.insert(entry.end(), sig.begin(), sig.end());
+  entry.insert(entry.end(), key.begin(), key.end());
+  return entry;
+}
+
+bool
+MerkleRootCache::contains(span<const uint8_t> root, span<const uint8_t> sig,
+                          span<const uint8_t> key) const
+{
+  return m_entries.count(makeEntry(root, sig, key)) > 0;
+}
+
+void
+MerkleRootCache::insert(span<const uint8_t> root, span<const uint8_t> sig, span<const uint8_t> key)
+{
+  m_entries.insert(makeEntry(root, sig, key));
+}
+
+bool
+verifySignature(const Data& data, const optional<Certificate>& cert, MerkleRootCache& cache)
+{
+  auto parsed = parse(data);
+  if (parsed.merkleRoot == nullptr || !cert) {
+    return verifySignature(parsed, cert);
+  }
+
+  auto key = cert->getContent().value_bytes();
+  if (cache.contains(*parsed.merkleRoot, parsed.sig, key)) {
+    return true;
+  }
+  if (!verifySignature(parsed, key)) {
+    return false;
+  }
+  cache.insert(*parsed.merkleRoot, parsed.sig, key);
+  return true;
+}
+
 bool
 verifySignature(const Interest& interest, const optional<Certificate>& cert)
 {
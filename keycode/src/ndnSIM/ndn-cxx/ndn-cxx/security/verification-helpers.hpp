@@ -23,8 +23,11 @@
 #define NDN_CXX_SECURITY_VERIFICATION_HELPERS_HPP
 
 #include "ndn-cxx/name.hpp"
+#include "ndn-cxx/encoding/buffer.hpp"
 #include "ndn-cxx/security/security-common.hpp"
 
+#include <set>
+
 namespace ndn {
 
 class Interest;
@@ -110,6 +113,47 @@ verifySignature(const Interest& interest, const pib::Key& key);
 NDN_CXX_NODISCARD bool
 verifySignature(const Data& data, const optional<Certificate>& cert);
 
+/**
+ * @brief Merkle roots whose signature has been verified, shared by the packets of a batch.
+ *
+ * Every Data signed by KeyChain::signMerkleBatch() carries the signature over the root of its
+ * batch. When the same cache is passed to verifySignature() for several packets of a batch, the
+ * signature over the root is verified once per key, and the other packets only have their audit
+ * path checked against the root.
+ */
+class MerkleRootCache : noncopyable
+{
+public:
+  bool
+  contains(span<const uint8_t> root, span<const uint8_t> sig, span<const uint8_t> key) const;
+
+  void
+  insert(span<const uint8_t> root, span<const uint8_t> sig, span<const uint8_t> key);
+
+  size_t
+  size() const
+  {
+    return m_entries.size();
+  }
+
+private:
+  static Buffer
+  makeEntry(span<const uint8_t> root, span<const uint8_t> sig, span<const uint8_t> key);
+
+private:
+  std::set<Buffer> m_entries;
+};
+
+/**
+ * @brief Verify @p data using @p cert, reusing the verified Merkle roots in @p cache.
+ *
+ * Same as verifySignature(const Data&, const optional<Certificate>&), except that a
+ * Merkle-batched signature whose root is in @p cache is accepted after checking the audit path.
+ * Merkle roots verified by this call are added to @p cache.
+ */
+NDN_CXX_NODISCARD bool
+verifySignature(const Data& data, const optional<Certificate>& cert, MerkleRootCache& cache);
+
 /**
  * @brief Verify @p interest using @p cert.
  * @note This method verifies only signature of the signed interest.
@@ -27,6 +27,8 @@
 #include "ndn-cxx/mgmt/nfd/control-response.hpp"
 #include "ndn-cxx/transport/transport.hpp"
 
+#include "ns3/simulator.h"
+
 #include <boost/asio/io_service.hpp>
 
 namespace ndn {
@@ -94,16 +96,17 @@ DummyClientFace::DummyClientFace(KeyChain& keyChain, const Options& options)
   this->construct(options);
 }
 
-DummyClientFace::DummyClientFace(boost::asio::io_service& ioService, const Options& options)
-  : Face(make_shared<DummyClientFace::Transport>(), ioService)
+// In the simulator, all events of the face are scheduled by ns-3, so the io_service is not used
+DummyClientFace::DummyClientFace(boost::asio::io_service&, const Options& options)
+  : Face(make_shared<DummyClientFace::Transport>())
   , m_internalKeyChain(make_unique<KeyChain>())
   , m_keyChain(*m_internalKeyChain)
 {
   this->construct(options);
 }
 
-DummyClientFace::DummyClientFace(boost::asio::io_service& ioService, KeyChain& keyChain, const Options& options)
-  : Face(make_shared<DummyClientFace::Transport>(), ioService, keyChain)
+DummyClientFace::DummyClientFace(boost::asio::io_service&, KeyChain& keyChain, const Options& options)
+  : Face(make_shared<DummyClientFace::Transport>(), keyChain)
   , m_keyChain(keyChain)
 {
   this->construct(options);
@@ -230,7 +233,8 @@ DummyClientFace::enableRegistrationReply(uint64_t faceId)
     shared_ptr<Data> data = make_shared<Data>(name);
     data->setContent(resp.wireEncode());
     m_keyChain.sign(*data, security::SigningInfo(security::SigningInfo::SIGNER_TYPE_SHA256));
-    this->getIoService().post([this, data] { this->receive(*data); });
+    ns3::Simulator::ScheduleWithContext(ns3::Simulator::GetContext(), ns3::Seconds(0),
+                                        ns3::MakeEvent(std::function<void()>([this, data] { this->receive(*data); })));
   });
 }
 
@@ -320,7 +324,12 @@ DummyClientFace::doProcessEvents(time::milliseconds timeout, bool keepThread)
     m_processEventsOverride(timeout);
   }
   else {
-    this->Face::doProcessEvents(timeout, keepThread);
+    // Face has no event loop in the simulator: run the ns-3 events for the timeout, only those
+    // already due if it is negative, or all of them if it is zero
+    if (timeout != time::milliseconds::zero()) {
+      ns3::Simulator::Stop(ns3::MilliSeconds(std::max<time::milliseconds::rep>(timeout.count(), 0)));
+    }
+    ns3::Simulator::Run();
   }
 }
 
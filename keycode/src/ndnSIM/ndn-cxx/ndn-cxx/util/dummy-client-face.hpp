@@ -93,11 +93,13 @@ public:
   DummyClientFace(KeyChain& keyChain, const Options& options = Options());
 
   /** \brief Create a dummy face with the provided IO service
+   *  \note The IO service is not used: the events of the face are scheduled by ns-3
    */
   explicit
   DummyClientFace(boost::asio::io_service& ioService, const Options& options = Options());
 
   /** \brief Create a dummy face with the provided IO service and the specified KeyChain
+   *  \note The IO service is not used: the events of the face are scheduled by ns-3
    */
   DummyClientFace(boost::asio::io_service& ioService, KeyChain& keyChain,
                   const Options& options = Options());
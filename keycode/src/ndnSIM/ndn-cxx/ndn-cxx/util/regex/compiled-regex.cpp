@@ -0,0 +1,518 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/util/regex/compiled-regex.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <map>
+
+namespace ndn {
+
+namespace {
+
+constexpr size_t MAX_POSITIONS = 63; // bit 63 of a position set denotes the initial state
+constexpr uint64_t INITIAL_POSITION = uint64_t(1) << MAX_POSITIONS;
+constexpr size_t MAX_COMPONENT_REGEXES = 8;
+constexpr size_t MAX_TRANSITIONS = 1 << 16;
+constexpr size_t INFINITE_REPETITIONS = std::numeric_limits<size_t>::max();
+
+/**
+ * @brief Component set: matches a component if any of its atoms does, or if none does when
+ *        the set is negated.
+ */
+struct ComponentSet
+{
+  bool isInclusion = true;
+  bool hasAny = false;
+  std::vector<size_t> literals;
+  std::vector<size_t> regexes;
+};
+
+/**
+ * @brief Parse tree of a pattern list: a component set, a sequence, or a repetition.
+ */
+struct Node
+{
+  enum Type { SET, SEQUENCE, REPEAT };
+
+  Type type = SEQUENCE;
+  size_t set = 0;
+  std::vector<Node> children;
+  size_t repeatMin = 1;
+  size_t repeatMax = 1;
+};
+
+/**
+ * @brief Glushkov automaton of a parsed subexpression
+ */
+struct Fragment
+{
+  uint64_t first = 0;
+  uint64_t last = 0;
+  bool isNullable = true;
+};
+
+bool
+isSpecialChar(char c)
+{
+  return std::strchr(".[]{}()\\*+?|^$", c) != nullptr;
+}
+
+class Compiler
+{
+public:
+  explicit
+  Compiler(const std::string& expr)
+    : m_expr(expr)
+  {
+  }
+
+  Node
+  parsePatternList(size_t begin, size_t end)
+  {
+    Node sequence;
+    size_t index = begin;
+    while (index < end) {
+      size_t start = index;
+      Node item;
+      switch (m_expr[index]) {
+        case '(':
+          index = extractSubPattern('(', ')', index + 1, end);
+          item = parsePatternList(start + 1, index - 1);
+          break;
+        case '<':
+          index = extractSubPattern('<', '>', index + 1, end);
+          item.type = Node::SET;
+          item.set = m_sets.size();
+          m_sets.emplace_back();
+          addAtom(m_sets.back(), start + 1, index - 1);
+          break;
+        case '[':
+          index = extractSubPattern('[', ']', index + 1, end);
+          item.type = Node::SET;
+          item.set = m_sets.size();
+          m_sets.push_back(parseComponentSet(start + 1, index - 1));
+          break;
+        default:
+          NDN_THROW(CompiledRegex::Error("Unexpected character "s + m_expr[index]));
+      }
+      index = parseRepetition(index, end, item);
+      sequence.children.push_back(std::move(item));
+    }
+    return sequence;
+  }
+
+  Fragment
+  build(const Node& node)
+  {
+    switch (node.type) {
+      case Node::SET: {
+        if (m_positionSets.size() >= MAX_POSITIONS) {
+          NDN_THROW(CompiledRegex::Error("Too many component positions in regex: " + m_expr));
+        }
+        uint64_t position = uint64_t(1) << m_positionSets.size();
+        m_positionSets.push_back(node.set);
+        m_follow.push_back(0);
+        return {position, position, false};
+      }
+      case Node::SEQUENCE: {
+        Fragment result;
+        for (const auto& child : node.children) {
+          result = concatenate(result, build(child));
+        }
+        return result;
+      }
+      case Node::REPEAT: {
+        const Node& child = node.children.front();
+        Fragment result;
+        if (!hasSets(child)) {
+          return result; // the child only matches the empty sequence
+        }
+        for (size_t i = 0; i < node.repeatMin; ++i) {
+          result = concatenate(result, build(child));
+        }
+        if (node.repeatMax == INFINITE_REPETITIONS) {
+          Fragment loop = build(child);
+          forEachPosition(loop.last, [&] (size_t p) { m_follow[p] |= loop.first; });
+          loop.isNullable = true;
+          result = concatenate(result, loop);
+        }
+        else {
+          for (size_t i = node.repeatMin; i < node.repeatMax; ++i) {
+            Fragment optional = build(child);
+            optional.isNullable = true;
+            result = concatenate(result, optional);
+          }
+        }
+        return result;
+      }
+    }
+    return {};
+  }
+
+  uint64_t
+  getFollow(size_t position) const
+  {
+    return m_follow[position];
+  }
+
+  /**
+   * @brief Returns the positions whose component set contains the class
+   */
+  uint64_t
+  getMatchingPositions(size_t literal, size_t regexBits) const
+  {
+    uint64_t positions = 0;
+    for (size_t p = 0; p < m_positionSets.size(); ++p) {
+      const ComponentSet& set = m_sets[m_positionSets[p]];
+      bool isMatched = set.hasAny ||
+                       std::find(set.literals.begin(), set.literals.end(), literal) != set.literals.end() ||
+                       std::any_of(set.regexes.begin(), set.regexes.end(),
+                                   [=] (size_t r) { return (regexBits >> r) & 1; });
+      if (isMatched == set.isInclusion) {
+        positions |= uint64_t(1) << p;
+      }
+    }
+    return positions;
+  }
+
+  template<typename F>
+  static void
+  forEachPosition(uint64_t positions, const F& f)
+  {
+    for (size_t p = 0; positions != 0; ++p, positions >>= 1) {
+      if (positions & 1) {
+        f(p);
+      }
+    }
+  }
+
+public:
+  std::vector<name::Component> literals;
+  std::vector<std::string> regexes;
+
+private:
+  size_t
+  extractSubPattern(char left, char right, size_t index, size_t end) const
+  {
+    size_t lcount = 1;
+    size_t rcount = 0;
+    while (lcount > rcount) {
+      if (index >= end) {
+        NDN_THROW(CompiledRegex::Error("Parenthesis mismatch in regex: " + m_expr));
+      }
+      if (m_expr[index] == left) {
+        lcount++;
+      }
+      else if (m_expr[index] == right) {
+        rcount++;
+      }
+      index++;
+    }
+    return index;
+  }
+
+  ComponentSet
+  parseComponentSet(size_t begin, size_t end)
+  {
+    ComponentSet set;
+    if (begin < end && m_expr[begin] == '^') {
+      set.isInclusion = false;
+      begin++;
+    }
+    while (begin < end) {
+      if (m_expr[begin] != '<') {
+        NDN_THROW(CompiledRegex::Error("Component expr error: " + m_expr));
+      }
+      size_t next = extractSubPattern('<', '>', begin + 1, end);
+      addAtom(set, begin + 1, next - 1);
+      begin = next;
+    }
+    return set;
+  }
+
+  void
+  addAtom(ComponentSet& set, size_t begin, size_t end)
+  {
+    std::string text = m_expr.substr(begin, end - begin);
+    if (text.empty() || text == ".*") {
+      set.hasAny = true;
+      return;
+    }
+
+    // an expression without unescaped special characters matches a single component
+    std::string unescaped;
+    bool isLiteral = true;
+    for (size_t i = 0; i < text.size() && isLiteral; ++i) {
+      if (text[i] == '\\' && i + 1 < text.size() && isSpecialChar(text[i + 1])) {
+        unescaped.push_back(text[++i]);
+      }
+      else if (isSpecialChar(text[i])) {
+        isLiteral = false;
+      }
+      else {
+        unescaped.push_back(text[i]);
+      }
+    }
+
+    if (isLiteral) {
+      optional<name::Component> component;
+      try {
+        component = name::Component::fromEscapedString(unescaped);
+      }
+      catch (const name::Component::Error&) {
+      }
+      // the component matcher compares against the URI, so the literal must be in canonical form
+      if (component && component->toUri() == unescaped) {
+        auto it = std::find(literals.begin(), literals.end(), *component);
+        set.literals.push_back(static_cast<size_t>(it - literals.begin()));
+        if (it == literals.end()) {
+          literals.push_back(*component);
+        }
+        return;
+      }
+    }
+
+    auto it = std::find(regexes.begin(), regexes.end(), text);
+    set.regexes.push_back(static_cast<size_t>(it - regexes.begin()));
+    if (it == regexes.end()) {
+      if (regexes.size() >= MAX_COMPONENT_REGEXES) {
+        NDN_THROW(CompiledRegex::Error("Too many component expressions in regex: " + m_expr));
+      }
+      regexes.push_back(text);
+    }
+  }
+
+  size_t
+  parseRepetition(size_t index, size_t end, Node& item) const
+  {
+    size_t repeatMin = 1;
+    size_t repeatMax = 1;
+    if (index < end) {
+      switch (m_expr[index]) {
+        case '?':
+          repeatMin = 0;
+          index++;
+          break;
+        case '+':
+          repeatMax = INFINITE_REPETITIONS;
+          index++;
+          break;
+        case '*':
+          repeatMin = 0;
+          repeatMax = INFINITE_REPETITIONS;
+          index++;
+          break;
+        case '{': {
+          size_t close = m_expr.find('}', index);
+          if (close == std::string::npos || close >= end) {
+            NDN_THROW(CompiledRegex::Error("Missing closing brace in regex: " + m_expr));
+          }
+          std::string bounds = m_expr.substr(index + 1, close - index - 1);
+          size_t separator = bounds.find(',');
+          try {
+            if (separator == std::string::npos) {
+              repeatMin = repeatMax = parseCount(bounds);
+            }
+            else {
+              repeatMin = separator == 0 ? 0 : parseCount(bounds.substr(0, separator));
+              repeatMax = separator + 1 == bounds.size() ? INFINITE_REPETITIONS
+                                                         : parseCount(bounds.substr(separator + 1));
+            }
+          }
+          catch (const std::logic_error&) {
+            NDN_THROW_NESTED(CompiledRegex::Error("Invalid number of repetitions in regex: " + m_expr));
+          }
+          if (repeatMin > repeatMax) {
+            NDN_THROW(CompiledRegex::Error("Invalid number of repetitions in regex: " + m_expr));
+          }
+          index = close + 1;
+          break;
+        }
+      }
+    }
+
+    if (repeatMin != 1 || repeatMax != 1) {
+      Node repeat;
+      repeat.type = Node::REPEAT;
+      repeat.repeatMin = repeatMin;
+      repeat.repeatMax = repeatMax;
+      repeat.children.push_back(std::move(item));
+      item = std::move(repeat);
+    }
+    return index;
+  }
+
+  static size_t
+  parseCount(const std::string& str)
+  {
+    if (str.empty() || !std::all_of(str.begin(), str.end(), [] (char c) { return c >= '0' && c <= '9'; })) {
+      NDN_THROW(std::invalid_argument(str));
+    }
+    return std::stoul(str);
+  }
+
+  static bool
+  hasSets(const Node& node)
+  {
+    return node.type == Node::SET ||
+           std::any_of(node.children.begin(), node.children.end(), &hasSets);
+  }
+
+  Fragment
+  concatenate(const Fragment& a, const Fragment& b)
+  {
+    forEachPosition(a.last, [&] (size_t p) { m_follow[p] |= b.first; });
+    return {a.first | (a.isNullable ? b.first : 0),
+            b.last | (b.isNullable ? a.last : 0),
+            a.isNullable && b.isNullable};
+  }
+
+private:
+  const std::string& m_expr;
+  std::vector<ComponentSet> m_sets;
+  std::vector<size_t> m_positionSets; ///< component set of each position
+  std::vector<uint64_t> m_follow; ///< positions that can follow each position
+};
+
+} // namespace
+
+CompiledRegex::CompiledRegex(const std::string& expr)
+  : m_expr(expr)
+{
+  if (expr.empty()) {
+    NDN_THROW(Error("Empty regex"));
+  }
+
+  // same anchoring as RegexTopMatcher: an unanchored side matches any components
+  size_t begin = expr.front() == '^' ? 1 : 0;
+  size_t end = expr.size() > begin && expr.back() == '$' ? expr.size() - 1 : expr.size();
+  std::string pattern = (begin == 0 ? "<>*" : "") + expr.substr(begin, end - begin) +
+                        (end == expr.size() ? "<>*" : "");
+
+  Compiler compiler(pattern);
+  Fragment top = compiler.build(compiler.parsePatternList(0, pattern.size()));
+
+  m_literals = compiler.literals;
+  std::vector<size_t> literalOrder(m_literals.size());
+  for (size_t i = 0; i < literalOrder.size(); ++i) {
+    literalOrder[i] = i;
+  }
+  std::sort(literalOrder.begin(), literalOrder.end(),
+            [this] (size_t a, size_t b) { return m_literals[a] < m_literals[b]; });
+  std::sort(m_literals.begin(), m_literals.end());
+
+  try {
+    for (const auto& re : compiler.regexes) {
+      m_componentRegexes.emplace_back(re);
+    }
+  }
+  catch (const std::regex_error&) {
+    NDN_THROW_NESTED(Error("Invalid component expression in regex: " + expr));
+  }
+
+  // A class is (index of the matching literal in sorted order, or m_literals.size() if none)
+  // plus (m_literals.size() + 1) * (bitmask of the matching component regexes).
+  size_t nLiteralClasses = m_literals.size() + 1;
+  m_nClasses = nLiteralClasses << m_componentRegexes.size();
+  std::vector<uint64_t> classPositions(m_nClasses);
+  for (size_t c = 0; c < m_nClasses; ++c) {
+    size_t literal = c % nLiteralClasses;
+    classPositions[c] = compiler.getMatchingPositions(literal == m_literals.size() ? literal
+                                                                                   : literalOrder[literal],
+                                                      c / nLiteralClasses);
+  }
+
+  // subset construction; state 0 rejects, state 1 is initial
+  std::vector<uint64_t> states{0, INITIAL_POSITION};
+  std::map<uint64_t, uint32_t> stateIds{{0, 0}, {INITIAL_POSITION, 1}};
+  m_transitions.assign(2 * m_nClasses, 0);
+  for (size_t s = 1; s < states.size(); ++s) {
+    uint64_t reachable = 0;
+    Compiler::forEachPosition(states[s] & ~INITIAL_POSITION,
+                              [&] (size_t p) { reachable |= compiler.getFollow(p); });
+    if (states[s] & INITIAL_POSITION) {
+      reachable |= top.first;
+    }
+
+    for (size_t c = 0; c < m_nClasses; ++c) {
+      uint64_t next = reachable & classPositions[c];
+      auto it = stateIds.emplace(next, static_cast<uint32_t>(states.size())).first;
+      if (it->second == states.size()) {
+        if ((states.size() + 1) * m_nClasses > MAX_TRANSITIONS) {
+          NDN_THROW(Error("Automaton is too large for regex: " + expr));
+        }
+        states.push_back(next);
+        m_transitions.resize(states.size() * m_nClasses, 0);
+      }
+      m_transitions[s * m_nClasses + c] = it->second;
+    }
+  }
+
+  m_isAccepting.resize(states.size());
+  for (size_t s = 1; s < states.size(); ++s) {
+    m_isAccepting[s] = (states[s] & top.last) != 0 ||
+                       ((states[s] & INITIAL_POSITION) != 0 && top.isNullable);
+  }
+}
+
+bool
+CompiledRegex::match(const Name& name) const
+{
+  size_t state = 1;
+  for (const auto& component : name) {
+    state = m_transitions[state * m_nClasses + classify(component)];
+    if (state == 0) {
+      return false;
+    }
+  }
+  return m_isAccepting[state];
+}
+
+size_t
+CompiledRegex::classify(const name::Component& component) const
+{
+  auto it = std::lower_bound(m_literals.begin(), m_literals.end(), component);
+  size_t literal = it != m_literals.end() && *it == component ?
+                   static_cast<size_t>(it - m_literals.begin()) : m_literals.size();
+
+  size_t regexBits = 0;
+  if (!m_componentRegexes.empty()) {
+    std::string uri = component.toUri();
+    for (size_t i = 0; i < m_componentRegexes.size(); ++i) {
+      if (std::regex_match(uri, m_componentRegexes[i])) {
+        regexBits |= size_t(1) << i;
+      }
+    }
+  }
+
+  return regexBits * (m_literals.size() + 1) + literal;
+}
+
+std::ostream&
+operator<<(std::ostream& os, const CompiledRegex& regex)
+{
+  return os << regex.getExpr();
+}
+
+} // namespace ndn
@@ -0,0 +1,97 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_UTIL_REGEX_COMPILED_REGEX_HPP
+#define NDN_CXX_UTIL_REGEX_COMPILED_REGEX_HPP
+
+#include "ndn-cxx/util/regex/regex-matcher.hpp"
+
+#include <regex>
+
+namespace ndn {
+
+/**
+ * @brief A name regex compiled into a deterministic automaton over name components.
+ *
+ * Accepts the same syntax as Regex and matches the same names, but only answers whether a name
+ * matches: back references are parsed as plain groups and no expansion is possible.
+ *
+ * Every distinct component expression in the regex becomes an atom. An expression without
+ * special characters is a literal component, `<>` and `<.*>` match any component, and anything
+ * else is kept as a std::regex. A name component is classified by the literal it equals and
+ * the set of std::regex atoms it matches; the automaton has one transition per state and class.
+ * Matching is therefore a single pass over the name that does not allocate, except for
+ * converting components to URIs when the regex has non-literal component expressions.
+ *
+ * Compilation fails with Error if the regex has more than 63 component positions after
+ * expanding repetitions, more than 8 non-literal component expressions, or if the automaton
+ * would be too large. Such regexes can still be matched with Regex.
+ */
+class CompiledRegex
+{
+public:
+  using Error = RegexMatcher::Error;
+
+  explicit
+  CompiledRegex(const std::string& expr);
+
+  /**
+   * @brief Returns whether @p name matches the regex.
+   *
+   * This method does not modify the object and can be called concurrently.
+   */
+  bool
+  match(const Name& name) const;
+
+  const std::string&
+  getExpr() const
+  {
+    return m_expr;
+  }
+
+  /**
+   * @brief Returns the number of states of the automaton, including the rejecting state
+   */
+  size_t
+  getNStates() const
+  {
+    return m_isAccepting.size();
+  }
+
+private:
+  size_t
+  classify(const name::Component& component) const;
+
+private:
+  std::string m_expr;
+  std::vector<name::Component> m_literals; ///< sorted
+  std::vector<std::regex> m_componentRegexes;
+  size_t m_nClasses;
+  std::vector<uint32_t> m_transitions; ///< indexed by (state * m_nClasses + class)
+  std::vector<bool> m_isAccepting;
+};
+
+std::ostream&
+operator<<(std::ostream& os, const CompiledRegex& regex);
+
+} // namespace ndn
+
+#endif // NDN_CXX_UTIL_REGEX_COMPILED_REGEX_HPP
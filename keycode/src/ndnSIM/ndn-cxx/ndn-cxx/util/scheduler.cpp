@@ -26,6 +26,8 @@
 namespace ndn {
 namespace scheduler {
 
+const time::nanoseconds DEFAULT_COARSE_GRANULARITY = 1_ms;
+
 /** \brief Stores internal information about a scheduled event
  */
 class EventInfo : noncopyable
@@ -47,6 +49,8 @@ public:
 public:
   EventCallback callback;
   Scheduler::EventQueue::const_iterator queueIt;
+  Scheduler::WheelSlot* wheelSlot = nullptr; ///< non-null if the event is in the timing wheel
+  Scheduler::WheelSlot::iterator wheelIt;
   time::steady_clock::TimePoint expireTime;
   bool isExpired = false;
   uint32_t context = 0;
@@ -84,6 +88,7 @@ Scheduler::EventQueueCompare::operator()(const shared_ptr<EventInfo>& a,
 }
 
 Scheduler::Scheduler(DummyIoService& ioService)
+  : m_wheelGranularity(DEFAULT_COARSE_GRANULARITY)
 {
 }
 
@@ -108,6 +113,34 @@ Scheduler::schedule(time::nanoseconds after, EventCallback callback)
   return EventId(*this, *i);
 }
 
+EventId
+Scheduler::scheduleCoarse(time::nanoseconds after, EventCallback callback)
+{
+  if (m_wheelGranularity <= 0_ns) {
+    return schedule(after, std::move(callback));
+  }
+  BOOST_ASSERT(callback != nullptr);
+
+  auto info = std::make_shared<EventInfo>(after, std::move(callback), ns3::Simulator::GetContext());
+  if (m_nWheelEvents == 0 && !m_isWheelExecuting) {
+    // wheel position is meaningless while the wheel is empty
+    m_wheelTick = toWheelTick(time::steady_clock::now(), false);
+  }
+  // never place a new event into the slot of the current tick, which may be executing
+  insertIntoWheel(info, std::max(toWheelTick(info->expireTime, true), m_wheelTick + 1));
+  ++m_nWheelEvents;
+  scheduleNextWheelTick();
+
+  return EventId(*this, info);
+}
+
+void
+Scheduler::setCoarseGranularity(time::nanoseconds granularity)
+{
+  BOOST_ASSERT(m_nWheelEvents == 0);
+  m_wheelGranularity = granularity;
+}
+
 void
 Scheduler::cancelImpl(const shared_ptr<EventInfo>& info)
 {
@@ -115,15 +148,25 @@ Scheduler::cancelImpl(const shared_ptr<EventInfo>& info)
     return;
   }
 
-  if (m_timerEvent) {
-    if (!m_timerEvent->IsExpired()) {
-      ns3::Simulator::Remove(*m_timerEvent);
-    }
-    m_timerEvent.reset();
+  if (info->wheelSlot != nullptr) {
+    // the wheel timer is left armed; it is cheaper to let it fire once with nothing to do
+    info->wheelSlot->erase(info->wheelIt);
+    info->wheelSlot = nullptr;
+    --m_nWheelEvents;
+    return;
   }
+
+  bool isHead = info->queueIt == m_queue.begin();
   m_queue.erase(info->queueIt);
 
-  if (!m_isEventExecuting) {
+  // the internal timer only needs to move if the earliest event was canceled
+  if (isHead && !m_isEventExecuting) {
+    if (m_timerEvent) {
+      if (!m_timerEvent->IsExpired()) {
+        ns3::Simulator::Remove(*m_timerEvent);
+      }
+      m_timerEvent.reset();
+    }
     scheduleNext();
   }
 }
@@ -138,6 +181,22 @@ Scheduler::cancelAllEvents()
     }
     m_timerEvent.reset();
   }
+
+  for (auto& level : m_wheel) {
+    for (auto& slot : level) {
+      for (const auto& info : slot) {
+        info->wheelSlot = nullptr;
+      }
+      slot.clear();
+    }
+  }
+  m_nWheelEvents = 0;
+  if (m_wheelTimerEvent) {
+    if (!m_wheelTimerEvent->IsExpired()) {
+      ns3::Simulator::Remove(*m_wheelTimerEvent);
+    }
+    m_wheelTimerEvent.reset();
+  }
 }
 
 void
@@ -180,5 +239,137 @@ Scheduler::executeEvent()
   }
 }
 
+uint64_t
+Scheduler::toWheelTick(time::steady_clock::TimePoint tp, bool roundUp) const
+{
+  auto sinceEpoch = std::max<int64_t>(time::duration_cast<time::nanoseconds>(tp.time_since_epoch()).count(), 0);
+  auto granularity = static_cast<uint64_t>(m_wheelGranularity.count());
+  auto ns = static_cast<uint64_t>(sinceEpoch);
+  return roundUp ? (ns + granularity - 1) / granularity : ns / granularity;
+}
+
+void
+Scheduler::insertIntoWheel(const shared_ptr<EventInfo>& info, uint64_t tick)
+{
+  BOOST_ASSERT(tick >= m_wheelTick);
+
+  // events beyond the wheel horizon are parked in the farthest slot and re-inserted from there
+  const uint64_t horizon = uint64_t(1) << (WHEEL_SLOT_BITS * WHEEL_LEVELS);
+  tick = std::min(tick, m_wheelTick + horizon - 1);
+
+  uint64_t delta = tick - m_wheelTick;
+  size_t level = 0;
+  while (level + 1 < WHEEL_LEVELS && delta >= (uint64_t(1) << (WHEEL_SLOT_BITS * (level + 1)))) {
+    ++level;
+  }
+
+  auto& slot = m_wheel[level][(tick >> (WHEEL_SLOT_BITS * level)) & (WHEEL_SLOTS - 1)];
+  info->wheelIt = slot.insert(slot.end(), info);
+  info->wheelSlot = &slot;
+}
+
+uint64_t
+Scheduler::findNextWheelTick() const
+{
+  uint64_t next = std::numeric_limits<uint64_t>::max();
+  for (size_t level = 0; level < WHEEL_LEVELS; ++level) {
+    size_t shift = WHEEL_SLOT_BITS * level;
+    uint64_t base = m_wheelTick >> shift;
+    // a slot at level > 0 is due when the wheel reaches the first tick of its range
+    for (uint64_t offset = 1; offset <= WHEEL_SLOTS; ++offset) {
+      if (!m_wheel[level][(base + offset) & (WHEEL_SLOTS - 1)].empty()) {
+        next = std::min(next, (base + offset) << shift);
+        break;
+      }
+    }
+  }
+  return next;
+}
+
+void
+Scheduler::scheduleNextWheelTick()
+{
+  if (m_isWheelExecuting || m_nWheelEvents == 0) {
+    return;
+  }
+
+  uint64_t next = findNextWheelTick();
+  if (m_wheelTimerEvent) {
+    if (!m_wheelTimerEvent->IsExpired() && m_wheelTimerTick <= next) {
+      return;
+    }
+    if (!m_wheelTimerEvent->IsExpired()) {
+      ns3::Simulator::Remove(*m_wheelTimerEvent);
+    }
+  }
+
+  auto nextTime = time::steady_clock::TimePoint(time::nanoseconds(next * m_wheelGranularity.count()));
+  auto after = std::max(time::duration_cast<time::nanoseconds>(nextTime - time::steady_clock::now()), 0_ns);
+  m_wheelTimerEvent = ns3::Simulator::Schedule(ns3::NanoSeconds(after.count()),
+                                               &Scheduler::executeWheel, this);
+  m_wheelTimerTick = next;
+}
+
+void
+Scheduler::executeWheel()
+{
+  m_isWheelExecuting = true;
+
+  m_wheelTimerEvent.reset();
+  BOOST_SCOPE_EXIT(this_) {
+    this_->m_isWheelExecuting = false;
+    this_->scheduleNextWheelTick();
+  } BOOST_SCOPE_EXIT_END
+
+  auto now = time::steady_clock::now();
+  uint64_t nowTick = toWheelTick(now, false);
+
+  while (m_nWheelEvents > 0) {
+    uint64_t tick = findNextWheelTick();
+    if (tick > nowTick) {
+      break;
+    }
+    m_wheelTick = tick;
+
+    // move events from higher levels whose range starts at this tick closer to level 0
+    for (size_t level = WHEEL_LEVELS - 1; level > 0; --level) {
+      size_t shift = WHEEL_SLOT_BITS * level;
+      if ((tick & ((uint64_t(1) << shift) - 1)) != 0) {
+        continue;
+      }
+      auto& slot = m_wheel[level][(tick >> shift) & (WHEEL_SLOTS - 1)];
+      while (!slot.empty()) {
+        shared_ptr<EventInfo> info = slot.front();
+        slot.pop_front();
+        insertIntoWheel(info, std::max(toWheelTick(info->expireTime, true), m_wheelTick));
+      }
+    }
+
+    auto& slot = m_wheel[0][tick & (WHEEL_SLOTS - 1)];
+    while (!slot.empty()) {
+      shared_ptr<EventInfo> info = slot.front();
+      slot.pop_front();
+      if (info->expireTime > now) {
+        // parked beyond the horizon
+        insertIntoWheel(info, std::max(toWheelTick(info->expireTime, true), m_wheelTick + 1));
+        continue;
+      }
+
+      info->wheelSlot = nullptr;
+      info->isExpired = true;
+      --m_nWheelEvents;
+      if (ns3::Simulator::GetContext() == info->context) {
+        info->callback();
+      }
+      else {
+        ns3::Simulator::ScheduleWithContext(info->context, ns3::Seconds(0), ns3::MakeEvent(info->callback));
+      }
+    }
+  }
+
+  // no slot is due between the last processed tick and now
+  m_wheelTick = std::max(m_wheelTick, nowTick);
+}
+
 } // namespace scheduler
 } // namespace ndn
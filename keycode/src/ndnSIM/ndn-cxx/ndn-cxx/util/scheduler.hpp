@@ -28,6 +28,8 @@
 
 #include "ns3/simulator.h"
 
+#include <array>
+#include <list>
 #include <set>
 
 namespace ndn {
@@ -143,12 +145,44 @@ public:
   EventId
   schedule(time::nanoseconds after, EventCallback callback);
 
+  /** \brief Schedule a one-time event that does not need sub-tick precision
+   *
+   *  The event is kept in a hierarchical timing wheel instead of the ordered queue, which makes
+   *  both scheduling and cancellation O(1), and all events falling into the same tick share a
+   *  single simulator event.  The callback is invoked no earlier than \p after and no later than
+   *  one tick (see setCoarseGranularity()) after that.
+   *
+   *  This is intended for timers that are frequently scheduled and mostly canceled, such as PIT
+   *  entry expiration or strategy retransmission timeouts.
+   *
+   *  \return EventId that can be used to cancel the scheduled event
+   */
+  EventId
+  scheduleCoarse(time::nanoseconds after, EventCallback callback);
+
+  /** \brief Set the tick duration of the timing wheel used by scheduleCoarse()
+   *
+   *  A zero granularity disables the timing wheel, and scheduleCoarse() behaves as schedule().
+   *
+   *  \pre No coarse-grained event is pending.
+   */
+  void
+  setCoarseGranularity(time::nanoseconds granularity);
+
+  time::nanoseconds
+  getCoarseGranularity() const noexcept
+  {
+    return m_wheelGranularity;
+  }
+
   /** \brief Cancel all scheduled events
    */
   void
   cancelAllEvents();
 
 private:
+  using WheelSlot = std::list<shared_ptr<EventInfo>>;
+
   void
   cancelImpl(const shared_ptr<EventInfo>& info);
 
@@ -162,6 +196,29 @@ private:
   void
   executeEvent();
 
+  uint64_t
+  toWheelTick(time::steady_clock::TimePoint tp, bool roundUp) const;
+
+  /** \brief Place a coarse-grained event into the wheel slot corresponding to \p tick
+   */
+  void
+  insertIntoWheel(const shared_ptr<EventInfo>& info, uint64_t tick);
+
+  /** \brief Find the earliest tick at which some wheel slot needs to be processed
+   */
+  uint64_t
+  findNextWheelTick() const;
+
+  /** \brief Schedule the internal timer for the next tick that has pending work
+   */
+  void
+  scheduleNextWheelTick();
+
+  /** \brief Cascade and execute all wheel slots that are due
+   */
+  void
+  executeWheel();
+
 private:
   class EventQueueCompare
   {
@@ -176,6 +233,18 @@ private:
   bool m_isEventExecuting = false;
   std::optional<ns3::EventId> m_timerEvent;
 
+  static constexpr size_t WHEEL_LEVELS = 4;
+  static constexpr size_t WHEEL_SLOT_BITS = 6;
+  static constexpr size_t WHEEL_SLOTS = 1 << WHEEL_SLOT_BITS;
+
+  std::array<std::array<WheelSlot, WHEEL_SLOTS>, WHEEL_LEVELS> m_wheel;
+  time::nanoseconds m_wheelGranularity;
+  uint64_t m_wheelTick = 0; ///< last tick processed by the timing wheel
+  size_t m_nWheelEvents = 0;
+  bool m_isWheelExecuting = false;
+  std::optional<ns3::EventId> m_wheelTimerEvent;
+  uint64_t m_wheelTimerTick = 0; ///< tick at which m_wheelTimerEvent fires
+
   friend EventId;
   friend EventInfo;
 };
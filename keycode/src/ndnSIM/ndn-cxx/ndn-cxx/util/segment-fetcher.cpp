@@ -32,11 +32,13 @@
 #include <boost/range/adaptor/map.hpp>
 
 #include <cmath>
+#include <limits>
 
 namespace ndn {
 namespace util {
 
 constexpr double SegmentFetcher::MIN_SSTHRESH;
+constexpr size_t SegmentFetcher::MAX_PREALLOCATION;
 
 void
 SegmentFetcher::Options::validate()
@@ -56,6 +58,14 @@ SegmentFetcher::Options::validate()
   if (mdCoef < 0.0 || mdCoef > 1.0) {
     NDN_THROW(std::invalid_argument("mdCoef must be in range [0, 1]"));
   }
+
+  if (cubicBeta <= 0.0 || cubicBeta >= 1.0) {
+    NDN_THROW(std::invalid_argument("cubicBeta must be in range (0, 1)"));
+  }
+
+  if (cubicC <= 0.0) {
+    NDN_THROW(std::invalid_argument("cubicC must be greater than 0"));
+  }
 }
 
 SegmentFetcher::SegmentFetcher(Face& face,
@@ -69,6 +79,7 @@ SegmentFetcher::SegmentFetcher(Face& face,
   , m_timeLastSegmentReceived(time::steady_clock::now())
   , m_cwnd(options.initCwnd)
   , m_ssthresh(options.initSsthresh)
+  , m_lastDecrease(time::steady_clock::now())
 {
   m_options.validate();
 }
@@ -148,7 +159,7 @@ SegmentFetcher::fetchSegmentsInWindow(const Interest& origInterest)
       segmentsToRequest.emplace_back(pendingSegmentIt->first, true);
     }
     else if (m_nSegments == 0 || m_nextSegmentNum < static_cast<uint64_t>(m_nSegments)) {
-      if (m_segmentBuffer.count(m_nextSegmentNum) > 0) {
+      if (m_receivedSegments.count(m_nextSegmentNum) > 0) {
         // Don't request a segment a second time if received in response to first "discovery" Interest
         m_nextSegmentNum++;
         continue;
@@ -271,13 +282,21 @@ SegmentFetcher::afterValidationSuccess(const Data& data, const Interest& origInt
   // Remove from pending segments map
   m_pendingSegments.erase(pendingSegmentIt);
 
-  // Copy data in segment to temporary buffer
-  auto receivedSegmentIt = m_segmentBuffer.emplace(std::piecewise_construct,
-                                                   std::forward_as_tuple(currentSegment),
-                                                   std::forward_as_tuple(data.getContent().value_size()));
-  std::copy(data.getContent().value_begin(), data.getContent().value_end(),
-            receivedSegmentIt.first->second.begin());
-  m_nBytesReceived += data.getContent().value_size();
+  auto content = data.getContent().value_bytes();
+  if (m_options.inOrder) {
+    // Copy data in segment to temporary buffer
+    m_segmentBuffer.emplace(std::piecewise_construct,
+                            std::forward_as_tuple(currentSegment),
+                            std::forward_as_tuple(content.begin(), content.end()));
+  }
+  else {
+    uint64_t nSegments = static_cast<uint64_t>(m_nSegments);
+    if (data.getFinalBlock() && data.getFinalBlock()->isSegment()) {
+      nSegments = data.getFinalBlock()->toSegment() + 1;
+    }
+    storeSegment(currentSegment, content, nSegments);
+  }
+  m_nBytesReceived += content.size();
   afterSegmentValidated(data);
 
   if (data.getFinalBlock()) {
@@ -294,10 +313,15 @@ SegmentFetcher::afterValidationSuccess(const Data& data, const Interest& origInt
 
   if (m_options.inOrder && m_nextSegmentInOrder == currentSegment) {
     do {
-      onInOrderData(std::make_shared<const Buffer>(m_segmentBuffer[m_nextSegmentInOrder]));
+      const Buffer& segment = m_segmentBuffer[m_nextSegmentInOrder];
+      onInOrderBytes(segment);
+      onInOrderData(std::make_shared<const Buffer>(segment));
       m_segmentBuffer.erase(m_nextSegmentInOrder++);
     } while (m_segmentBuffer.count(m_nextSegmentInOrder) > 0);
   }
+  else if (!m_options.inOrder) {
+    deliverInOrderBytes();
+  }
 
   if (m_receivedSegments.size() == 1) {
     m_versionedDataName = data.getName().getPrefix(-1);
@@ -413,19 +437,109 @@ SegmentFetcher::finalizeFetch()
     onInOrderComplete();
   }
   else {
-    // Combine segments into final buffer
-    OBufferStream buf;
     // We may have received more segments than exist in the object.
     BOOST_ASSERT(m_receivedSegments.size() >= static_cast<uint64_t>(m_nSegments));
-
-    for (int64_t i = 0; i < m_nSegments; i++) {
-      buf.write(m_segmentBuffer[i].get<const char>(), m_segmentBuffer[i].size());
+    uint64_t nSegments = static_cast<uint64_t>(m_nSegments);
+
+    if (m_segmentBuffer.empty() && m_segmentStride > 0 &&
+        (!m_shortSegment || m_shortSegment->first == nSegments - 1) &&
+        m_reassemblyBuffer.size() >= (nSegments - 1) * m_segmentStride) {
+      // All segments were reassembled in place, hand over the buffer without copying
+      size_t lastSize = m_shortSegment ? m_shortSegment->second : m_segmentStride;
+      m_reassemblyBuffer.resize((nSegments - 1) * m_segmentStride + lastSize);
+      onComplete(make_shared<Buffer>(std::move(m_reassemblyBuffer)));
+    }
+    else {
+      // Combine segments into final buffer
+      OBufferStream buf;
+      for (uint64_t i = 0; i < nSegments; i++) {
+        auto segment = getSegment(i);
+        buf.write(reinterpret_cast<const char*>(segment.data()), segment.size());
+      }
+      onComplete(buf.buf());
     }
-    onComplete(buf.buf());
   }
   stop();
 }
 
+void
+SegmentFetcher::storeSegment(uint64_t segmentNum, span<const uint8_t> content, uint64_t nSegments)
+{
+  bool isLast = nSegments > 0 && segmentNum == nSegments - 1;
+  if (m_segmentStride == 0 && !isLast && !content.empty()) {
+    m_segmentStride = content.size();
+  }
+
+  // A segment is placed at (segmentNum * stride) only if all segments before it can have
+  // the stride size, i.e., it is either of that size or the final segment of the object.
+  bool fitsStride = m_segmentStride > 0 && nSegments > 0 && segmentNum < nSegments &&
+                    (content.size() == m_segmentStride ||
+                     (isLast && content.size() < m_segmentStride && !m_shortSegment));
+  if (!fitsStride || segmentNum > std::numeric_limits<size_t>::max() / m_segmentStride - 1) {
+    m_segmentBuffer.emplace(std::piecewise_construct,
+                            std::forward_as_tuple(segmentNum),
+                            std::forward_as_tuple(content.begin(), content.end()));
+    return;
+  }
+
+  size_t offset = segmentNum * m_segmentStride;
+  size_t required = offset + m_segmentStride;
+  if (m_reassemblyBuffer.size() < required) {
+    size_t newSize = std::max(required, m_reassemblyBuffer.size() * 2);
+    if (nSegments <= MAX_PREALLOCATION / m_segmentStride) {
+      // the object size is known, allocate the whole object at once
+      newSize = std::max(required, static_cast<size_t>(nSegments) * m_segmentStride);
+    }
+    m_reassemblyBuffer.resize(newSize);
+  }
+  std::copy(content.begin(), content.end(), m_reassemblyBuffer.begin() + offset);
+
+  if (content.size() < m_segmentStride) {
+    m_shortSegment.emplace(segmentNum, content.size());
+  }
+}
+
+span<const uint8_t>
+SegmentFetcher::getSegment(uint64_t segmentNum) const
+{
+  auto it = m_segmentBuffer.find(segmentNum);
+  if (it != m_segmentBuffer.end()) {
+    return it->second;
+  }
+
+  BOOST_ASSERT(m_receivedSegments.count(segmentNum) > 0);
+  size_t size = m_shortSegment && m_shortSegment->first == segmentNum ? m_shortSegment->second
+                                                                      : m_segmentStride;
+  return {m_reassemblyBuffer.data() + segmentNum * m_segmentStride, size};
+}
+
+void
+SegmentFetcher::deliverInOrderBytes()
+{
+  if (onInOrderBytes.isEmpty()) {
+    return;
+  }
+
+  span<const uint8_t> pending;
+  while (m_receivedSegments.count(m_nextSegmentInOrder) > 0 &&
+         (m_nSegments == 0 || m_nextSegmentInOrder < static_cast<uint64_t>(m_nSegments))) {
+    auto segment = getSegment(m_nextSegmentInOrder++);
+    if (pending.data() + pending.size() == segment.data()) {
+      // adjacent in the reassembly buffer, deliver together
+      pending = {pending.data(), pending.size() + segment.size()};
+    }
+    else {
+      if (!pending.empty()) {
+        onInOrderBytes(pending);
+      }
+      pending = segment;
+    }
+  }
+  if (!pending.empty()) {
+    onInOrderBytes(pending);
+  }
+}
+
 void
 SegmentFetcher::windowIncrease()
 {
@@ -434,6 +548,10 @@ SegmentFetcher::windowIncrease()
     return;
   }
 
+  if (m_options.congestionControl == CongestionControl::CUBIC) {
+    return cubicWindowIncrease();
+  }
+
   if (m_cwnd < m_ssthresh) {
     m_cwnd += m_options.aiStep; // additive increase
   }
@@ -453,12 +571,61 @@ SegmentFetcher::windowDecrease()
       return;
     }
 
+    if (m_options.congestionControl == CongestionControl::CUBIC) {
+      return cubicWindowDecrease();
+    }
+
     // Refer to RFC 5681, Section 3.1 for the rationale behind the code below
     m_ssthresh = std::max(MIN_SSTHRESH, m_cwnd * m_options.mdCoef); // multiplicative decrease
     m_cwnd = m_options.resetCwndToInit ? m_options.initCwnd : m_ssthresh;
   }
 }
 
+void
+SegmentFetcher::cubicWindowIncrease()
+{
+  if (m_cwnd < m_ssthresh) {
+    m_cwnd += 1.0; // slow start
+    return;
+  }
+
+  // Refer to RFC 8312, Section 4 for the rationale behind the code below
+  BOOST_ASSERT(m_wmax >= 0.0);
+  double t = time::duration_cast<time::microseconds>(time::steady_clock::now() - m_lastDecrease).count() / 1e6;
+  double k = std::cbrt(m_wmax * (1.0 - m_options.cubicBeta) / m_options.cubicC);
+  double wCubic = m_options.cubicC * std::pow(t - k, 3) + m_wmax;
+
+  // TCP-friendly window estimate (Section 4.2)
+  double rtt = time::duration_cast<time::microseconds>(m_rttEstimator.getSmoothedRtt()).count() / 1e6;
+  double beta = m_options.cubicBeta;
+  double wEst = m_wmax * beta;
+  if (rtt > 0.0) {
+    wEst += 3.0 * (1.0 - beta) / (1.0 + beta) * (t / rtt);
+  }
+
+  double target = std::max(wCubic, wEst);
+  // the window grows by (target - cwnd) / cwnd per acknowledged segment
+  m_cwnd += std::max(0.0, target - m_cwnd) / m_cwnd;
+}
+
+void
+SegmentFetcher::cubicWindowDecrease()
+{
+  // Fast convergence (RFC 8312, Section 4.6)
+  if (m_options.enableFastConv && m_cwnd < m_lastWmax) {
+    m_lastWmax = m_cwnd;
+    m_wmax = m_cwnd * (1.0 + m_options.cubicBeta) / 2.0;
+  }
+  else {
+    m_wmax = m_cwnd;
+    m_lastWmax = m_cwnd;
+  }
+
+  m_ssthresh = std::max(m_options.initCwnd, m_cwnd * m_options.cubicBeta);
+  m_cwnd = m_options.resetCwndToInit ? m_options.initCwnd : m_ssthresh;
+  m_lastDecrease = time::steady_clock::now();
+}
+
 void
 SegmentFetcher::signalError(uint32_t code, const std::string& msg)
 {
@@ -63,6 +63,11 @@ namespace util {
  *    of all segments in the object. If set to 'in order' mode, signal #onInOrderData is triggered
  *    upon validation of each segment in segment order, storing later segments that arrived out of
  *    order internally until all earlier segments have arrived and have been validated.
+ *    In both modes, #onInOrderBytes streams the content as soon as it becomes contiguous.
+ *
+ * In 'block' mode, once the number of segments is known from the FinalBlockId, segments of equal
+ * size are reassembled in place into a buffer preallocated for the whole object, which is then
+ * passed to #onComplete without further copying.
  *
  * If an error occurs during the fetching process, #onError is signaled with one of the error codes
  * from SegmentFetcher::ErrorCode.
@@ -96,6 +101,14 @@ public:
     FINALBLOCKID_NOT_SEGMENT = 5,
   };
 
+  /**
+   * @brief Algorithms for adjusting the Interest window.
+   */
+  enum class CongestionControl {
+    AIMD,  ///< additive increase, multiplicative decrease (TCP Reno-like)
+    CUBIC, ///< window growth as a cubic function of the time since the last decrease (RFC 8312)
+  };
+
   class Options
   {
   public:
@@ -119,6 +132,10 @@ public:
     double initSsthresh = std::numeric_limits<double>::max(); ///< initial slow start threshold
     double aiStep = 1.0; ///< additive increase step (in segments)
     double mdCoef = 0.5; ///< multiplicative decrease coefficient
+    CongestionControl congestionControl = CongestionControl::AIMD; ///< window adjustment algorithm
+    double cubicBeta = 0.7; ///< CUBIC window decrease factor
+    double cubicC = 0.4; ///< CUBIC scaling constant of the window growth
+    bool enableFastConv = false; ///< CUBIC fast convergence, releasing bandwidth to new flows
     RttEstimator::Options rttOptions; ///< options for RTT estimator
     size_t flowControlWindow = 25000; ///< maximum number of segments stored in the reorder buffer
   };
@@ -204,12 +221,38 @@ private:
   void
   finalizeFetch();
 
+  /**
+   * @brief Stores the content of a validated segment in 'block' mode, in place in the reassembly
+   *        buffer if possible, otherwise in #m_segmentBuffer
+   * @param nSegments number of segments in the object, 0 if unknown
+   */
+  void
+  storeSegment(uint64_t segmentNum, span<const uint8_t> content, uint64_t nSegments);
+
+  /**
+   * @brief Returns the content of a received segment stored in 'block' mode
+   */
+  span<const uint8_t>
+  getSegment(uint64_t segmentNum) const;
+
+  /**
+   * @brief Signals #onInOrderBytes with the segments that became contiguous in 'block' mode
+   */
+  void
+  deliverInOrderBytes();
+
   void
   windowIncrease();
 
   void
   windowDecrease();
 
+  void
+  cubicWindowIncrease();
+
+  void
+  cubicWindowDecrease();
+
   void
   signalError(uint32_t code, const std::string& msg);
 
@@ -267,6 +310,15 @@ public:
    */
   Signal<SegmentFetcher, ConstBufferPtr> onInOrderData;
 
+  /**
+   * @brief Emitted whenever the in-order prefix of the object grows, with the content that
+   *        has just become contiguous.
+   *
+   * Unlike #onInOrderData, it is emitted in both modes and does not copy the content: the bytes
+   * are valid only until the handler returns.
+   */
+  Signal<SegmentFetcher, span<const uint8_t>> onInOrderBytes;
+
   /**
    * @brief Emitted on successful retrieval of all segments in 'in order' mode.
    * @note Emitted only if SegmentFetcher is operating in 'in order' mode.
@@ -291,6 +343,8 @@ private:
 
 NDN_CXX_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   static constexpr double MIN_SSTHRESH = 2.0;
+  /// largest reassembly buffer allocated at once when the number of segments becomes known
+  static constexpr size_t MAX_PREALLOCATION = 256 * 1024 * 1024;
 
   shared_ptr<SegmentFetcher> m_this;
 
@@ -315,6 +369,18 @@ NDN_CXX_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   int64_t m_nBytesReceived = 0;
   uint64_t m_nextSegmentInOrder = 0;
 
+  // CUBIC state
+  double m_wmax = 0.0; ///< window size before the last decrease
+  double m_lastWmax = 0.0; ///< window size before the previous decrease
+  time::steady_clock::TimePoint m_lastDecrease;
+
+  /// content of segments of size m_segmentStride at offset (segment number * m_segmentStride),
+  /// and of the final segment if shorter
+  Buffer m_reassemblyBuffer;
+  size_t m_segmentStride = 0;
+  /// segment number and size of a final segment shorter than m_segmentStride
+  optional<std::pair<uint64_t, size_t>> m_shortSegment;
+  /// segments of 'in order' mode, and those that do not fit in m_reassemblyBuffer
   std::map<uint64_t, Buffer> m_segmentBuffer;
   std::map<uint64_t, PendingSegment> m_pendingSegments;
   std::set<uint64_t> m_receivedSegments;
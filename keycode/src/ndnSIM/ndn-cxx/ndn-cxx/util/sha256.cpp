@@ -21,7 +21,7 @@
 
 #include "ndn-cxx/util/sha256.hpp"
 #include "ndn-cxx/util/string-helper.hpp"
-#include "ndn-cxx/security/impl/openssl.hpp"
+#include "ndn-cxx/security/impl/openssl-helper.hpp"
 #include "ndn-cxx/security/transform/digest-filter.hpp"
 #include "ndn-cxx/security/transform/stream-sink.hpp"
 #include "ndn-cxx/security/transform/stream-source.hpp"
@@ -134,9 +134,29 @@ Sha256::toString()
 ConstBufferPtr
 Sha256::computeDigest(span<const uint8_t> buffer)
 {
-  Sha256 sha256;
-  sha256.update(buffer);
-  return sha256.computeDigest();
+  auto digest = make_shared<Buffer>(DIGEST_SIZE);
+  computeDigest({buffer}, *digest);
+  return digest;
+}
+
+void
+Sha256::computeDigest(const InputBuffers& bufs, span<uint8_t> digest)
+{
+  if (digest.size() < DIGEST_SIZE) {
+    NDN_THROW(Error("Output buffer of " + to_string(digest.size()) + " octets is too small "
+                    "for a SHA-256 digest"));
+  }
+
+  // allocating and freeing an EVP_MD_CTX costs about as much as hashing a small packet
+  thread_local security::detail::EvpMdCtx ctx;
+
+  bool isOk = EVP_DigestInit_ex(ctx, EVP_sha256(), nullptr) == 1;
+  for (const auto& buf : bufs) {
+    isOk = isOk && EVP_DigestUpdate(ctx, buf.data(), buf.size()) == 1;
+  }
+  if (!isOk || EVP_DigestFinal_ex(ctx, digest.data(), nullptr) != 1) {
+    NDN_THROW(Error("Failed to compute SHA-256 digest"));
+  }
 }
 
 std::ostream&
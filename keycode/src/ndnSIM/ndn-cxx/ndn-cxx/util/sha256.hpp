@@ -24,6 +24,7 @@
 
 #include "ndn-cxx/encoding/block.hpp"
 #include "ndn-cxx/encoding/buffer-stream.hpp"
+#include "ndn-cxx/security/security-common.hpp"
 #include "ndn-cxx/security/transform/step-source.hpp"
 
 namespace ndn {
@@ -160,6 +161,18 @@ public:
   static ConstBufferPtr
   computeDigest(span<const uint8_t> buffer);
 
+  /**
+   * @brief Stateless SHA-256 digest calculation over discontiguous ranges.
+   * @param bufs the input ranges
+   * @param[out] digest receives the digest, must have room for at least DIGEST_SIZE octets
+   * @throw Error @p digest is too small, or the digest cannot be computed
+   *
+   * The digest is written in place, without a transform chain or intermediate buffers,
+   * using an OpenSSL context that is reused by all calls on the same thread.
+   */
+  static void
+  computeDigest(const InputBuffers& bufs, span<uint8_t> digest);
+
 private:
   unique_ptr<security::transform::StepSource> m_input;
   unique_ptr<OBufferStream> m_output;
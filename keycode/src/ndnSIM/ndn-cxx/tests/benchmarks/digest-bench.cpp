@@ -0,0 +1,103 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#define BOOST_TEST_MODULE ndn-cxx Digest Benchmark
+#include "tests/boost-test.hpp"
+
+#include "ndn-cxx/data.hpp"
+#include "ndn-cxx/util/sha256.hpp"
+#include "tests/benchmarks/timed-execute.hpp"
+
+#include <boost/mpl/vector_c.hpp>
+
+#include <iostream>
+
+namespace ndn {
+namespace tests {
+
+const int N_ITERATIONS = 100000;
+
+using ContentSizes = boost::mpl::vector_c<size_t, 1024, 8192>;
+
+static Block
+makeDataWire(size_t contentSize)
+{
+  Data data(Name("/benchmark/producer/data/seq=1"));
+  data.setContent(std::vector<uint8_t>(contentSize, 0xAB));
+  data.setSignatureInfo(SignatureInfo(tlv::SignatureSha256WithEcdsa,
+                                      KeyLocator(Name("/benchmark/producer/KEY/%01%02"))));
+  data.setSignatureValue(std::make_shared<Buffer>(64));
+  return data.wireEncode();
+}
+
+static void
+printRate(const std::string& label, time::nanoseconds d)
+{
+  std::cout << label << " " << static_cast<uint64_t>(N_ITERATIONS * 1e9 / d.count())
+            << " digests/s" << std::endl;
+}
+
+// Benchmark of the implicit digest of a Data packet, computed through a transform chain,
+// in one shot, and by Data::getFullName(). For accurate results, compile in release mode.
+BOOST_AUTO_TEST_CASE_TEMPLATE(ImplicitDigest, ContentSize, ContentSizes)
+{
+  const Block wire = makeDataWire(ContentSize::value);
+  const std::string label = "content=" + to_string(ContentSize::value);
+  size_t checksum[3] = {0, 0, 0};
+
+  auto d = timedExecute([&] {
+    for (int i = 0; i < N_ITERATIONS; ++i) {
+      util::Sha256 sha256;
+      sha256.update(wire);
+      checksum[0] += sha256.computeDigest()->front();
+    }
+  });
+  printRate(label + " stream", d);
+
+  d = timedExecute([&] {
+    for (int i = 0; i < N_ITERATIONS; ++i) {
+      checksum[1] += util::Sha256::computeDigest(wire)->front();
+    }
+  });
+  printRate(label + " one-shot", d);
+
+  std::vector<Data> packets(N_ITERATIONS, Data(wire));
+  d = timedExecute([&] {
+    for (const auto& data : packets) {
+      checksum[2] += data.getFullName()[-1].value()[0];
+    }
+  });
+  printRate(label + " getFullName", d);
+
+  // a repeated call returns the cached full name
+  d = timedExecute([&] {
+    for (const auto& data : packets) {
+      checksum[2] -= data.getFullName()[-1].value()[0];
+    }
+  });
+  printRate(label + " getFullName cached", d);
+
+  BOOST_CHECK_EQUAL(checksum[0], checksum[1]);
+  BOOST_CHECK_EQUAL(checksum[2], 0);
+}
+
+} // namespace tests
+} // namespace ndn
@@ -0,0 +1,161 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#define BOOST_TEST_MODULE ndn-cxx InMemoryStorage Benchmark
+#include "tests/boost-test.hpp"
+
+#include "ndn-cxx/ims/in-memory-storage-lru.hpp"
+#include "ndn-cxx/ims/in-memory-storage-sharded.hpp"
+#include "tests/benchmarks/timed-execute.hpp"
+#include "tests/test-common.hpp"
+
+#include <boost/mpl/vector_c.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <mutex>
+#include <numeric>
+#include <random>
+#include <thread>
+
+namespace ndn {
+namespace tests {
+
+const size_t N_ITERATIONS = 200000; // per thread
+const size_t CATALOG_SIZE = 100000;
+const size_t CACHE_LIMIT = 10000;
+const double ZIPF_ALPHA = 0.8;
+
+/** @brief Catalog of Data packets requested with Zipf-distributed popularity
+ */
+class ZipfCatalog
+{
+public:
+  ZipfCatalog()
+  {
+    double sum = 0;
+    for (size_t rank = 1; rank <= CATALOG_SIZE; ++rank) {
+      sum += 1.0 / std::pow(rank, ZIPF_ALPHA);
+      m_cdf.push_back(sum);
+      auto data = makeData(Name("/benchmark/catalog").appendSegment(rank % 64).appendSegment(rank));
+      m_packets.push_back(data);
+      m_interests.emplace_back(data->getName());
+    }
+    for (auto& p : m_cdf) {
+      p /= sum;
+    }
+  }
+
+  size_t
+  draw(std::mt19937& rng) const
+  {
+    double u = std::uniform_real_distribution<double>()(rng);
+    return std::min<size_t>(std::lower_bound(m_cdf.begin(), m_cdf.end(), u) - m_cdf.begin(),
+                            CATALOG_SIZE - 1);
+  }
+
+public:
+  std::vector<shared_ptr<Data>> m_packets;
+  std::vector<Interest> m_interests;
+
+private:
+  std::vector<double> m_cdf;
+};
+
+static const ZipfCatalog&
+getCatalog()
+{
+  static const ZipfCatalog catalog;
+  return catalog;
+}
+
+/** @brief Runs @p nThreads readers that look up Zipf-distributed Interests and insert the
+ *         Data on a miss, as a caching producer or gateway would
+ */
+template<typename Lookup, typename Insert>
+static void
+runReaders(const std::string& label, size_t nThreads, const Lookup& lookup, const Insert& insert)
+{
+  const auto& catalog = getCatalog();
+  std::vector<size_t> nHits(nThreads);
+  auto d = timedExecute([&] {
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < nThreads; ++t) {
+      threads.emplace_back([&, t] {
+        std::mt19937 rng(static_cast<unsigned>(t + 1));
+        for (size_t i = 0; i < N_ITERATIONS; ++i) {
+          size_t rank = catalog.draw(rng);
+          if (lookup(catalog.m_interests[rank]) != nullptr) {
+            ++nHits[t];
+          }
+          else {
+            insert(*catalog.m_packets[rank]);
+          }
+        }
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  });
+
+  size_t nLookups = nThreads * N_ITERATIONS;
+  size_t totalHits = std::accumulate(nHits.begin(), nHits.end(), size_t(0));
+  std::cout << label << " threads=" << nThreads
+            << " " << static_cast<uint64_t>(nLookups * 1e9 / d.count()) << " lookups/s"
+            << " hit-ratio=" << static_cast<double>(totalHits) / nLookups << std::endl;
+}
+
+using ThreadCounts = boost::mpl::vector_c<size_t, 1, 2, 4, 8>;
+
+// Benchmark of concurrent lookups with Zipf-distributed popularity, comparing InMemoryStorageLru
+// behind a single lock with the sharded storage. For accurate results, compile in release mode
+// and run on a machine with at least as many cores as threads.
+BOOST_AUTO_TEST_CASE_TEMPLATE(ZipfLookups, NThreads, ThreadCounts)
+{
+  getCatalog();
+
+  {
+    InMemoryStorageLru ims(CACHE_LIMIT);
+    std::mutex mutex;
+    runReaders("lru+mutex", NThreads::value,
+      [&] (const Interest& interest) {
+        std::lock_guard<std::mutex> lock(mutex);
+        return ims.find(interest);
+      },
+      [&] (const Data& data) {
+        std::lock_guard<std::mutex> lock(mutex);
+        ims.insert(data);
+      });
+  }
+
+  {
+    InMemoryStorageSharded ims(CACHE_LIMIT);
+    runReaders("sharded", NThreads::value,
+      [&] (const Interest& interest) { return ims.find(interest); },
+      [&] (const Data& data) { ims.insert(data); });
+    BOOST_CHECK_LE(ims.size(), CACHE_LIMIT);
+  }
+}
+
+} // namespace tests
+} // namespace ndn
@@ -0,0 +1,126 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#define BOOST_TEST_MODULE ndn-cxx Packet Decode Benchmark
+#include "tests/boost-test.hpp"
+
+#include "ndn-cxx/data.hpp"
+#include "ndn-cxx/interest.hpp"
+#include "tests/benchmarks/timed-execute.hpp"
+
+#include <boost/mpl/vector_c.hpp>
+
+#include <iostream>
+
+namespace ndn {
+namespace tests {
+
+const int N_ITERATIONS = 100000;
+
+/** @brief Decodes @p wire and performs the accesses that a forwarder makes on an Interest,
+ *         then obtains the encoding to be sent out
+ */
+static size_t
+forwardInterest(const Block& wire)
+{
+  Interest interest(wire);
+  size_t result = interest.getName().size();
+  result += interest.getNonce()[0];
+  result += static_cast<size_t>(interest.getInterestLifetime().count());
+  result += interest.getCanBePrefix() + interest.getMustBeFresh();
+  result += interest.hasForwardingHint();
+  result += interest.wireEncode().size();
+  return result;
+}
+
+/** @brief Decodes @p wire and performs the accesses that a forwarder makes on a Data,
+ *         then obtains the encoding to be sent out
+ */
+static size_t
+forwardData(const Block& wire)
+{
+  Data data(wire);
+  size_t result = data.getName().size();
+  result += data.getContent().value_size();
+  result += data.wireEncode().size();
+  return result;
+}
+
+using ParamsSizes = boost::mpl::vector_c<size_t, 0, 1024, 8192>;
+
+template<typename F>
+static void
+runDecodeForward(const std::string& label, const Block& wire, const F& forward)
+{
+  size_t checksum[2] = {0, 0};
+  time::nanoseconds d[2];
+  for (bool lazy : {false, true}) {
+    Interest::setLazyDecoding(lazy);
+    Data::setLazyDecoding(lazy);
+    d[lazy] = timedExecute([&] {
+      for (int i = 0; i < N_ITERATIONS; ++i) {
+        checksum[lazy] += forward(wire);
+      }
+    });
+  }
+  Interest::setLazyDecoding(false);
+  Data::setLazyDecoding(false);
+
+  // use the result, so the compiler won't optimize out the decoding
+  BOOST_CHECK_EQUAL(checksum[0], checksum[1]);
+  std::cout << label
+            << " eager=" << d[0].count() / N_ITERATIONS << "ns/pkt"
+            << " lazy=" << d[1].count() / N_ITERATIONS << "ns/pkt" << std::endl;
+}
+
+// Benchmark of decoding and forwarding an Interest with ApplicationParameters of various sizes.
+// For accurate results, it is required to compile ndn-cxx in release mode.
+BOOST_AUTO_TEST_CASE_TEMPLATE(DecodeForwardInterest, ParamsSize, ParamsSizes)
+{
+  Interest interest(Name("/benchmark/gateway/domain/interest/seq=1"));
+  interest.setCanBePrefix(false);
+  interest.setMustBeFresh(true);
+  interest.setForwardingHint({"/benchmark/hint"});
+  interest.setNonce(0x1234abcd);
+  if (ParamsSize::value > 0) {
+    std::vector<uint8_t> params(ParamsSize::value, 0xAB);
+    interest.setApplicationParameters(params);
+  }
+
+  runDecodeForward("interest params=" + to_string(ParamsSize::value), interest.wireEncode(),
+                   &forwardInterest);
+}
+
+// Benchmark of decoding and forwarding a signed Data with 8 KB of Content.
+BOOST_AUTO_TEST_CASE(DecodeForwardData)
+{
+  Data data(Name("/benchmark/gateway/domain/data/seq=1"));
+  data.setFreshnessPeriod(10_s);
+  data.setContent(std::vector<uint8_t>(8192, 0xCD));
+  data.setSignatureInfo(SignatureInfo(tlv::SignatureSha256WithEcdsa,
+                                      KeyLocator(Name("/benchmark/producer/KEY/%01%02"))));
+  data.setSignatureValue(std::make_shared<Buffer>(64));
+
+  runDecodeForward("data content=8192", data.wireEncode(), &forwardData);
+}
+
+} // namespace tests
+} // namespace ndn
@@ -0,0 +1,123 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#define BOOST_TEST_MODULE ndn-cxx Packet Encode Benchmark
+#include "tests/boost-test.hpp"
+
+#include "ndn-cxx/data.hpp"
+#include "ndn-cxx/interest.hpp"
+#include "ndn-cxx/lp/packet.hpp"
+#include "tests/benchmarks/timed-execute.hpp"
+
+#include <iostream>
+
+namespace ndn {
+namespace tests {
+
+const int N_ITERATIONS = 100000;
+
+// Benchmark of re-encoding a received Interest after one of its fields has been changed,
+// as a gateway does before tunneling it. For accurate results, compile ndn-cxx in release mode.
+BOOST_AUTO_TEST_CASE(ReencodeInterest)
+{
+  Interest original(Name("/benchmark/gateway/domain/interest/with/a/longer/name/seq=1"));
+  original.setNonce(0x1234abcd);
+  original.setApplicationParameters(std::vector<uint8_t>(1024, 0xAB));
+  Interest interest(original.wireEncode());
+
+  size_t totalSize = 0;
+  auto d = timedExecute([&] {
+    for (int i = 0; i < N_ITERATIONS; ++i) {
+      interest.setNonce(static_cast<uint32_t>(i));
+      totalSize += interest.wireEncode().size();
+      // repeated calls on the unchanged Interest return the cached encoding
+      totalSize -= interest.wireEncode().size();
+    }
+  });
+  BOOST_CHECK_EQUAL(totalSize, 0);
+  std::cout << "reencode interest params=1024 " << d.count() / N_ITERATIONS << "ns/pkt" << std::endl;
+}
+
+BOOST_AUTO_TEST_CASE(ReencodeData)
+{
+  Data original(Name("/benchmark/gateway/domain/data/with/a/longer/name/seq=1"));
+  original.setContent(std::vector<uint8_t>(8192, 0xCD));
+  original.setSignatureInfo(SignatureInfo(tlv::SignatureSha256WithEcdsa,
+                                          KeyLocator(Name("/benchmark/producer/KEY/%01%02"))));
+  original.setSignatureValue(std::make_shared<Buffer>(64));
+  Data data(original.wireEncode());
+
+  size_t totalSize = 0;
+  auto d = timedExecute([&] {
+    for (int i = 0; i < N_ITERATIONS; ++i) {
+      data.setFreshnessPeriod(time::milliseconds(1 + i % 2));
+      totalSize += data.wireEncode().size();
+    }
+  });
+  BOOST_CHECK_GT(totalSize, 0);
+  std::cout << "reencode data content=8192 " << d.count() / N_ITERATIONS << "ns/pkt" << std::endl;
+}
+
+// Benchmark of wrapping a Data in an LpPacket with a header field and writing it into a
+// link-layer buffer, either encoded into a contiguous wire first or gathered from its parts.
+BOOST_AUTO_TEST_CASE(EncapsulateData)
+{
+  Data original(Name("/benchmark/producer/data/seq=1"));
+  original.setContent(std::vector<uint8_t>(8192, 0xCD));
+  original.setSignatureInfo(SignatureInfo(tlv::SignatureSha256WithEcdsa,
+                                          KeyLocator(Name("/benchmark/producer/KEY/%01%02"))));
+  original.setSignatureValue(std::make_shared<Buffer>(64));
+  const Block& wire = original.wireEncode();
+  std::vector<uint8_t> linkBuffer(wire.size() + 64);
+
+  size_t totalSize = 0;
+  auto d = timedExecute([&] {
+    for (int i = 0; i < N_ITERATIONS; ++i) {
+      lp::Packet packet(wire);
+      packet.add<lp::SequenceField>(i);
+      Block block = packet.wireEncode();
+      std::copy(block.begin(), block.end(), linkBuffer.begin());
+      totalSize += block.size();
+    }
+  });
+  std::cout << "encapsulate data content=8192 contiguous " << d.count() / N_ITERATIONS
+            << "ns/pkt" << std::endl;
+
+  d = timedExecute([&] {
+    for (int i = 0; i < N_ITERATIONS; ++i) {
+      lp::Packet packet(wire);
+      packet.add<lp::SequenceField>(i);
+      Block block = packet.wireEncodeComposite();
+      auto pos = linkBuffer.begin();
+      block.gather([&pos] (span<const uint8_t> part) {
+        pos = std::copy(part.begin(), part.end(), pos);
+      });
+      totalSize -= block.size();
+    }
+  });
+  std::cout << "encapsulate data content=8192 gathered " << d.count() / N_ITERATIONS
+            << "ns/pkt" << std::endl;
+
+  BOOST_CHECK_EQUAL(totalSize, 0);
+}
+
+} // namespace tests
+} // namespace ndn
@@ -0,0 +1,87 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#define BOOST_TEST_MODULE ndn-cxx Regex Benchmark
+#include "tests/boost-test.hpp"
+
+#include "ndn-cxx/util/regex.hpp"
+#include "ndn-cxx/util/regex/compiled-regex.hpp"
+#include "tests/benchmarks/timed-execute.hpp"
+
+#include <iostream>
+
+namespace ndn {
+namespace tests {
+
+const int N_ITERATIONS = 20000;
+
+// Trust schema rules in the style of validator configuration files, matched against
+// Data and KeyLocator names that both satisfy and violate them.
+const std::vector<std::string> RULES{
+  "^<domain1><>*<KEY><>{1,3}$",
+  "^[^<KEY>]*<KEY><>*<ksk-.*>$",
+  "^<domain1><src2>(<>*)<KEY><>$",
+  "^<domain2><dst[0-9]><>*$",
+  "<tunnel><>*<seq=[0-9]+>$",
+};
+
+const std::vector<Name> NAMES{
+  "/domain1/src2/KEY/%01%02",
+  "/domain1/src2/object/v=1/seg=42",
+  "/domain1/iGate1/KEY/ksk-1/self/v=1",
+  "/domain2/dst3/app/data/seq=17",
+  "/tunnel/domain2/dst1/seq=99",
+  "/other/site/with/a/longer/name/KEY/%FF",
+};
+
+BOOST_AUTO_TEST_CASE(TrustSchemaRules)
+{
+  for (const auto& rule : RULES) {
+    Regex regex(rule);
+    CompiledRegex compiled(rule);
+
+    size_t nMatched[2] = {0, 0};
+    auto dRegex = timedExecute([&] {
+      for (int i = 0; i < N_ITERATIONS; ++i) {
+        for (const auto& name : NAMES) {
+          nMatched[0] += regex.match(name);
+        }
+      }
+    });
+    auto dCompiled = timedExecute([&] {
+      for (int i = 0; i < N_ITERATIONS; ++i) {
+        for (const auto& name : NAMES) {
+          nMatched[1] += compiled.match(name);
+        }
+      }
+    });
+
+    BOOST_CHECK_EQUAL(nMatched[0], nMatched[1]);
+    size_t nMatches = N_ITERATIONS * NAMES.size();
+    std::cout << rule << " states=" << compiled.getNStates()
+              << " regex=" << static_cast<uint64_t>(nMatches * 1e9 / dRegex.count()) << "/s"
+              << " compiled=" << static_cast<uint64_t>(nMatches * 1e9 / dCompiled.count()) << "/s"
+              << std::endl;
+  }
+}
+
+} // namespace tests
+} // namespace ndn
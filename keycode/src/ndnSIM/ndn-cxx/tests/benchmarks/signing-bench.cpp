@@ -0,0 +1,147 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#define BOOST_TEST_MODULE ndn-cxx Signing Benchmark
+#include "tests/boost-test.hpp"
+
+#include "ndn-cxx/security/key-chain.hpp"
+#include "ndn-cxx/security/impl/openssl.hpp"
+#include "ndn-cxx/security/signing-helpers.hpp"
+#include "ndn-cxx/security/verification-helpers.hpp"
+#include "tests/benchmarks/timed-execute.hpp"
+
+#include <iostream>
+
+namespace ndn {
+namespace tests {
+
+using namespace ndn::security;
+
+const size_t N_PACKETS = 1024;
+const size_t BATCH_SIZE = 64;
+
+static std::vector<shared_ptr<Data>>
+makePackets()
+{
+  std::vector<shared_ptr<Data>> packets;
+  for (size_t i = 0; i < N_PACKETS; ++i) {
+    packets.push_back(make_shared<Data>(Name("/benchmark/producer/data").appendSegment(i)));
+    packets.back()->setContent(std::vector<uint8_t>(1024, 0xAB));
+  }
+  return packets;
+}
+
+static void
+printRate(const std::string& label, time::nanoseconds d)
+{
+  std::cout << label << " " << static_cast<uint64_t>(N_PACKETS * 1e9 / d.count()) << " sig/s"
+            << std::endl;
+}
+
+/** @brief Signs the same packets one at a time, in batches, and with Merkle-batched signatures
+ *         using the key selected by @p params
+ */
+static void
+runSigning(const std::string& keyType, KeyChain& keyChain, const SigningInfo& params)
+{
+  auto packets = makePackets();
+
+  auto d = timedExecute([&] {
+    for (const auto& data : packets) {
+      keyChain.sign(*data, params);
+    }
+  });
+  printRate(keyType + " single", d);
+
+  d = timedExecute([&] {
+    for (size_t i = 0; i < N_PACKETS; i += BATCH_SIZE) {
+      keyChain.sign(make_span(packets).subspan(i, BATCH_SIZE), params);
+    }
+  });
+  printRate(keyType + " batch=" + to_string(BATCH_SIZE), d);
+
+  d = timedExecute([&] {
+    for (size_t i = 0; i < N_PACKETS; i += BATCH_SIZE) {
+      keyChain.signMerkleBatch(make_span(packets).subspan(i, BATCH_SIZE), params);
+    }
+  });
+  printRate(keyType + " merkle=" + to_string(BATCH_SIZE), d);
+}
+
+/** @brief Verifies Merkle-batched packets one at a time, and with a shared MerkleRootCache
+ */
+static void
+runVerification(const std::string& keyType, KeyChain& keyChain, const pib::Identity& id)
+{
+  auto packets = makePackets();
+  for (size_t i = 0; i < N_PACKETS; i += BATCH_SIZE) {
+    keyChain.signMerkleBatch(make_span(packets).subspan(i, BATCH_SIZE), signingByIdentity(id));
+  }
+  auto cert = id.getDefaultKey().getDefaultCertificate();
+
+  size_t nValid[2] = {0, 0};
+  auto d = timedExecute([&] {
+    for (const auto& data : packets) {
+      nValid[0] += verifySignature(*data, cert);
+    }
+  });
+  printRate(keyType + " merkle verify", d);
+
+  d = timedExecute([&] {
+    MerkleRootCache cache;
+    for (const auto& data : packets) {
+      nValid[1] += verifySignature(*data, cert, cache);
+    }
+  });
+  printRate(keyType + " merkle verify with root cache", d);
+
+  BOOST_CHECK_EQUAL(nValid[0], N_PACKETS);
+  BOOST_CHECK_EQUAL(nValid[1], N_PACKETS);
+}
+
+// Benchmark of Data signing throughput. For accurate results, compile ndn-cxx in release mode.
+BOOST_AUTO_TEST_CASE(Ecdsa)
+{
+  KeyChain keyChain("pib-memory:", "tpm-memory:");
+  auto id = keyChain.createIdentity("/benchmark/ecdsa", EcKeyParams());
+  runSigning("ecdsa", keyChain, signingByIdentity(id));
+  runVerification("ecdsa", keyChain, id);
+}
+
+BOOST_AUTO_TEST_CASE(Rsa)
+{
+  KeyChain keyChain("pib-memory:", "tpm-memory:");
+  auto id = keyChain.createIdentity("/benchmark/rsa", RsaKeyParams());
+  runSigning("rsa", keyChain, signingByIdentity(id));
+  runVerification("rsa", keyChain, id);
+}
+
+#if OPENSSL_VERSION_NUMBER < 0x30000000L // FIXME #5154
+BOOST_AUTO_TEST_CASE(Hmac)
+{
+  KeyChain keyChain("pib-memory:", "tpm-memory:");
+  SigningInfo params(SigningInfo::SIGNER_TYPE_HMAC, keyChain.createHmacKey());
+  runSigning("hmac", keyChain, params);
+}
+#endif
+
+} // namespace tests
+} // namespace ndn
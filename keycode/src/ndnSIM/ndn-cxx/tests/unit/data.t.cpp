@@ -369,6 +369,83 @@ BOOST_AUTO_TEST_CASE(MissingSignatureValue)
                         [] (const auto& e) { return e.what() == "SignatureValue element is missing"s; });
 }
 
+class EnableLazyDecoding
+{
+public:
+  EnableLazyDecoding()
+    : m_saved(Data::getLazyDecoding())
+  {
+    Data::setLazyDecoding(true);
+  }
+
+  ~EnableLazyDecoding()
+  {
+    Data::setLazyDecoding(m_saved);
+  }
+
+private:
+  bool m_saved;
+};
+
+BOOST_AUTO_TEST_CASE(Lazy)
+{
+  EnableLazyDecoding enabler;
+  d.wireDecode(Block(DATA1));
+  BOOST_CHECK_EQUAL(d.getName(), "/local/ndn/prefix");
+  BOOST_CHECK_EQUAL(readString(d.getContent()), "SUCCESS!");
+  BOOST_CHECK_EQUAL(d.getSignatureValue().value_size(), 128);
+  BOOST_CHECK_EQUAL(d.getFreshnessPeriod(), 10_s);
+  BOOST_CHECK_EQUAL(d.getSignatureType(), tlv::SignatureSha256WithRsa);
+  BOOST_REQUIRE(d.getKeyLocator().has_value());
+  BOOST_CHECK_EQUAL(d.getKeyLocator()->getName(), "/test/key/locator");
+
+  // nothing is left to decode after decodeDeferred()
+  d.wireDecode(Block(DATA1));
+  BOOST_CHECK_NO_THROW(d.decodeDeferred());
+  BOOST_CHECK_EQUAL(d.getFreshnessPeriod(), 10_s);
+  BOOST_CHECK_EQUAL(d.getSignatureType(), tlv::SignatureSha256WithRsa);
+
+  // modifying a MetaInfo field before it has been accessed keeps the other fields
+  d.wireDecode("0634 0703(080144) 1406(18010219010A) "
+               "1603(1B0100) "
+               "1720612A79399E60304A9F701C1ECAC7956BF2F1B046E6C6F0D6C29B3FE3A29BAD76"_block);
+  d.setFreshnessPeriod(11_ms);
+  BOOST_CHECK_EQUAL(d.getContentType(), tlv::ContentType_Key);
+  BOOST_CHECK_EQUAL(d.wireEncode(),
+                    "0634 0703(080144) 1406(18010219010B) "
+                    "1603(1B0100) "
+                    "1720612A79399E60304A9F701C1ECAC7956BF2F1B046E6C6F0D6C29B3FE3A29BAD76"_block);
+  BOOST_CHECK_EQUAL(d.getSignatureType(), tlv::DigestSha256);
+
+  // decoding again clears the previous MetaInfo
+  d.wireDecode("0609 0700 1603(1B0100) 1700"_block);
+  BOOST_CHECK_EQUAL(d.getContentType(), tlv::ContentType_Blob);
+  BOOST_CHECK_EQUAL(d.getFreshnessPeriod(), 0_ms);
+}
+
+BOOST_AUTO_TEST_CASE(LazyBadElements)
+{
+  // SignatureInfo without SignatureType
+  Block b1("0606 0700 1600 1700"_block);
+  // ContentType with zero TLV-LENGTH
+  Block b2("060D 0700 1402(1800) 1603(1B0100) 1700"_block);
+
+  BOOST_CHECK_THROW(d.wireDecode(b1), tlv::Error);
+  BOOST_CHECK_THROW(d.wireDecode(b2), tlv::Error);
+
+  EnableLazyDecoding enabler;
+  BOOST_CHECK_NO_THROW(d.wireDecode(b1));
+  BOOST_CHECK_THROW(d.decodeDeferred(), tlv::Error);
+  BOOST_CHECK_THROW(d.getSignatureInfo(), tlv::Error);
+  // the error is reported on every access
+  BOOST_CHECK_THROW(d.getSignatureType(), tlv::Error);
+
+  BOOST_CHECK_NO_THROW(d.wireDecode(b2));
+  BOOST_CHECK_EQUAL(d.getSignatureType(), tlv::DigestSha256);
+  BOOST_CHECK_THROW(d.getMetaInfo(), tlv::Error);
+  BOOST_CHECK_THROW(d.getFreshnessPeriod(), tlv::Error);
+}
+
 BOOST_AUTO_TEST_CASE(UnrecognizedNonCriticalElementBeforeName)
 {
   BOOST_CHECK_EXCEPTION(d.wireDecode(
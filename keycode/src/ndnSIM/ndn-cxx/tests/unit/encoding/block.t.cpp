@@ -642,6 +642,51 @@ BOOST_AUTO_TEST_CASE(Remove)
   BOOST_CHECK_EQUAL(readString(elements[1]).compare("/test-prefix"), 0);
 }
 
+BOOST_AUTO_TEST_CASE(ComposeGather)
+{
+  auto payload = std::make_shared<Buffer>(300);
+  std::fill(payload->begin(), payload->end(), 0xAB);
+
+  Block inner(tlv::Content, payload);
+  Block block(tlv::Data);
+  block.push_back(makeStringBlock(tlv::Name, "/test-prefix"));
+  block.push_back(inner);
+  block.push_back(Block(tlv::SignatureValue));
+  block.compose();
+  BOOST_CHECK_EQUAL(block.hasWire(), false);
+
+  std::vector<uint8_t> gathered;
+  size_t nParts = 0;
+  block.gather([&] (span<const uint8_t> part) {
+    gathered.insert(gathered.end(), part.begin(), part.end());
+    ++nParts;
+  });
+  BOOST_CHECK_EQUAL(nParts, 5);
+
+  // the payload part was read from its own buffer
+  bool hasPayloadPart = false;
+  block.gather([&] (span<const uint8_t> part) {
+    hasPayloadPart = hasPayloadPart || part.data() == payload->data();
+  });
+  BOOST_CHECK(hasPayloadPart);
+
+  Block encoded = block;
+  encoded.encode();
+  BOOST_CHECK_EQUAL(block.size(), encoded.size());
+  BOOST_CHECK_EQUAL_COLLECTIONS(gathered.begin(), gathered.end(), encoded.begin(), encoded.end());
+
+  // a block with wire is a single part
+  nParts = 0;
+  encoded.gather([&] (span<const uint8_t> part) {
+    BOOST_CHECK_EQUAL(part.data(), encoded.data());
+    BOOST_CHECK_EQUAL(part.size(), encoded.size());
+    ++nParts;
+  });
+  BOOST_CHECK_EQUAL(nParts, 1);
+
+  BOOST_CHECK_THROW(Block().gather([] (span<const uint8_t>) {}), Block::Error);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // SubElements
 
 BOOST_AUTO_TEST_CASE(ToAsioConstBuffer)
@@ -0,0 +1,344 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/ims/in-memory-storage-sharded.hpp"
+
+#include "tests/test-common.hpp"
+#include "tests/unit/clock-fixture.hpp"
+
+#include <thread>
+
+namespace ndn {
+namespace tests {
+
+using namespace ndn::tests;
+
+class ShardedFixture : public ClockFixture
+{
+protected:
+  Name
+  insert(uint32_t id, const Name& name,
+         const time::milliseconds& freshWindow = InMemoryStorageSharded::INFINITE_WINDOW)
+  {
+    auto data = makeData(name);
+    data->setContent(make_span(reinterpret_cast<const uint8_t*>(&id), sizeof(id)));
+    // a positive FreshnessPeriod makes MustBeFresh depend on the processing window only
+    data->setFreshnessPeriod(1_h);
+    signData(data);
+    m_ims.insert(*data, freshWindow);
+    return data->getFullName();
+  }
+
+  Interest&
+  startInterest(const Name& name)
+  {
+    m_interest = makeInterest(name, false);
+    return *m_interest;
+  }
+
+  static uint32_t
+  getId(const shared_ptr<const Data>& found)
+  {
+    if (found == nullptr) {
+      return 0;
+    }
+    const Block& content = found->getContent();
+    if (content.value_size() != sizeof(uint32_t)) {
+      return 0;
+    }
+    uint32_t id = 0;
+    std::memcpy(&id, content.value(), sizeof(id));
+    return id;
+  }
+
+  uint32_t
+  find()
+  {
+    return getId(m_ims.find(*m_interest));
+  }
+
+protected:
+  InMemoryStorageSharded m_ims{std::numeric_limits<size_t>::max(), 4, 2};
+  shared_ptr<Interest> m_interest;
+};
+
+BOOST_AUTO_TEST_SUITE(Ims)
+BOOST_FIXTURE_TEST_SUITE(TestInMemoryStorageSharded, ShardedFixture)
+
+BOOST_AUTO_TEST_CASE(InsertAndFind)
+{
+  BOOST_CHECK_EQUAL(m_ims.getNShards(), 4);
+
+  insert(1, "/A/B/1");
+  insert(2, "/A/B/2");
+  insert(2, "/A/B/2");
+  insert(3, "/C/D");
+  BOOST_CHECK_EQUAL(m_ims.size(), 3);
+
+  startInterest("/A/B/2");
+  BOOST_CHECK_EQUAL(find(), 2);
+  startInterest("/A/B/3");
+  BOOST_CHECK_EQUAL(find(), 0);
+  BOOST_CHECK_EQUAL(getId(m_ims.find(Name("/C"))), 3);
+  BOOST_CHECK_EQUAL(getId(m_ims.find(Name("/A/B"))), 1);
+  BOOST_CHECK_EQUAL(getId(m_ims.find(Name("/E"))), 0);
+
+  BOOST_CHECK_EQUAL(m_ims.getNHits(), 3);
+  BOOST_CHECK_EQUAL(m_ims.getNMisses(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(ExactName)
+{
+  insert(1, "/");
+  insert(2, "/A");
+  insert(3, "/A/B");
+  insert(4, "/A/C");
+  insert(5, "/D");
+
+  startInterest("/A");
+  BOOST_CHECK_EQUAL(find(), 2);
+
+  startInterest("/A")
+    .setCanBePrefix(true);
+  BOOST_CHECK_EQUAL(find(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(FullName)
+{
+  Name n1 = insert(1, "/A");
+  Name n2 = insert(2, "/A");
+  Name n3 = insert(3, "/");
+
+  startInterest(n1);
+  BOOST_CHECK_EQUAL(find(), 1);
+
+  startInterest(n2);
+  BOOST_CHECK_EQUAL(find(), 2);
+
+  startInterest(n3);
+  BOOST_CHECK_EQUAL(find(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(PrefixName)
+{
+  // the names are distributed among the shards, and the leftmost match must be returned
+  insert(1, "/A");
+  insert(5, "/B/q/2");
+  insert(4, "/B/q/1");
+  insert(3, "/B/p/2");
+  insert(2, "/B/p/1");
+  insert(6, "/C");
+
+  startInterest("/B")
+    .setCanBePrefix(true);
+  BOOST_CHECK_EQUAL(find(), 2);
+
+  startInterest("/B/q")
+    .setCanBePrefix(true);
+  BOOST_CHECK_EQUAL(find(), 4);
+
+  startInterest("/B");
+  BOOST_CHECK_EQUAL(find(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(MustBeFresh)
+{
+  insert(1, "/A/1");
+  insert(3, "/A/3", 1_s);
+  insert(4, "/A/4", 1_h);
+
+  advanceClocks(500_ms);
+  startInterest("/A")
+    .setCanBePrefix(true)
+    .setMustBeFresh(true);
+  BOOST_CHECK_EQUAL(find(), 1);
+
+  m_ims.erase("/A/1");
+  startInterest("/A")
+    .setCanBePrefix(true)
+    .setMustBeFresh(true);
+  BOOST_CHECK_EQUAL(find(), 3);
+
+  advanceClocks(1500_ms);
+  startInterest("/A")
+    .setCanBePrefix(true)
+    .setMustBeFresh(true);
+  BOOST_CHECK_EQUAL(find(), 4);
+
+  advanceClocks(1_h);
+  startInterest("/A")
+    .setCanBePrefix(true)
+    .setMustBeFresh(true);
+  BOOST_CHECK_EQUAL(find(), 0);
+
+  startInterest("/A")
+    .setCanBePrefix(true);
+  BOOST_CHECK_EQUAL(find(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(Erase)
+{
+  Name n1 = insert(1, "/A/B/1");
+  insert(2, "/A/B/2");
+  insert(3, "/A/C/1");
+  insert(4, "/D/E");
+
+  m_ims.erase(n1, false);
+  BOOST_CHECK_EQUAL(m_ims.size(), 3);
+  startInterest("/A/B/1");
+  BOOST_CHECK_EQUAL(find(), 0);
+
+  m_ims.erase("/A");
+  BOOST_CHECK_EQUAL(m_ims.size(), 1);
+  startInterest("/D/E");
+  BOOST_CHECK_EQUAL(find(), 4);
+}
+
+BOOST_AUTO_TEST_CASE(LruAndAdmission)
+{
+  InMemoryStorageSharded ims(2, 1);
+  BOOST_CHECK_EQUAL(ims.getLimit(), 2);
+
+  auto insertData = [&ims] (const Name& name) {
+    auto data = makeData(name);
+    return ims.insert(*data);
+  };
+
+  BOOST_CHECK(insertData("/A/1"));
+  BOOST_CHECK(insertData("/A/2"));
+  ims.find(*makeInterest("/A/1")); // /A/2 becomes least recently used
+
+  // a packet requested only once is not more popular than the victim
+  BOOST_CHECK(!insertData("/A/3"));
+  BOOST_CHECK_EQUAL(ims.getNRejected(), 1);
+  BOOST_CHECK_EQUAL(ims.size(), 2);
+
+  // repeated requests make it popular enough to replace the LRU packet
+  for (int i = 0; i < 3; ++i) {
+    BOOST_CHECK(ims.find(*makeInterest("/A/3")) == nullptr);
+  }
+  BOOST_CHECK(insertData("/A/3"));
+  BOOST_CHECK_EQUAL(ims.size(), 2);
+  BOOST_CHECK(ims.find(*makeInterest("/A/1")) != nullptr);
+  BOOST_CHECK(ims.find(*makeInterest("/A/2")) == nullptr);
+  BOOST_CHECK(ims.find(*makeInterest("/A/3")) != nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(LruAcrossShards)
+{
+  // with one packet per shard, a second packet is only admitted into the other shard
+  auto isSameShard = [] (const Name& a, const Name& b) {
+    InMemoryStorageSharded probe(2, 2);
+    probe.insert(*makeData(a));
+    return !probe.insert(*makeData(b));
+  };
+  auto findName = [&isSameShard] (const Name& prefix, int first, const Name& other, bool isSame) {
+    for (int i = first;; ++i) {
+      Name name = Name(prefix).appendNumber(i);
+      if (isSameShard(name, other) == isSame) {
+        return name;
+      }
+    }
+  };
+
+  // the winner is in either shard, so that the losing candidate is found before it once
+  Name reference("/reference");
+  for (bool isWinnerWithReference : {true, false}) {
+    Name prefix(isWinnerWithReference ? "/P" : "/S");
+    Name winner = findName(prefix, 0, reference, isWinnerWithReference);
+    Name loser = findName(prefix, winner.at(-1).toNumber() + 1, winner, false);
+    Name other = findName("/Q", 0, loser, true);
+    Name popular = findName("/R", 0, loser, true);
+    BOOST_TEST_CONTEXT("Winner " << winner << ", loser " << loser) {
+      InMemoryStorageSharded ims(4, 2);
+      BOOST_CHECK(ims.insert(*makeData(winner)));
+      BOOST_CHECK(ims.insert(*makeData(loser)));
+      BOOST_CHECK(ims.insert(*makeData(other))); // the loser is least recently used in its shard
+
+      auto found = ims.find(*makeInterest(prefix, true));
+      BOOST_REQUIRE(found != nullptr);
+      BOOST_CHECK_EQUAL(found->getName(), winner);
+
+      // the losing candidate is still the victim
+      for (int i = 0; i < 3; ++i) {
+        BOOST_CHECK(ims.find(*makeInterest(popular)) == nullptr);
+      }
+      BOOST_CHECK(ims.insert(*makeData(popular)));
+      BOOST_CHECK(ims.find(*makeInterest(loser)) == nullptr);
+      BOOST_CHECK(ims.find(*makeInterest(other)) != nullptr);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(LazilyDecoded)
+{
+  auto original = makeData("/lazy");
+  original->setFreshnessPeriod(5_s);
+  signData(original);
+
+  bool wasLazy = Data::getLazyDecoding();
+  Data::setLazyDecoding(true);
+  auto data = make_shared<Data>(original->wireEncode());
+  // ContentType with zero TLV-LENGTH, only detected when MetaInfo is decoded
+  auto malformed = make_shared<Data>("0610 0703(08014D) 1402(1800) 1603(1B0100) 1700"_block);
+  Data::setLazyDecoding(wasLazy);
+
+  BOOST_CHECK_EQUAL(m_ims.insert(*data), true);
+  // a malformed packet is rejected, instead of throwing later from a reader's getter
+  BOOST_CHECK_EQUAL(m_ims.insert(*malformed), false);
+  BOOST_CHECK_EQUAL(m_ims.size(), 1);
+
+  auto found = m_ims.find(Name("/lazy"));
+  BOOST_REQUIRE(found != nullptr);
+  BOOST_CHECK_EQUAL(found->getFreshnessPeriod(), 5_s);
+}
+
+BOOST_AUTO_TEST_CASE(Concurrent)
+{
+  InMemoryStorageSharded ims(64);
+  std::vector<shared_ptr<Data>> packets;
+  for (int i = 0; i < 128; ++i) {
+    packets.push_back(makeData(Name("/concurrent").appendSegment(i % 16).appendSegment(i)));
+  }
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&, t] {
+      for (int i = 0; i < 1000; ++i) {
+        const auto& data = packets[(i * 7 + t) % packets.size()];
+        ims.insert(*data);
+        ims.find(Interest(data->getName()));
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  BOOST_CHECK_LE(ims.size(), 64);
+  BOOST_CHECK_EQUAL(ims.getNHits() + ims.getNMisses(), 4000);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestInMemoryStorageSharded
+BOOST_AUTO_TEST_SUITE_END() // Ims
+
+} // namespace tests
+} // namespace ndn
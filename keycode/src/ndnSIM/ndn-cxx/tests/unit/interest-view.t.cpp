@@ -0,0 +1,105 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/interest-view.hpp"
+
+#include "tests/boost-test.hpp"
+
+namespace ndn {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(TestInterestView)
+
+BOOST_AUTO_TEST_CASE(NameOnly)
+{
+  ViewArena arena;
+  Block wire = "0505 0703(080149)"_block;
+  InterestView view(wire, arena);
+  BOOST_CHECK(view.getName() == Name("/I"));
+  BOOST_CHECK_EQUAL(view.getCanBePrefix(), false);
+  BOOST_CHECK_EQUAL(view.getMustBeFresh(), false);
+  BOOST_CHECK_EQUAL(view.hasForwardingHint(), false);
+  BOOST_CHECK(view.getNonce() == nullopt);
+  BOOST_CHECK_EQUAL(view.getInterestLifetime(), DEFAULT_INTEREST_LIFETIME);
+  BOOST_CHECK(view.getHopLimit() == nullopt);
+  BOOST_CHECK_EQUAL(view.hasApplicationParameters(), false);
+  BOOST_CHECK_EQUAL(view.toInterest().getName(), "/I");
+}
+
+BOOST_AUTO_TEST_CASE(Full)
+{
+  Interest interest("/local/ndn/prefix");
+  interest.setCanBePrefix(true);
+  interest.setMustBeFresh(true);
+  interest.setForwardingHint({"/F"});
+  interest.setNonce(0x4c1ecb4a);
+  interest.setInterestLifetime(10_s);
+  interest.setHopLimit(214);
+  interest.setApplicationParameters("2404C0C1C2C3"_block);
+  Block wire = interest.wireEncode();
+
+  ViewArena arena;
+  InterestView view(wire, arena);
+  BOOST_CHECK(view.getName() == interest.getName());
+  BOOST_CHECK(view.getName().getPrefix(-1) == Name("/local/ndn/prefix"));
+  BOOST_CHECK_EQUAL(view.getCanBePrefix(), true);
+  BOOST_CHECK_EQUAL(view.getMustBeFresh(), true);
+  BOOST_CHECK_EQUAL(view.hasForwardingHint(), true);
+  BOOST_REQUIRE(view.getNonce() != nullopt);
+  BOOST_CHECK_EQUAL(*view.getNonce(), interest.getNonce());
+  BOOST_CHECK_EQUAL(view.getInterestLifetime(), 10_s);
+  BOOST_CHECK(view.getHopLimit() == uint8_t(214));
+  BOOST_CHECK_EQUAL(view.hasApplicationParameters(), true);
+
+  // the view refers to the received buffer
+  BOOST_CHECK(view.getName().getComponentWire(0).data() >= wire.data() &&
+              view.getName().getComponentWire(0).data() < wire.data() + wire.size());
+  BOOST_CHECK_EQUAL(&view.wireEncode(), &wire);
+
+  Interest copy = view.toInterest();
+  BOOST_CHECK_EQUAL(copy.wireEncode(), wire);
+  BOOST_CHECK_EQUAL(copy.getApplicationParameters(), "2404C0C1C2C3"_block);
+}
+
+BOOST_AUTO_TEST_CASE(Malformed)
+{
+  ViewArena arena;
+  BOOST_CHECK_THROW(InterestView("4202CAFE"_block, arena), tlv::Error);
+  // missing Name
+  BOOST_CHECK_THROW(InterestView("0500"_block, arena), tlv::Error);
+  BOOST_CHECK_THROW(InterestView("0506 0A04A0A1A2A3"_block, arena), tlv::Error);
+  // empty Name
+  BOOST_CHECK_THROW(InterestView("0502 0700"_block, arena), tlv::Error);
+  // out of order
+  BOOST_CHECK_THROW(InterestView("0509 0703(080149) 1200 2100"_block, arena), tlv::Error);
+  // malformed Nonce and HopLimit
+  BOOST_CHECK_THROW(InterestView("0508 0703(080149) 0A01A0"_block, arena), tlv::Error);
+  BOOST_CHECK_THROW(InterestView("0509 0703(080149) 22020101"_block, arena), tlv::Error);
+  // unrecognized critical element
+  BOOST_CHECK_THROW(InterestView("0507 0703(080149) FB00"_block, arena), tlv::Error);
+  // unrecognized non-critical element is ignored
+  BOOST_CHECK_NO_THROW(InterestView("0507 0703(080149) FC00"_block, arena));
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestInterestView
+
+} // namespace tests
+} // namespace ndn
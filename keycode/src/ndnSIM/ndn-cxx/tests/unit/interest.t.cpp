@@ -335,6 +335,24 @@ BOOST_AUTO_TEST_CASE(SignedApplicationElements)
   BOOST_TEST(i1.wireEncode() == WIRE, boost::test_tools::per_element());
 }
 
+BOOST_AUTO_TEST_CASE(ReencodeAfterModification)
+{
+  Interest i1;
+  i1.setName("/local/ndn/prefix");
+  i1.setNonce(0x4c1ecb4a);
+  i1.setApplicationParameters("2404C0C1C2C3"_block);
+  Block wire1 = i1.wireEncode();
+
+  // re-encoding reuses the encodings of Name and parameters and yields the same packet
+  Interest i2(wire1);
+  i2.setInterestLifetime(30_s);
+  i2.setInterestLifetime(DEFAULT_INTEREST_LIFETIME);
+  BOOST_CHECK_EQUAL(i2.hasWire(), false);
+  BOOST_CHECK_EQUAL(i2.wireEncode(), wire1);
+  BOOST_CHECK_EQUAL(i2.isParametersDigestValid(), true);
+  BOOST_CHECK_EQUAL(&i2.wireEncode(), &i2.wireEncode());
+}
+
 BOOST_AUTO_TEST_CASE(MissingApplicationParameters)
 {
   Interest i;
@@ -623,6 +641,94 @@ BOOST_AUTO_TEST_CASE(BadParametersDigest)
   BOOST_CHECK_EQUAL(i.isParametersDigestValid(), false);
 }
 
+class EnableLazyDecoding
+{
+public:
+  EnableLazyDecoding()
+    : m_saved(Interest::getLazyDecoding())
+  {
+    Interest::setLazyDecoding(true);
+  }
+
+  ~EnableLazyDecoding()
+  {
+    Interest::setLazyDecoding(m_saved);
+  }
+
+private:
+  bool m_saved;
+};
+
+BOOST_AUTO_TEST_CASE(Lazy)
+{
+  EnableLazyDecoding enabler;
+  i.wireDecode("055B 0725(080149 0220F16DB273F40436A852063F864D5072B01EAD53151F5A688EA1560492BEBEDD05) "
+               "FC00 2100 FC00 1200 FC00 1E0B(1F09 1E023E15 0703080148) "
+               "FC00 0A044ACB1E4C FC00 0C0276A1 FC00 2201D6 FC00 2404C0C1C2C3 FC00"_block);
+  BOOST_CHECK_EQUAL(i.getName(),
+                    "/I/params-sha256=f16db273f40436a852063f864d5072b01ead53151f5a688ea1560492bebedd05");
+  BOOST_CHECK_EQUAL(i.getCanBePrefix(), true);
+  BOOST_CHECK_EQUAL(i.getMustBeFresh(), true);
+  BOOST_CHECK_EQUAL(i.hasForwardingHint(), true);
+  BOOST_CHECK_EQUAL(i.getNonce(), 0x4acb1e4c);
+  BOOST_CHECK_EQUAL(i.getInterestLifetime(), 30369_ms);
+  BOOST_CHECK_EQUAL(*i.getHopLimit(), 214);
+  BOOST_CHECK_EQUAL(i.hasApplicationParameters(), true);
+
+  BOOST_CHECK_NO_THROW(i.decodeDeferred());
+  BOOST_TEST(i.getForwardingHint() == std::vector<Name>({"/H"}), boost::test_tools::per_element());
+
+  // re-encoding a modified Interest decodes the deferred ForwardingHint
+  i.setHopLimit(213);
+  BOOST_CHECK_EQUAL(i.wireEncode(),
+                    "0547 0725(080149 0220F16DB273F40436A852063F864D5072B01EAD53151F5A688EA1560492BEBEDD05) "
+                    "2100 1200 1E05(0703080148) "
+                    "0A044ACB1E4C 0C0276A1 2201D5 2404C0C1C2C3 FC00"_block);
+  BOOST_TEST(i.getForwardingHint() == std::vector<Name>({"/H"}), boost::test_tools::per_element());
+  BOOST_CHECK_EQUAL(i.getApplicationParameters(), "2404C0C1C2C3"_block);
+
+  // decoding again clears the previous ForwardingHint
+  i.wireDecode("0505 0703(080149)"_block);
+  BOOST_CHECK_EQUAL(i.hasForwardingHint(), false);
+  BOOST_CHECK_EQUAL(i.getForwardingHint().empty(), true);
+}
+
+BOOST_AUTO_TEST_CASE(LazyBadElements)
+{
+  // digest mismatch
+  Block b1("052B 0725(080149 02200000000000000000000000000000000000000000000000000000000000000000) "
+           "2402CAFE"_block);
+  // critical element in ForwardingHint
+  Block b2("0509 0703(080149) 1E02(FB00)"_block);
+
+  BOOST_CHECK_THROW(i.wireDecode(b1), tlv::Error);
+  BOOST_CHECK_THROW(i.wireDecode(b2), tlv::Error);
+
+  EnableLazyDecoding enabler;
+  BOOST_CHECK_NO_THROW(i.wireDecode(b1));
+  BOOST_CHECK_EQUAL(i.hasApplicationParameters(), true);
+  BOOST_CHECK_EXCEPTION(i.getApplicationParameters(), Interest::Error, [] (const auto& e) {
+    return e.what() == "ParametersSha256DigestComponent does not match the SHA-256 of Interest parameters"s;
+  });
+  BOOST_CHECK_THROW(i.extractSignedRanges(), Interest::Error);
+  BOOST_CHECK_THROW(i.decodeDeferred(), Interest::Error);
+  // the error is reported on every access
+  BOOST_CHECK_THROW(i.getApplicationParameters(), Interest::Error);
+
+  BOOST_CHECK_NO_THROW(i.wireDecode(b2));
+  BOOST_CHECK_EQUAL(i.hasForwardingHint(), true);
+  BOOST_CHECK_EXCEPTION(i.getForwardingHint(), Interest::Error, [] (const auto& e) {
+    return e.what() == "Unexpected TLV-TYPE 251 while decoding ForwardingHint"s;
+  });
+  BOOST_CHECK_THROW(i.getForwardingHint(), Interest::Error);
+  BOOST_CHECK_THROW(i.decodeDeferred(), Interest::Error);
+  BOOST_CHECK_EQUAL(i.getApplicationParameters().isValid(), false);
+
+  DisableAutoCheckParametersDigest disabler;
+  BOOST_CHECK_NO_THROW(i.wireDecode(b1));
+  BOOST_CHECK_EQUAL(i.getApplicationParameters(), "2402CAFE"_block);
+}
+
 BOOST_AUTO_TEST_CASE(UnrecognizedNonCriticalElementBeforeName)
 {
   BOOST_CHECK_EXCEPTION(i.wireDecode("0507 FC00 0703080149"_block), tlv::Error,
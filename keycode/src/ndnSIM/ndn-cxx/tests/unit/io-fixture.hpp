@@ -24,13 +24,31 @@
 
 #include "tests/unit/clock-fixture.hpp"
 
+#include "ns3/simulator.h"
+
 #include <boost/asio/io_service.hpp>
 
 namespace ndn {
 namespace tests {
 
+/** \brief Fixture that runs the events of the IO service and of the simulator
+ *
+ *  Face and Scheduler schedule their events in ns-3, so every tick also runs the simulator up to
+ *  the time of the unit test clocks.
+ */
 class IoFixture : public ClockFixture
 {
+protected:
+  IoFixture()
+    : m_simulatedUntil(time::steady_clock::now())
+  {
+  }
+
+  ~IoFixture() override
+  {
+    ns3::Simulator::Destroy();
+  }
+
 private:
   void
   afterTick() final
@@ -43,10 +61,18 @@ private:
 #endif
     }
     m_io.poll();
+
+    auto now = time::steady_clock::now();
+    ns3::Simulator::Stop(ns3::NanoSeconds(time::duration_cast<time::nanoseconds>(now - m_simulatedUntil).count()));
+    ns3::Simulator::Run();
+    m_simulatedUntil = now;
   }
 
 protected:
   boost::asio::io_service m_io;
+
+private:
+  time::steady_clock::time_point m_simulatedUntil;
 };
 
 } // namespace tests
@@ -408,6 +408,43 @@ BOOST_AUTO_TEST_CASE(DecodeBareNetworkLayerPacket)
                                 encoded.begin(), encoded.end());
 }
 
+BOOST_AUTO_TEST_CASE(EncodeComposite)
+{
+  Data data("/A");
+  data.setContent(std::vector<uint8_t>(500, 0xCD));
+  data.setSignatureInfo(SignatureInfo(ndn::tlv::DigestSha256));
+  data.setSignatureValue(std::make_shared<Buffer>(32));
+  const Block& netPkt = data.wireEncode();
+
+  Packet packet(netPkt);
+  Block bare = packet.wireEncodeComposite();
+  BOOST_CHECK(bare.hasWire());
+  BOOST_CHECK_EQUAL(bare.data(), netPkt.data());
+
+  // the fragment refers to the network packet instead of a copy
+  Buffer::const_iterator first, last;
+  std::tie(first, last) = packet.get<FragmentField>();
+  BOOST_CHECK_EQUAL(&*first, netPkt.data());
+  BOOST_CHECK_EQUAL(std::distance(first, last), netPkt.size());
+
+  packet.add<SequenceField>(1000);
+  Block composite = packet.wireEncodeComposite();
+  BOOST_CHECK_EQUAL(composite.hasWire(), false);
+
+  std::vector<uint8_t> gathered;
+  composite.gather([&] (span<const uint8_t> part) {
+    gathered.insert(gathered.end(), part.begin(), part.end());
+  });
+  Block encoded = packet.wireEncode();
+  BOOST_CHECK_EQUAL(composite.size(), encoded.size());
+  BOOST_CHECK_EQUAL_COLLECTIONS(gathered.begin(), gathered.end(), encoded.begin(), encoded.end());
+
+  Packet decoded(encoded);
+  BOOST_CHECK_EQUAL(decoded.get<SequenceField>(), 1000);
+  std::tie(first, last) = decoded.get<FragmentField>();
+  BOOST_CHECK(Block({&*first, static_cast<size_t>(std::distance(first, last))}) == netPkt);
+}
+
 BOOST_AUTO_TEST_CASE(DecodeSeqNum)
 {
   Packet packet;
@@ -0,0 +1,149 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/name-view.hpp"
+
+#include "tests/boost-test.hpp"
+
+#include <boost/lexical_cast.hpp>
+
+namespace ndn {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(TestNameView)
+
+BOOST_AUTO_TEST_CASE(Parse)
+{
+  ViewArena arena;
+  Name name("/Emid/25042=P3/.../%1C%9F/"
+            "sha256digest=0415e3624a151850ac686c84f155f29808c0dd73819aa4a4c20be73a4d8a874c");
+  Block wire = name.wireEncode();
+
+  NameView view(wire, arena);
+  BOOST_CHECK_EQUAL(view.size(), 5);
+  BOOST_CHECK_EQUAL(view.at(0), name::Component("Emid"));
+  BOOST_CHECK_EQUAL(view.at(-1), name[-1]);
+  BOOST_CHECK_THROW(view.at(5), NameView::Error);
+  BOOST_CHECK(view == name);
+  BOOST_CHECK_EQUAL(view.toName(), name);
+  BOOST_CHECK_EQUAL(boost::lexical_cast<std::string>(view), name.toUri());
+
+  // the view refers to the encoding without copying it
+  auto comp = view.getComponentWire(1);
+  BOOST_CHECK(comp.data() == name[1].data());
+  BOOST_CHECK_EQUAL(comp.size(), name[1].size());
+  BOOST_CHECK(view.getValue().data() == wire.value());
+
+  Name emptyName;
+  NameView empty(emptyName, arena);
+  BOOST_CHECK(empty.empty());
+  BOOST_CHECK(empty == Name());
+  BOOST_CHECK_EQUAL(empty.toName(), Name());
+  BOOST_CHECK_EQUAL(boost::lexical_cast<std::string>(empty), "/");
+  BOOST_CHECK(NameView().empty());
+
+  BOOST_CHECK_THROW(NameView("0803 616263"_block, arena), tlv::Error);
+  // truncated component
+  BOOST_CHECK_THROW(NameView("0704 0803 6162"_block, arena), NameView::Error);
+  // invalid component type
+  BOOST_CHECK_THROW(NameView("0705 0003 616263"_block, arena), NameView::Error);
+  // digest component of wrong length
+  BOOST_CHECK_THROW(NameView("0705 0103 616263"_block, arena), NameView::Error);
+}
+
+BOOST_AUTO_TEST_CASE(SubName)
+{
+  ViewArena arena;
+  Name name("/A/B/C/D");
+  NameView view(name, arena);
+
+  BOOST_CHECK(view.getPrefix(2) == Name("/A/B"));
+  BOOST_CHECK(view.getPrefix(-1) == Name("/A/B/C"));
+  BOOST_CHECK(view.getPrefix(10) == name);
+  BOOST_CHECK(view.getSubName(1, 2) == Name("/B/C"));
+  BOOST_CHECK(view.getSubName(-2) == Name("/C/D"));
+  BOOST_CHECK(view.getSubName(-10, 1) == Name("/A"));
+  BOOST_CHECK(view.getSubName(4).empty());
+  BOOST_CHECK(view.getSubName(10).empty());
+  BOOST_CHECK_EQUAL(view.getSubName(1, 2).toName(), Name("/B/C"));
+  BOOST_CHECK_EQUAL(view.getSubName(1, 2).at(-1), name::Component("C"));
+
+  // sub-views share the component index of the view
+  NameView sub = view.getSubName(1, 2);
+  BOOST_CHECK(sub.getComponentWire(0).data() == view.getComponentWire(1).data());
+  BOOST_CHECK(sub.getPrefix(1) == Name("/B"));
+}
+
+BOOST_AUTO_TEST_CASE(Compare)
+{
+  ViewArena arena;
+  Name nameAbc("/a/b/c"), nameAb("/a/b"), nameAbd("/a/b/d");
+  NameView abc(nameAbc, arena);
+  NameView ab(nameAb, arena);
+  NameView abd(nameAbd, arena);
+
+  BOOST_CHECK(ab.isPrefixOf(abc));
+  BOOST_CHECK(!abc.isPrefixOf(ab));
+  BOOST_CHECK(ab.isPrefixOf(Name("/a/b/c")));
+  BOOST_CHECK(!abd.isPrefixOf(Name("/a/b/c")));
+  BOOST_CHECK(NameView().isPrefixOf(Name("/a")));
+
+  for (const auto& pair : std::vector<std::pair<Name, Name>>{
+         {"/a/b/c", "/a/b/d"}, {"/a/b", "/a/b/c"}, {"/c", "/bb"}, {"/a/8=c", "/a/9=c"}}) {
+    BOOST_TEST_CONTEXT(pair.first << " " << pair.second) {
+      NameView lhs(pair.first, arena);
+      NameView rhs(pair.second, arena);
+      BOOST_CHECK_EQUAL(lhs.compare(pair.second) < 0, pair.first.compare(pair.second) < 0);
+      BOOST_CHECK_EQUAL(rhs.compare(pair.first) > 0, pair.second.compare(pair.first) > 0);
+      BOOST_CHECK_EQUAL(lhs.compare(rhs) < 0, pair.first.compare(pair.second) < 0);
+      BOOST_CHECK_EQUAL(lhs.compare(pair.first), 0);
+      BOOST_CHECK(lhs != rhs);
+      BOOST_CHECK(lhs != pair.second);
+      BOOST_CHECK(pair.first == lhs);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Arena)
+{
+  ViewArena arena;
+  Name longName;
+  for (int i = 0; i < 200; ++i) {
+    longName.appendNumber(i);
+  }
+
+  // the component index of a long name does not fit in the inline storage of the arena
+  Name shortName("/A/B");
+  NameView first(shortName, arena);
+  NameView view(longName, arena);
+  BOOST_CHECK(view == longName);
+  BOOST_CHECK(view.getPrefix(-100) == longName.getPrefix(-100));
+  BOOST_CHECK(first == Name("/A/B"));
+
+  arena.reset();
+  NameView again(longName, arena);
+  BOOST_CHECK(again == longName);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestNameView
+
+} // namespace tests
+} // namespace ndn
@@ -61,6 +61,32 @@ BOOST_AUTO_TEST_CASE(EncodeDecode)
   BOOST_CHECK_EQUAL(decoded, name);
 }
 
+BOOST_AUTO_TEST_CASE(EncodeCachedWire)
+{
+  Name name("/A/B");
+  Block wire = name.wireEncode();
+
+  // an encoded Name is copied from its cached encoding
+  EncodingEstimator estimator;
+  BOOST_CHECK_EQUAL(name.wireEncode(estimator), wire.size());
+  EncodingBuffer encoder(wire.size(), 0);
+  name.wireEncode(encoder);
+  BOOST_CHECK_EQUAL(encoder.block(), wire);
+
+  // modifying the Name discards the cached encoding
+  name.append("C");
+  BOOST_CHECK_EQUAL(name.hasWire(), false);
+  EncodingBuffer encoder2;
+  name.wireEncode(encoder2);
+  BOOST_CHECK_EQUAL(encoder2.block(), "0709 080141 080142 080143"_block);
+  name.wireEncode();
+  name.set(0, Component("D"));
+  BOOST_CHECK_EQUAL(name.hasWire(), false);
+  EncodingBuffer encoder3;
+  name.wireEncode(encoder3);
+  BOOST_CHECK_EQUAL(encoder3.block(), "0709 080144 080142 080143"_block);
+}
+
 BOOST_AUTO_TEST_CASE(ParseUri)
 {
   // canonical URI
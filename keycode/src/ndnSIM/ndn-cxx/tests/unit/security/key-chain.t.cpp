@@ -574,6 +574,138 @@ BOOST_FIXTURE_TEST_CASE_TEMPLATE(SigningInterface, T, SigningTests, T)
   }
 }
 
+static std::vector<shared_ptr<Data>>
+makeDataBatch(size_t size)
+{
+  std::vector<shared_ptr<Data>> batch;
+  for (size_t i = 0; i < size; ++i) {
+    batch.push_back(make_shared<Data>(Name("/batch/data").appendSegment(i)));
+    batch.back()->setContent(std::vector<uint8_t>(i + 1, 0xBB));
+  }
+  return batch;
+}
+
+BOOST_FIXTURE_TEST_CASE(SignBatch, KeyChainFixture)
+{
+  auto id = m_keyChain.createIdentity("/batch", RsaKeyParams());
+  auto batch = makeDataBatch(5);
+
+  m_keyChain.sign(batch, signingByIdentity(id));
+  for (const auto& data : batch) {
+    BOOST_CHECK_EQUAL(data->getSignatureType(), tlv::SignatureSha256WithRsa);
+    BOOST_CHECK_EQUAL(data->getKeyLocator().value().getName(),
+                      id.getDefaultKey().getDefaultCertificate().getName());
+    BOOST_CHECK(data->hasWire());
+    BOOST_CHECK(verifySignature(*data, id.getDefaultKey()));
+  }
+
+  m_keyChain.sign(batch, signingWithSha256());
+  for (const auto& data : batch) {
+    BOOST_CHECK_EQUAL(data->getSignatureType(), tlv::DigestSha256);
+    BOOST_CHECK(verifySignature(*data, nullopt));
+  }
+
+  BOOST_CHECK_NO_THROW(m_keyChain.sign(span<const shared_ptr<Data>>{}, signingByIdentity(id)));
+  BOOST_CHECK_THROW(m_keyChain.sign(batch, signingByIdentity("/non-existing/identity")),
+                    KeyChain::InvalidSigningInfoError);
+}
+
+BOOST_FIXTURE_TEST_CASE(SigningBufferReserve, KeyChainFixture)
+{
+  // a long KeyLocator and the largest signature KeyChain creates by default, RSA-4096
+  Name identity;
+  for (int i = 0; i < 32; ++i) {
+    identity.append("a-rather-long-name-component");
+  }
+  auto id = m_keyChain.createIdentity(identity, RsaKeyParams(4096));
+  auto key = id.getDefaultKey();
+
+  // the packet is encoded in the buffer reserved for it, which is not reallocated when the
+  // SignatureValue is appended
+  auto checkWire = [&] (const Data& data) {
+    const Block& wire = data.wireEncode();
+    BOOST_CHECK(verifySignature(data, key));
+    BOOST_CHECK_LT(wire.getBuffer()->size(), wire.size() + 64);
+  };
+
+  auto data = make_shared<Data>("/large/content");
+  data->setContent(std::vector<uint8_t>(8000, 0xAB));
+  m_keyChain.sign(*data, signingByIdentity(id));
+  BOOST_CHECK_EQUAL(data->getSignatureValue().value_size(), 512);
+  checkWire(*data);
+
+  auto batch = makeDataBatch(5);
+  m_keyChain.sign(batch, signingByIdentity(id));
+  for (const auto& packet : batch) {
+    checkWire(*packet);
+  }
+
+  // the audit path of a batch of 8 has 3 digests
+  batch = makeDataBatch(8);
+  m_keyChain.signMerkleBatch(batch, signingByIdentity(id));
+  for (const auto& packet : batch) {
+    BOOST_CHECK_EQUAL(packet->getSignatureValue().value_size(), 1 + 3 * 32 + 512);
+    checkWire(*packet);
+  }
+}
+
+BOOST_FIXTURE_TEST_CASE(SignMerkleBatch, KeyChainFixture)
+{
+  auto id = m_keyChain.createIdentity("/batch", EcKeyParams());
+  auto key = id.getDefaultKey();
+  auto cert = key.getDefaultCertificate();
+
+  for (size_t size : {1, 2, 5, 8}) {
+    BOOST_TEST_CONTEXT("Batch size = " << size) {
+      auto batch = makeDataBatch(size);
+      m_keyChain.signMerkleBatch(batch, signingByIdentity(id));
+
+      MerkleRootCache cache;
+      for (size_t i = 0; i < size; ++i) {
+        Data data(batch[i]->wireEncode());
+        BOOST_CHECK_EQUAL(data.getSignatureType(), tlv::SignatureSha256WithEcdsa);
+        auto leafIndex = data.getSignatureInfo().getCustomTlv(tlv::MerkleLeafIndex);
+        BOOST_REQUIRE(leafIndex);
+        BOOST_CHECK_EQUAL(readNonNegativeInteger(*leafIndex), i);
+
+        BOOST_CHECK(verifySignature(data, key));
+        BOOST_CHECK(verifySignature(data, cert));
+        BOOST_CHECK(verifySignature(data, cert, cache));
+      }
+      // the signature over the root is shared by the whole batch
+      BOOST_CHECK_EQUAL(cache.size(), 1);
+    }
+  }
+
+  auto batch = makeDataBatch(4);
+  m_keyChain.signMerkleBatch(batch, signingByIdentity(id));
+
+  // modified content
+  Data modified(*batch[1]);
+  modified.setContent(std::vector<uint8_t>{0xCC});
+  BOOST_CHECK(!verifySignature(modified, key));
+
+  // audit path of another packet
+  Data swapped(*batch[1]);
+  swapped.setSignatureValue(batch[2]->getSignatureValue().getBuffer());
+  BOOST_CHECK(!verifySignature(swapped, key));
+
+  // position of another packet
+  Data moved(*batch[1]);
+  auto sigInfo = moved.getSignatureInfo();
+  sigInfo.addCustomTlv(makeNonNegativeIntegerBlock(tlv::MerkleLeafIndex, 2));
+  moved.setSignatureInfo(sigInfo);
+  BOOST_CHECK(!verifySignature(moved, key));
+
+  // a cached root does not cover a modified packet
+  MerkleRootCache cache;
+  BOOST_CHECK(verifySignature(*batch[0], cert, cache));
+  BOOST_CHECK(!verifySignature(modified, cert, cache));
+
+  BOOST_CHECK_THROW(m_keyChain.signMerkleBatch(batch, signingWithSha256()),
+                    KeyChain::InvalidSigningInfoError);
+}
+
 class MakeCertificateFixture : public ClockFixture
 {
 public:
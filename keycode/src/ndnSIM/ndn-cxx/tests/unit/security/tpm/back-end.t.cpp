@@ -29,6 +29,7 @@
 #include "ndn-cxx/security/transform/private-key.hpp"
 #include "ndn-cxx/security/transform/public-key.hpp"
 #include "ndn-cxx/security/transform/verifier-filter.hpp"
+#include "ndn-cxx/security/verification-helpers.hpp"
 
 #include "tests/unit/security/tpm/back-end-wrapper-file.hpp"
 #include "tests/unit/security/tpm/back-end-wrapper-mem.hpp"
@@ -228,6 +229,33 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(EcdsaSigning, T, TestBackEnds)
   BOOST_CHECK_EQUAL(tpm.hasKey(ecKeyName), false);
 }
 
+BOOST_AUTO_TEST_CASE_TEMPLATE(BatchSigning, T, TestBackEnds)
+{
+  T wrapper;
+  BackEnd& tpm = wrapper.getTpm();
+
+  Name identity("/Test/EC/KeyName");
+  unique_ptr<KeyHandle> key = tpm.createKey(identity, EcKeyParams());
+  Name ecKeyName = key->getKeyName();
+  auto pubKeyBits = key->derivePublicKey();
+
+  const uint8_t content1[] = {0x01, 0x02, 0x03, 0x04};
+  const uint8_t content2[] = {0x05, 0x06, 0x07, 0x08};
+  const std::vector<InputBuffers> batch{{content1}, {content1, content2}, {content2}};
+  auto sigValues = key->sign(DigestAlgorithm::SHA256, batch);
+  BOOST_REQUIRE_EQUAL(sigValues.size(), batch.size());
+  for (size_t i = 0; i < batch.size(); ++i) {
+    BOOST_REQUIRE(sigValues[i] != nullptr);
+    BOOST_CHECK_EQUAL(verifySignature(batch[i], *sigValues[i], *pubKeyBits), true);
+  }
+  BOOST_CHECK_EQUAL(verifySignature(batch[0], *sigValues[1], *pubKeyBits), false);
+
+  BOOST_CHECK(key->sign(DigestAlgorithm::SHA256, span<const InputBuffers>{}).empty());
+
+  tpm.deleteKey(ecKeyName);
+  BOOST_CHECK_EQUAL(tpm.hasKey(ecKeyName), false);
+}
+
 #if OPENSSL_VERSION_NUMBER < 0x30000000L // FIXME #5154
 BOOST_AUTO_TEST_CASE(HmacSigningAndVerifying)
 {
@@ -157,6 +157,81 @@ BOOST_AUTO_TEST_CASE(TrustedCertCaching)
   face.sentInterests.clear();
 }
 
+BOOST_AUTO_TEST_CASE(ValidateBatch)
+{
+  std::vector<shared_ptr<Data>> signedBatch;
+  for (uint64_t i = 0; i < 4; ++i) {
+    signedBatch.push_back(make_shared<Data>(Name("/Security/ValidatorFixture/Sub1/Sub2/Data")
+                                            .appendSegment(i)));
+  }
+  m_keyChain.signMerkleBatch(signedBatch, signingByIdentity(subIdentity));
+
+  std::vector<Data> batch;
+  for (const auto& data : signedBatch) {
+    batch.push_back(*data);
+  }
+  Data modified(*signedBatch[2]);
+  modified.setContent(std::vector<uint8_t>{0xCC});
+  batch.push_back(modified);
+
+  optional<std::vector<Data>> validated;
+  std::vector<Name> failed;
+  validator.validate(batch,
+    [&] (const std::vector<Data>& packets) {
+      BOOST_CHECK(!validated);
+      validated = packets;
+    },
+    [&] (const Data& data, const ValidationError&) { failed.push_back(data.getName()); });
+  mockNetworkOperations();
+
+  BOOST_REQUIRE(validated);
+  BOOST_REQUIRE_EQUAL(validated->size(), 4);
+  for (size_t i = 0; i < 4; ++i) {
+    BOOST_CHECK_EQUAL(validated->at(i).getName(), signedBatch[i]->getName());
+  }
+  BOOST_REQUIRE_EQUAL(failed.size(), 1);
+  BOOST_CHECK_EQUAL(failed.front(), modified.getName());
+
+  bool hasEmptyResult = false;
+  validator.validate(span<const Data>{},
+    [&] (const std::vector<Data>& packets) { hasEmptyResult = packets.empty(); },
+    [] (const Data&, const ValidationError&) { BOOST_ERROR("Unexpected failure"); });
+  BOOST_CHECK(hasEmptyResult);
+}
+
+BOOST_AUTO_TEST_CASE(CachedVerification)
+{
+  auto cache = make_shared<VerificationCache>(10);
+  validator.setVerificationCache(cache);
+  BOOST_CHECK_EQUAL(validator.getVerificationCache(), cache);
+
+  Data data("/Security/ValidatorFixture/Sub1/Sub2/Data");
+  m_keyChain.sign(data, signingByIdentity(subIdentity));
+  VALIDATE_SUCCESS(data, "Should get accepted, as signed by the policy-compliant cert");
+  BOOST_CHECK_EQUAL(cache->size(), 1);
+  BOOST_CHECK_EQUAL(cache->getNHits(), 0);
+  BOOST_CHECK_EQUAL(cache->getNMisses(), 1);
+
+  VALIDATE_SUCCESS(data, "Should get accepted from the verification cache");
+  BOOST_CHECK_EQUAL(cache->getNHits(), 1);
+  BOOST_CHECK_EQUAL(cache->getNMisses(), 1);
+
+  // a modified packet has a different full name and is verified again
+  Data modified(data);
+  modified.setContent(std::vector<uint8_t>{0xCC});
+  VALIDATE_FAILURE(modified, "Should fail, as the signature does not cover the new content");
+  BOOST_CHECK_EQUAL(cache->size(), 1);
+  BOOST_CHECK_EQUAL(cache->getNMisses(), 2);
+
+  // the policy is still applied to cached packets
+  validator.resetVerifiedCertificates();
+  validator.resetAnchors();
+  VALIDATE_FAILURE(data, "Should fail, as no trusted cache or anchors");
+
+  validator.setVerificationCache(nullptr);
+  BOOST_CHECK(validator.getVerificationCache() == nullptr);
+}
+
 BOOST_AUTO_TEST_CASE(ResetVerifiedCertificates)
 {
   Data data("/Security/ValidatorFixture/Sub1/Sub2/Data");
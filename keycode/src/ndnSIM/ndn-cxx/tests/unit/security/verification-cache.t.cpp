@@ -0,0 +1,154 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/security/verification-cache.hpp"
+
+#include "tests/boost-test.hpp"
+#include "tests/key-chain-fixture.hpp"
+#include "tests/unit/clock-fixture.hpp"
+
+namespace ndn {
+namespace security {
+inline namespace v2 {
+namespace tests {
+
+using namespace ndn::tests;
+
+class VerificationCacheFixture : public ClockFixture, public KeyChainFixture
+{
+public:
+  VerificationCacheFixture()
+    : cache(3, 10_s)
+  {
+    cert = m_keyChain.createIdentity("/TestVerificationCache").getDefaultKey().getDefaultCertificate();
+    otherCert = m_keyChain.createIdentity("/TestVerificationCache/Other")
+                  .getDefaultKey().getDefaultCertificate();
+  }
+
+  static Name
+  makeFullName(uint64_t seq)
+  {
+    return Name("/TestVerificationCache/data").appendSegment(seq)
+           .appendImplicitSha256Digest(std::vector<uint8_t>(32, static_cast<uint8_t>(seq)));
+  }
+
+public:
+  VerificationCache cache;
+  Certificate cert;
+  Certificate otherCert;
+};
+
+BOOST_AUTO_TEST_SUITE(Security)
+BOOST_FIXTURE_TEST_SUITE(TestVerificationCache, VerificationCacheFixture)
+
+BOOST_AUTO_TEST_CASE(InsertContains)
+{
+  BOOST_CHECK_EQUAL(cache.getCapacity(), 3);
+  BOOST_CHECK(!cache.contains(makeFullName(1), cert));
+
+  cache.insert(makeFullName(1), cert);
+  BOOST_CHECK_EQUAL(cache.size(), 1);
+  BOOST_CHECK(cache.contains(makeFullName(1), cert));
+  BOOST_CHECK(!cache.contains(makeFullName(1), otherCert));
+  BOOST_CHECK(!cache.contains(makeFullName(2), cert));
+  BOOST_CHECK_EQUAL(cache.getNHits(), 1);
+  BOOST_CHECK_EQUAL(cache.getNMisses(), 3);
+
+  // re-inserting with another certificate replaces the entry
+  cache.insert(makeFullName(1), otherCert);
+  BOOST_CHECK_EQUAL(cache.size(), 1);
+  BOOST_CHECK(cache.contains(makeFullName(1), otherCert));
+  BOOST_CHECK(!cache.contains(makeFullName(1), cert));
+
+  cache.clear();
+  BOOST_CHECK_EQUAL(cache.size(), 0);
+  BOOST_CHECK(!cache.contains(makeFullName(1), otherCert));
+  BOOST_CHECK_EQUAL(cache.getNHits(), 2);
+  BOOST_CHECK_EQUAL(cache.getNMisses(), 5);
+}
+
+BOOST_AUTO_TEST_CASE(SameNameOtherCertificate)
+{
+  cache.insert(makeFullName(1), cert);
+
+  // another certificate published under the same name
+  Certificate replacement(cert);
+  auto now = time::system_clock::now();
+  SignatureInfo info = replacement.getSignatureInfo();
+  info.setValidityPeriod(ValidityPeriod(now - 1_h, now + 2_h));
+  replacement.setSignatureInfo(info);
+  m_keyChain.sign(replacement, signingByCertificate(otherCert));
+  BOOST_REQUIRE_EQUAL(replacement.getName(), cert.getName());
+
+  BOOST_CHECK(!cache.contains(makeFullName(1), replacement));
+  BOOST_CHECK(cache.contains(makeFullName(1), cert));
+
+  // a certificate without wire encoding cannot be identified
+  Certificate modified(cert);
+  modified.setSignatureInfo(info);
+  cache.insert(makeFullName(2), modified);
+  BOOST_CHECK_EQUAL(cache.size(), 1);
+  BOOST_CHECK(!cache.contains(makeFullName(1), modified));
+}
+
+BOOST_AUTO_TEST_CASE(LruEviction)
+{
+  cache.insert(makeFullName(1), cert);
+  cache.insert(makeFullName(2), cert);
+  cache.insert(makeFullName(3), cert);
+  BOOST_CHECK(cache.contains(makeFullName(1), cert)); // 2 becomes least recently used
+
+  cache.insert(makeFullName(4), cert);
+  BOOST_CHECK_EQUAL(cache.size(), 3);
+  BOOST_CHECK(cache.contains(makeFullName(1), cert));
+  BOOST_CHECK(!cache.contains(makeFullName(2), cert));
+  BOOST_CHECK(cache.contains(makeFullName(3), cert));
+  BOOST_CHECK(cache.contains(makeFullName(4), cert));
+}
+
+BOOST_AUTO_TEST_CASE(RemovalTime)
+{
+  // entry lifetime is capped to 10 seconds during cache construction
+  cache.insert(makeFullName(1), cert);
+  advanceClocks(5_s);
+  BOOST_CHECK(cache.contains(makeFullName(1), cert));
+
+  advanceClocks(6_s);
+  BOOST_CHECK(!cache.contains(makeFullName(1), cert));
+  BOOST_CHECK_EQUAL(cache.size(), 0);
+
+  // certificate that has already expired
+  Certificate expired(cert);
+  auto now = time::system_clock::now();
+  SignatureInfo info = expired.getSignatureInfo();
+  info.setValidityPeriod(ValidityPeriod(now - 2_h, now - 1_h));
+  expired.setSignatureInfo(info);
+  cache.insert(makeFullName(2), expired);
+  BOOST_CHECK_EQUAL(cache.size(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestVerificationCache
+BOOST_AUTO_TEST_SUITE_END() // Security
+
+} // namespace tests
+} // inline namespace v2
+} // namespace security
+} // namespace ndn
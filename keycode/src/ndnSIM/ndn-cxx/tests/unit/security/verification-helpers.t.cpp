@@ -677,6 +677,31 @@ BOOST_AUTO_TEST_CASE(VerifyWithUnrecognizedElements) // Bug #4583
   BOOST_CHECK(verifySignature(interest, nullopt));
 }
 
+BOOST_AUTO_TEST_CASE(MerkleRootCacheBoundaries)
+{
+  const std::vector<uint8_t> root(32, 0xA5);
+  const std::vector<uint8_t> sig(8, 0x00);
+  const std::vector<uint8_t> key{0x01, 0x02, 0x03, 0x04};
+
+  MerkleRootCache cache;
+  cache.insert(root, sig, key);
+  BOOST_CHECK_EQUAL(cache.size(), 1);
+  BOOST_CHECK(cache.contains(root, sig, key));
+
+  // the same bytes, split differently between root, signature, and key, with the signature size
+  // in either byte order
+  for (std::vector<uint8_t> sigSize : {std::vector<uint8_t>{8, 0, 0, 0, 0, 0, 0, 0},
+                                       std::vector<uint8_t>{0, 0, 0, 0, 0, 0, 0, 8}}) {
+    std::vector<uint8_t> longerRoot(root);
+    longerRoot.insert(longerRoot.end(), sigSize.begin(), sigSize.end());
+    BOOST_CHECK(!cache.contains(longerRoot, {}, key));
+  }
+
+  std::vector<uint8_t> longerSig(sig);
+  longerSig.push_back(key.front());
+  BOOST_CHECK(!cache.contains(root, longerSig, make_span(key).subspan(1)));
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestVerificationHelpers
 BOOST_AUTO_TEST_SUITE_END() // Security
 
@@ -22,6 +22,7 @@
  */
 
 #include "ndn-cxx/util/regex.hpp"
+#include "ndn-cxx/util/regex/compiled-regex.hpp"
 #include "ndn-cxx/util/regex/regex-backref-manager.hpp"
 #include "ndn-cxx/util/regex/regex-backref-matcher.hpp"
 #include "ndn-cxx/util/regex/regex-component-matcher.hpp"
@@ -487,6 +488,63 @@ BOOST_AUTO_TEST_CASE(RegexBackrefManagerMemoryLeak)
   BOOST_CHECK_EQUAL(b2.use_count(), 0);
 }
 
+BOOST_AUTO_TEST_CASE(CompiledMatchesTopMatcher)
+{
+  const std::vector<string> exprs{
+    "^<a><b><c>", "<b><c><d>$", "^<a><b><c><d>$", "<a><b><c><d>", "<b><c>",
+    "^(<.*>*)<.*>", "^(<.*>*)<.*><c>(<.*>)<.*>", "<a>(<>*)<>$",
+    "^<ndn><(.*)\\.(.*)><DNS>(<>*)<>",
+    "^<foo><bar><KEY><>{1,3}$", "^<foo><bar><>*<KEY><>{1,3}$", "^<foo><bar><>+<KEY><>{1,3}$",
+    "^[^<KEY>]*<KEY><>*<ksk-.*>$", "^[<a><b>]{2}[^<c>]?$", "^(<a><b>)+<c>?$", "^<a>{,2}<b>{2,}$",
+    "^<>$", "^$", "<x>", "^<a\\.b>*<c>",
+  };
+  const std::vector<Name> names{
+    "/", "/a", "/a/b", "/a/b/c", "/a/b/c/d", "/a/b/c/d/e", "/n/a/b/c", "/n/a/b/c/d/e",
+    "/ndn/ucla.edu/DNS/yingdi/mac/ksk-1", "/ndn/ucla/DNS/yingdi",
+    "/foo/bar/KEY/1", "/foo/bar/KEY/1/2/3", "/foo/bar/KEY/1/2/3/4", "/foo/bar/x/KEY/1",
+    "/foo/bar/x/y/KEY/1/2", "/foo/bar/KEY", "/foo/KEY/ksk-1", "/foo/KEY/dsk-1", "/KEY/KEY/ksk-2",
+    "/a/a", "/a/b/d", "/b/a/c", "/a/b/a/b/c", "/a/b/a/b", "/b/b", "/a/a/b/b/b", "/a/b/b",
+    "/x", "/y/x/z", "/a.b/a.b/c", "/axb/c",
+  };
+
+  for (const auto& expr : exprs) {
+    Regex regex(expr);
+    CompiledRegex compiled(expr);
+    for (const auto& name : names) {
+      BOOST_TEST_INFO(expr << " " << name);
+      BOOST_CHECK_EQUAL(compiled.match(name), regex.match(name));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(CompiledAtoms)
+{
+  CompiledRegex re("^<ndn>[<edu><com>]<>*<KEY><>$");
+  BOOST_CHECK(re.match("/ndn/edu/ucla/KEY/%01"));
+  BOOST_CHECK(re.match("/ndn/com/KEY/%01"));
+  BOOST_CHECK(!re.match("/ndn/org/KEY/%01"));
+  BOOST_CHECK(!re.match("/ndn/edu/KEY"));
+  BOOST_CHECK_EQUAL(re.getExpr(), "^<ndn>[<edu><com>]<>*<KEY><>$");
+
+  // typed components are literals in their URI form
+  CompiledRegex seg("^<a><seg=1>$");
+  BOOST_CHECK_EQUAL(seg.match(Name("/a").appendSegment(1)),
+                    Regex("^<a><seg=1>$").match(Name("/a").appendSegment(1)));
+}
+
+BOOST_AUTO_TEST_CASE(CompiledErrors)
+{
+  BOOST_CHECK_THROW(CompiledRegex(""), CompiledRegex::Error);
+  BOOST_CHECK_THROW(CompiledRegex("^<a"), CompiledRegex::Error);
+  BOOST_CHECK_THROW(CompiledRegex("^(<a>"), CompiledRegex::Error);
+  BOOST_CHECK_THROW(CompiledRegex("^<a>{2,1}"), CompiledRegex::Error);
+  BOOST_CHECK_THROW(CompiledRegex("^<a>{x}"), CompiledRegex::Error);
+  BOOST_CHECK_THROW(CompiledRegex("^a"), CompiledRegex::Error);
+  // too many positions after expanding the repetition
+  BOOST_CHECK_THROW(CompiledRegex("^<a>{100}$"), CompiledRegex::Error);
+  BOOST_CHECK_NO_THROW(CompiledRegex("^<a>{10,}$"));
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestRegex
 BOOST_AUTO_TEST_SUITE_END() // Util
 
@@ -121,6 +121,9 @@ public:
       auto data = makeDataSegment("/hello/world/version0",
                                   interest.getName().get(-1).toSegment(),
                                   interest.getName().get(-1).toSegment() == nSegments - 1);
+      if (alwaysSendFinalBlock) {
+        data->setFinalBlock(name::Component::fromSegment(nSegments - 1));
+      }
       face.receive(*data);
 
       uniqSegmentsSent.insert(interest.getName().get(-1).toSegment());
@@ -140,6 +143,9 @@ public:
       }
 
       auto data = makeDataSegment("/hello/world/version0", defaultSegmentToSend, nSegments == 1);
+      if (alwaysSendFinalBlock) {
+        data->setFinalBlock(name::Component::fromSegment(nSegments - 1));
+      }
       face.receive(*data);
       uniqSegmentsSent.insert(defaultSegmentToSend);
     }
@@ -167,6 +173,8 @@ public:
   lp::NackReason nackReason = lp::NackReason::NONE;
   // segment that is sent in response to an Interest w/o a segment component in its name
   uint64_t defaultSegmentToSend = 0;
+  // whether every segment carries the FinalBlockId, not only the last one
+  bool alwaysSendFinalBlock = false;
 };
 
 BOOST_AUTO_TEST_SUITE(Util)
@@ -349,6 +357,164 @@ BOOST_AUTO_TEST_CASE(BasicInOrder)
   BOOST_CHECK_EQUAL(nAfterSegmentTimedOut, 0);
 }
 
+BOOST_AUTO_TEST_CASE(CubicMultipleSegments)
+{
+  DummyValidator acceptValidator;
+  SegmentFetcher::Options options;
+  options.congestionControl = SegmentFetcher::CongestionControl::CUBIC;
+  options.enableFastConv = true;
+  nSegments = 401;
+  segmentsToDropOrNack.push(50);
+  segmentsToDropOrNack.push(200);
+  sendNackInsteadOfDropping = true;
+  nackReason = lp::NackReason::CONGESTION;
+
+  auto fetcher = SegmentFetcher::start(face, Interest("/hello/world"), acceptValidator, options);
+  face.onSendInterest.connect(bind(&SegmentFetcherFixture::onInterest, this, _1));
+  connectSignals(fetcher);
+
+  face.processEvents(1_s);
+
+  BOOST_CHECK_EQUAL(nErrors, 0);
+  BOOST_CHECK_EQUAL(nCompletions, 1);
+  BOOST_CHECK_EQUAL(dataSize, 14 * 401);
+  BOOST_CHECK_EQUAL(nAfterSegmentValidated, 401);
+  BOOST_CHECK_EQUAL(nAfterSegmentNacked, 2);
+}
+
+BOOST_AUTO_TEST_CASE(CubicWindow)
+{
+  DummyValidator acceptValidator;
+  SegmentFetcher::Options options;
+  options.congestionControl = SegmentFetcher::CongestionControl::CUBIC;
+  auto fetcher = SegmentFetcher::start(face, Interest("/hello/world"), acceptValidator, options);
+  connectSignals(fetcher);
+  advanceClocks(10_ms);
+
+  // answers the Interests sent since the last round, the first one with a congestion Nack if asked,
+  // then waits one RTT
+  size_t nAnswered = 0;
+  auto answerRound = [&] (bool isFirstNacked) {
+    size_t nSent = face.sentInterests.size();
+    for (size_t first = nAnswered; nAnswered < nSent; ++nAnswered) {
+      const Interest& interest = face.sentInterests[nAnswered];
+      uint64_t segment = interest.getName()[-1].isSegment() ? interest.getName()[-1].toSegment() : 0;
+      if (isFirstNacked && nAnswered == first) {
+        face.receive(makeNack(interest, lp::NackReason::CONGESTION));
+      }
+      else {
+        face.receive(*makeDataSegment("/hello/world/version0", segment, false));
+      }
+    }
+    advanceClocks(10_ms, 100_ms);
+  };
+
+  // slow start: one more segment per segment received
+  while (fetcher->m_cwnd < 16.0) {
+    double oldCwnd = fetcher->m_cwnd;
+    answerRound(false);
+    BOOST_CHECK_EQUAL(fetcher->m_cwnd, 2 * oldCwnd);
+  }
+
+  // multiplicative decrease on a congestion mark, the window is remembered as Wmax
+  double wmax = fetcher->m_cwnd;
+  answerRound(true);
+  BOOST_CHECK_EQUAL(fetcher->m_wmax, wmax);
+  BOOST_CHECK_EQUAL(fetcher->m_ssthresh, wmax * options.cubicBeta);
+  BOOST_CHECK_CLOSE(fetcher->m_cwnd, wmax * options.cubicBeta, 1.0);
+  BOOST_CHECK_EQUAL(nAfterSegmentNacked, 1);
+
+  // then the window grows slower than in slow start, back to Wmax, and beyond it after K
+  double k = std::cbrt(wmax * (1.0 - options.cubicBeta) / options.cubicC);
+  auto end = time::steady_clock::now() + time::microseconds(static_cast<int64_t>(2 * k * 1e6));
+  while (time::steady_clock::now() < end) {
+    double oldCwnd = fetcher->m_cwnd;
+    answerRound(false);
+    BOOST_CHECK_GE(fetcher->m_cwnd, oldCwnd);
+    BOOST_CHECK_LT(fetcher->m_cwnd, 2 * oldCwnd);
+  }
+  BOOST_CHECK_GT(fetcher->m_cwnd, wmax);
+  BOOST_CHECK_EQUAL(fetcher->m_ssthresh, wmax * options.cubicBeta);
+  BOOST_CHECK_EQUAL(nErrors, 0);
+}
+
+BOOST_AUTO_TEST_CASE(InvalidCubicOptions)
+{
+  SegmentFetcher::Options options;
+  options.cubicBeta = 1.0;
+  DummyValidator acceptValidator;
+  BOOST_CHECK_THROW(SegmentFetcher::start(face, Interest("/hello/world"), acceptValidator, options),
+                    std::invalid_argument);
+
+  options.cubicBeta = 0.7;
+  options.cubicC = 0.0;
+  BOOST_CHECK_THROW(SegmentFetcher::start(face, Interest("/hello/world"), acceptValidator, options),
+                    std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(ReassemblyInPlace)
+{
+  DummyValidator acceptValidator;
+  nSegments = 401;
+  alwaysSendFinalBlock = true;
+  segmentsToDropOrNack.push(3);
+  segmentsToDropOrNack.push(100);
+  sendNackInsteadOfDropping = true;
+  nackReason = lp::NackReason::DUPLICATE;
+
+  auto fetcher = SegmentFetcher::start(face, Interest("/hello/world"), acceptValidator);
+  face.onSendInterest.connect(bind(&SegmentFetcherFixture::onInterest, this, _1));
+  connectSignals(fetcher);
+
+  const uint8_t segment[] = "Hello, world!";
+  Buffer expected;
+  for (uint64_t i = 0; i < nSegments; ++i) {
+    expected.insert(expected.end(), std::begin(segment), std::end(segment));
+  }
+  Buffer streamed;
+  size_t nStreamed = 0;
+  fetcher->onInOrderBytes.connect([&] (span<const uint8_t> bytes) {
+    streamed.insert(streamed.end(), bytes.begin(), bytes.end());
+    ++nStreamed;
+  });
+  ConstBufferPtr completed;
+  fetcher->onComplete.connect([&] (ConstBufferPtr data) { completed = data; });
+
+  face.processEvents(1_s);
+
+  BOOST_CHECK_EQUAL(nErrors, 0);
+  BOOST_CHECK_EQUAL(nCompletions, 1);
+  BOOST_REQUIRE(completed != nullptr);
+  BOOST_CHECK_EQUAL_COLLECTIONS(completed->begin(), completed->end(), expected.begin(), expected.end());
+  BOOST_CHECK_EQUAL_COLLECTIONS(streamed.begin(), streamed.end(), expected.begin(), expected.end());
+  // bytes are delivered in larger runs than one segment at a time
+  BOOST_CHECK_LT(nStreamed, nSegments);
+}
+
+BOOST_AUTO_TEST_CASE(InOrderBytes)
+{
+  DummyValidator acceptValidator;
+  SegmentFetcher::Options options;
+  options.inOrder = true;
+  nSegments = 401;
+  segmentsToDropOrNack.push(10);
+  sendNackInsteadOfDropping = true;
+  nackReason = lp::NackReason::DUPLICATE;
+
+  auto fetcher = SegmentFetcher::start(face, Interest("/hello/world"), acceptValidator, options);
+  face.onSendInterest.connect(bind(&SegmentFetcherFixture::onInterest, this, _1));
+  connectSignals(fetcher);
+  size_t nBytesStreamed = 0;
+  fetcher->onInOrderBytes.connect([&] (span<const uint8_t> bytes) { nBytesStreamed += bytes.size(); });
+
+  face.processEvents(1_s);
+
+  BOOST_CHECK_EQUAL(nErrors, 0);
+  BOOST_CHECK_EQUAL(nOnInOrderComplete, 1);
+  BOOST_CHECK_EQUAL(nOnInOrderData, 401);
+  BOOST_CHECK_EQUAL(nBytesStreamed, 14 * 401);
+}
+
 BOOST_AUTO_TEST_CASE(FirstSegmentNotZero)
 {
   DummyValidator acceptValidator;
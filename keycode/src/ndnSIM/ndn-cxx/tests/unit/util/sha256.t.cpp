@@ -174,6 +174,42 @@ BOOST_AUTO_TEST_CASE(StaticComputeDigest)
   BOOST_TEST(*digest == *expected, boost::test_tools::per_element());
 }
 
+BOOST_AUTO_TEST_CASE(StaticComputeDigestInputBuffers)
+{
+  const uint8_t part1[] = {0x01, 0x02};
+  const uint8_t part2[] = {0x03};
+  const uint8_t part3[] = {0x04, 0x05, 0x06, 0x07, 0x08};
+
+  Sha256 sha;
+  sha << make_span(part1) << make_span(part2) << make_span(part3);
+  ConstBufferPtr expected = sha.computeDigest();
+
+  InputBuffers bufs;
+  bufs.emplace_back(part1, sizeof(part1));
+  bufs.emplace_back(part2, sizeof(part2));
+  bufs.emplace_back();
+  bufs.emplace_back(part3, sizeof(part3));
+  // a larger output buffer is allowed, only the first DIGEST_SIZE octets are written
+  std::vector<uint8_t> digest(Sha256::DIGEST_SIZE + 1, 0xFF);
+  Sha256::computeDigest(bufs, digest);
+  BOOST_TEST(make_span(digest).first(Sha256::DIGEST_SIZE) == *expected,
+             boost::test_tools::per_element());
+  BOOST_CHECK_EQUAL(digest.back(), 0xFF);
+
+  // the context reused by the next call does not carry state over
+  Sha256::computeDigest(bufs, digest);
+  BOOST_TEST(make_span(digest).first(Sha256::DIGEST_SIZE) == *expected,
+             boost::test_tools::per_element());
+
+  // empty input
+  Sha256::computeDigest({}, digest);
+  BOOST_TEST(make_span(digest).first(Sha256::DIGEST_SIZE) == *Sha256().computeDigest(),
+             boost::test_tools::per_element());
+
+  std::vector<uint8_t> tooSmall(Sha256::DIGEST_SIZE - 1);
+  BOOST_CHECK_THROW(Sha256::computeDigest(bufs, tooSmall), Sha256::Error);
+}
+
 BOOST_AUTO_TEST_CASE(Error)
 {
   Sha256 sha;
@@ -0,0 +1,92 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+
+// ndn-global-routing-test.cpp
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/point-to-point-module.h"
+#include "ns3/point-to-point-layout-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include <chrono>
+
+namespace ns3 {
+
+/**
+ * This scenario measures the wall time of the route calculation of GlobalRoutingHelper
+ * on a grid of size x size nodes, each node originating its own prefix:
+ *
+ *     ./waf --run "ndn-global-routing-test --size=32 --threads=4"
+ *
+ * Add --all-possible to evaluate CalculateAllPossibleRoutes instead of CalculateRoutes.
+ */
+int
+main(int argc, char* argv[])
+{
+  uint32_t size = 32;
+  uint32_t nThreads = 0;
+  bool allPossible = false;
+
+  CommandLine cmd;
+  cmd.AddValue("size", "Number of nodes on each side of the grid", size);
+  cmd.AddValue("threads", "Number of threads computing shortest paths (0 for one per core)",
+               nThreads);
+  cmd.AddValue("all-possible", "Calculate all possible routes instead of shortest routes",
+               allPossible);
+  cmd.Parse(argc, argv);
+
+  PointToPointHelper p2p;
+  PointToPointGridHelper grid(size, size, p2p);
+
+  ndn::StackHelper ndnHelper;
+  ndnHelper.InstallAll();
+
+  ndn::GlobalRoutingHelper ndnGlobalRoutingHelper;
+  ndnGlobalRoutingHelper.InstallAll();
+  for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
+    ndnGlobalRoutingHelper.AddOrigin("/node/" + std::to_string((*node)->GetId()), *node);
+  }
+
+  ndn::GlobalRoutingHelper::SetCalculationThreads(nThreads);
+
+  auto begin = std::chrono::steady_clock::now();
+  if (allPossible) {
+    ndn::GlobalRoutingHelper::CalculateAllPossibleRoutes();
+  }
+  else {
+    ndn::GlobalRoutingHelper::CalculateRoutes();
+  }
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - begin;
+
+  std::cout << "Nodes\tThreads\tSetupTime\n"
+            << size * size << "\t" << nThreads << "\t" << elapsed.count() << "s\n";
+
+  Simulator::Destroy();
+  return 0;
+}
+
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  return ns3::main(argc, argv);
+}
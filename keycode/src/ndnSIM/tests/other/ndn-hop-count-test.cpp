@@ -0,0 +1,121 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+
+
+// ndn-hop-count-test.cpp
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/point-to-point-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include <chrono>
+
+namespace ns3 {
+
+static uint64_t g_nDataHops = 0;
+
+// every Data packet that a node receives from a link is one hop
+static void
+CountDataHop(const ndn::Data& data, const ndn::Face& face)
+{
+  if (face.getScope() == ::ndn::nfd::FACE_SCOPE_NON_LOCAL) {
+    ++g_nDataHops;
+  }
+}
+
+/**
+ * This scenario measures the wall time that the simulation spends per Data packet and per hop,
+ * on a chain of hops links between a consumer and a producer:
+ *
+ *     ./waf --run "ndn-hop-count-test --hops=2"
+ *     ./waf --run "ndn-hop-count-test --hops=32 --payload=8192"
+ *
+ * The time per hop stays flat as the chain grows as long as each hop costs the same.
+ */
+int
+main(int argc, char* argv[])
+{
+  uint32_t nHops = 8;
+  uint32_t payloadSize = 1024;
+  double frequency = 1000;
+  double simulationTime = 10;
+
+  Config::SetDefault("ns3::PointToPointNetDevice::DataRate", StringValue("1Gbps"));
+  Config::SetDefault("ns3::PointToPointChannel::Delay", StringValue("1ms"));
+
+  CommandLine cmd;
+  cmd.AddValue("hops", "Number of links between the consumer and the producer", nHops);
+  cmd.AddValue("payload", "Payload size of the Data packets", payloadSize);
+  cmd.AddValue("frequency", "Interests sent per second", frequency);
+  cmd.AddValue("time", "Simulated time in seconds", simulationTime);
+  cmd.Parse(argc, argv);
+
+  NodeContainer nodes;
+  nodes.Create(nHops + 1);
+
+  PointToPointHelper p2p;
+  for (uint32_t i = 0; i < nHops; i++) {
+    p2p.Install(nodes.Get(i), nodes.Get(i + 1));
+  }
+
+  ndn::StackHelper ndnHelper;
+  ndnHelper.InstallAll();
+
+  ndn::GlobalRoutingHelper ndnGlobalRoutingHelper;
+  ndnGlobalRoutingHelper.InstallAll();
+
+  ndn::AppHelper consumerHelper("ns3::ndn::ConsumerCbr");
+  consumerHelper.SetPrefix("/prefix");
+  consumerHelper.SetAttribute("Frequency", DoubleValue(frequency));
+  consumerHelper.Install(nodes.Get(0));
+
+  ndn::AppHelper producerHelper("ns3::ndn::Producer");
+  producerHelper.SetPrefix("/prefix");
+  producerHelper.SetAttribute("PayloadSize", UintegerValue(payloadSize));
+  producerHelper.Install(nodes.Get(nHops));
+
+  ndnGlobalRoutingHelper.AddOrigins("/prefix", nodes.Get(nHops));
+  ndn::GlobalRoutingHelper::CalculateRoutes();
+
+  Config::ConnectWithoutContext("/NodeList/*/$ns3::ndn::L3Protocol/InData",
+                                MakeCallback(&CountDataHop));
+
+  Simulator::Stop(Seconds(simulationTime));
+
+  auto begin = std::chrono::steady_clock::now();
+  Simulator::Run();
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - begin;
+
+  std::cout << "Hops\tPayload\tDataHops\tWallTime\tPerDataHop\n"
+            << nHops << "\t" << payloadSize << "\t" << g_nDataHops << "\t" << elapsed.count() << "s\t"
+            << (g_nDataHops > 0 ? elapsed.count() / g_nDataHops * 1e9 : 0) << "ns\n";
+
+  Simulator::Destroy();
+  return 0;
+}
+
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  return ns3::main(argc, argv);
+}
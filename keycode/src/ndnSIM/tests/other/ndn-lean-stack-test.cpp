@@ -0,0 +1,81 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+
+
+// ndn-lean-stack-test.cpp
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/point-to-point-module.h"
+#include "ns3/point-to-point-layout-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include "ns3/ndnSIM/utils/mem-usage.hpp"
+
+namespace ns3 {
+
+/**
+ * This scenario measures the memory taken by the NDN stack of the nodes of a size x size grid,
+ * with the default install and with StackHelper::setLeanProfile():
+ *
+ *     ./waf --run "ndn-lean-stack-test --size=100"
+ *     ./waf --run "ndn-lean-stack-test --size=100 --lean"
+ */
+int
+main(int argc, char* argv[])
+{
+  uint32_t size = 100;
+  bool lean = false;
+
+  CommandLine cmd;
+  cmd.AddValue("size", "Number of nodes on each side of the grid", size);
+  cmd.AddValue("lean", "Install the stack with the lean profile", lean);
+  cmd.Parse(argc, argv);
+
+  PointToPointHelper p2p;
+  PointToPointGridHelper grid(size, size, p2p);
+
+  int64_t before = MemUsage::Get();
+
+  ndn::StackHelper ndnHelper;
+  if (lean) {
+    ndnHelper.setLeanProfile();
+  }
+  ndnHelper.InstallAll();
+
+  int64_t after = MemUsage::Get();
+  uint32_t nNodes = size * size;
+
+  std::cout << "Nodes\tProfile\tBefore\tAfter\tPerNode\n"
+            << nNodes << "\t" << (lean ? "lean" : "default") << "\t"
+            << before / 1024.0 / 1024.0 << "MiB\t" << after / 1024.0 / 1024.0 << "MiB\t"
+            << (after - before) / nNodes << "B\n";
+
+  Simulator::Destroy();
+  return 0;
+}
+
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  return ns3::main(argc, argv);
+}
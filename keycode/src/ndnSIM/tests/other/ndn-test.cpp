@@ -27,6 +27,7 @@
 #include <sys/time.h>
 #include "ns3/ndnSIM/utils/mem-usage.hpp"
 #include "ns3/ndnSIM/utils/mem-usage.hpp"
+#include "ns3/ndnSIM/NFD/daemon/common/global.hpp"
 
 namespace ns3 {
 
@@ -49,6 +50,8 @@ public:
     , m_interestRate(1000)
     , m_shouldEvaluatePit(false)
     , m_simulationTime(Seconds(2000) / m_interestRate)
+    , m_timerWheelGranularity(MilliSeconds(1))
+    , m_nZipfContents(0)
   {
   }
 
@@ -68,6 +71,8 @@ private:
   std::string m_strategy;
   double m_initialOverhead;
   Time m_simulationTime;
+  Time m_timerWheelGranularity;
+  uint32_t m_nZipfContents;
 };
 
 void
@@ -115,6 +120,7 @@ Tester::printStats(std::ostream& os, Time nextPrintTime, double beginRealTime)
 
   os << "pit:" << pitCount << "\t";
   os << "cs:" << csCount << "\t";
+  os << "events:" << Simulator::GetEventCount() << "\t";
 
   os << MemUsage::Get() / 1024.0 / 1024.0 << "MiB\n";
 
@@ -163,8 +169,17 @@ Tester::run(int argc, char* argv[])
                            "/localhost/nfd/strategy/best-route, ...) ",
                m_strategy);
   cmd.AddValue("sim-time", "Simulation time", m_simulationTime);
+  cmd.AddValue("timer-wheel", "Tick of the timing wheel used for PIT, Dead Nonce List and "
+                              "strategy timers (0 to use the precise event queue)",
+               m_timerWheelGranularity);
+  cmd.AddValue("zipf-contents", "Number of contents requested by a Zipf-Mandelbrot consumer "
+                                "(0 to request sequential names with ConsumerCbr)",
+               m_nZipfContents);
   cmd.Parse(argc, argv);
 
+  auto wheelGranularity = ::ndn::time::nanoseconds(m_timerWheelGranularity.GetNanoSeconds());
+  ::nfd::getScheduler().setCoarseGranularity(wheelGranularity);
+
   // Creating nodes
   NodeContainer nodes;
   nodes.Create(2);
@@ -187,10 +202,14 @@ Tester::run(int argc, char* argv[])
   // Installing applications
 
   // Consumer
-  ndn::AppHelper consumerHelper("ns3::ndn::ConsumerCbr");
+  ndn::AppHelper consumerHelper(m_nZipfContents == 0 ? "ns3::ndn::ConsumerCbr"
+                                                     : "ns3::ndn::ConsumerZipfMandelbrot");
   // Consumer will request /prefix/0, /prefix/1, ...
   consumerHelper.SetPrefix("/prefix");
   consumerHelper.SetAttribute("Frequency", DoubleValue(m_interestRate));
+  if (m_nZipfContents != 0) {
+    consumerHelper.SetAttribute("NumberOfContents", UintegerValue(m_nZipfContents));
+  }
   consumerHelper.Install(nodes.Get(0)); // first node
 
   if (!m_shouldEvaluatePit) {
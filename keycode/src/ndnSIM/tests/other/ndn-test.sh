@@ -52,3 +52,33 @@ echo
 echo "Using best route forwarding strategy.."
 
 ../../../waf --run ndn-test --command-template="%s --cs-size=${size} --rate=${rate} --strategy="/localhost/nfd/strategy/best-route" --sim-time=${sim_time}"
+
+echo
+
+size=100
+rate=100000
+sim_time=10
+
+# scenarios comparing the timing wheel with the precise event queue for PIT timers
+echo "Evaluation of PIT, Dead Nonce List and strategy timers with 1M Interests.."
+
+echo "Using the precise event queue.."
+
+../../../waf --run ndn-test --command-template="%s --cs-size=${size} --rate=${rate} --pit=$(true) --sim-time=${sim_time} --timer-wheel=0"
+
+echo
+
+echo "Using the timing wheel.."
+
+../../../waf --run ndn-test --command-template="%s --cs-size=${size} --rate=${rate} --pit=$(true) --sim-time=${sim_time} --timer-wheel=1ms"
+
+echo
+
+size=100
+rate=100000
+sim_time=10
+
+# scenario measuring the Interests generated per second of real time by a Zipf-Mandelbrot consumer
+echo "Evaluation of a Zipf-Mandelbrot consumer over 10M contents.."
+
+../../../waf --run ndn-test --command-template="%s --cs-size=${size} --rate=${rate} --sim-time=${sim_time} --zipf-contents=10000000"
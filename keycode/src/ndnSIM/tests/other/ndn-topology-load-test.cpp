@@ -0,0 +1,99 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+
+// ndn-topology-load-test.cpp
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include <chrono>
+#include <fstream>
+#include <random>
+
+namespace ns3 {
+
+/**
+ * This scenario measures the wall time of AnnotatedTopologyReader::Read on a random topology
+ * with the given number of links, every node attached to a random node created before it:
+ *
+ *     ./waf --run "ndn-topology-load-test --links=1000000 --threads=4"
+ *
+ * Add --binary to load the topology converted by AnnotatedTopologyReader::ConvertToBinary.
+ */
+int
+main(int argc, char* argv[])
+{
+  uint32_t nLinks = 100000;
+  uint32_t nThreads = 0;
+  bool isBinary = false;
+  std::string file = "topology-load-test.txt";
+
+  CommandLine cmd;
+  cmd.AddValue("links", "Number of links of the topology", nLinks);
+  cmd.AddValue("threads", "Number of threads parsing the links (0 for one per core)", nThreads);
+  cmd.AddValue("binary", "Load the binary topology instead of the text one", isBinary);
+  cmd.AddValue("file", "Name of the generated topology file", file);
+  cmd.Parse(argc, argv);
+
+  uint32_t nNodes = std::max(nLinks / 4, 2U);
+  std::mt19937 random(1);
+  {
+    std::ofstream os(file.c_str());
+    os << "router\n";
+    for (uint32_t i = 0; i < nNodes; i++) {
+      os << "node" << i << "\tNA\t0\t0\n";
+    }
+    os << "link\n";
+    for (uint32_t i = 0; i < nLinks; i++) {
+      uint32_t to = i % (nNodes - 1) + 1;
+      os << "node" << random() % to << "\tnode" << to << "\t" << 1 + random() % 10 << "Mbps\t1\t"
+         << 1 + random() % 20 << "ms\t100\n";
+    }
+  }
+
+  if (isBinary) {
+    AnnotatedTopologyReader::ConvertToBinary(file, file + ".bin");
+    file += ".bin";
+  }
+
+  AnnotatedTopologyReader topologyReader("", 1);
+  topologyReader.SetFileName(file);
+  topologyReader.SetParsingThreads(nThreads);
+
+  auto begin = std::chrono::steady_clock::now();
+  topologyReader.Read();
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - begin;
+
+  std::cout << "Links\tThreads\tFormat\tLoadTime\n"
+            << topologyReader.LinksSize() << "\t" << nThreads << "\t"
+            << (isBinary ? "binary" : "text") << "\t" << elapsed.count() << "s\n";
+
+  Simulator::Destroy();
+  return 0;
+}
+
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  return ns3::main(argc, argv);
+}
@@ -186,6 +186,67 @@ BOOST_AUTO_TEST_CASE(CalculateRoutesBasedOnLinkDelay)
   }
 }
 
+BOOST_AUTO_TEST_CASE(CalculateRoutesWithThreads)
+{
+  PointToPointHelper p2p;
+  PointToPointGridHelper grid(5, 5, p2p);
+
+  ndn::StackHelper ndnHelper;
+  ndnHelper.InstallAll();
+
+  ndn::GlobalRoutingHelper ndnGlobalRoutingHelper;
+  ndnGlobalRoutingHelper.InstallAll();
+  ndnGlobalRoutingHelper.AddOrigins("/prefix/a", grid.GetNode(4, 4));
+  ndnGlobalRoutingHelper.AddOrigins("/prefix/b", grid.GetNode(0, 4));
+
+  auto dumpFibs = [] {
+    std::map<std::tuple<uint32_t, Name, nfd::FaceId>, uint64_t> fibs;
+    for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
+      for (const auto& entry : (*node)->GetObject<L3Protocol>()->getForwarder()->getFib()) {
+        for (const auto& nextHop : entry.getNextHops()) {
+          fibs[std::make_tuple((*node)->GetId(), entry.getPrefix(), nextHop.getFace().getId())] =
+            nextHop.getCost();
+        }
+      }
+    }
+    return fibs;
+  };
+
+  ndn::GlobalRoutingHelper::SetCalculationThreads(1);
+  ndn::GlobalRoutingHelper::CalculateAllPossibleRoutes();
+  auto sequential = dumpFibs();
+  BOOST_CHECK_GT(sequential.size(), 0);
+
+  // a different next hop or cost would show up as an additional or modified FIB entry
+  ndn::GlobalRoutingHelper::SetCalculationThreads(4);
+  ndn::GlobalRoutingHelper::CalculateAllPossibleRoutes();
+  BOOST_CHECK(dumpFibs() == sequential);
+
+  ndn::GlobalRoutingHelper::SetCalculationThreads(0);
+}
+
+BOOST_AUTO_TEST_CASE(InstallSkipsNodesWithoutNdn)
+{
+  NodeContainer nodes;
+  nodes.Create(3);
+
+  PointToPointHelper p2p;
+  p2p.Install(nodes.Get(0), nodes.Get(1));
+  p2p.Install(nodes.Get(1), nodes.Get(2));
+
+  // the last node is on the IP side of a gateway
+  ndn::StackHelper ndnHelper;
+  ndnHelper.Install(nodes.Get(0));
+  ndnHelper.Install(nodes.Get(1));
+
+  ndn::GlobalRoutingHelper ndnGlobalRoutingHelper;
+  ndnGlobalRoutingHelper.Install(nodes.Get(0));
+
+  BOOST_REQUIRE(nodes.Get(1)->GetObject<GlobalRouter>() != nullptr);
+  BOOST_CHECK_EQUAL(nodes.Get(1)->GetObject<GlobalRouter>()->GetIncidencies().size(), 1);
+  BOOST_CHECK(nodes.Get(2)->GetObject<GlobalRouter>() == nullptr);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace ndn
@@ -18,6 +18,8 @@
  **/
 
 #include "helper/ndn-stack-helper.hpp"
+#include "helper/ndn-fib-helper.hpp"
+#include "helper/ndn-strategy-choice-helper.hpp"
 #include "../tests-common.hpp"
 
 #include "ns3/point-to-point-module.h"
@@ -62,6 +64,42 @@ BOOST_AUTO_TEST_CASE(TestNfdContentStorePolicy)
   BOOST_CHECK_EQUAL(protoNode1->getForwarder()->getCs().getPolicy()->getName(), "priority_fifo");
 }
 
+BOOST_AUTO_TEST_CASE(LeanProfile)
+{
+  NodeContainer nodes;
+  nodes.Create(2);
+
+  PointToPointHelper p2p;
+  p2p.Install(nodes.Get(0), nodes.Get(1));
+
+  ndn::StackHelper ndnHelper;
+  ndnHelper.setLeanProfile();
+  ndnHelper.InstallAll();
+
+  Ptr<L3Protocol> proto = L3Protocol::getL3Protocol(nodes.Get(0));
+  BOOST_CHECK(!proto->isManagementEnabled());
+  BOOST_CHECK(proto->getFibManager() == nullptr);
+  BOOST_CHECK_EQUAL(proto->getForwarder()->getStrategyChoice().size(), 1);
+
+  // the helpers update the tables without management commands
+  auto face = proto->getFaceByNetDevice(nodes.Get(0)->GetDevice(0));
+  BOOST_REQUIRE(face != nullptr);
+  FibHelper::AddRoute(nodes.Get(0), "/prefix", face, 3);
+
+  auto& fib = proto->getForwarder()->getFib();
+  BOOST_REQUIRE(fib.findExactMatch("/prefix") != nullptr);
+  BOOST_REQUIRE_EQUAL(fib.findExactMatch("/prefix")->getNextHops().size(), 1);
+  BOOST_CHECK_EQUAL(fib.findExactMatch("/prefix")->getNextHops().front().getCost(), 3);
+
+  FibHelper::RemoveRoute(nodes.Get(0), "/prefix", face);
+  BOOST_CHECK(fib.findExactMatch("/prefix") == nullptr);
+
+  StrategyChoiceHelper::Install(nodes.Get(0), "/prefix", "/localhost/nfd/strategy/multicast");
+  BOOST_CHECK_EQUAL(proto->getForwarder()->getStrategyChoice().size(), 2);
+  BOOST_CHECK(Name("/localhost/nfd/strategy/multicast").isPrefixOf(
+    proto->getForwarder()->getStrategyChoice().findEffectiveStrategy("/prefix/A").getInstanceName()));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace ndn
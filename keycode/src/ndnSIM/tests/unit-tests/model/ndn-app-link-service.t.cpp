@@ -0,0 +1,110 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "model/ndn-app-link-service.hpp"
+#include "helper/ndn-scenario-helper.hpp"
+#include "apps/ndn-app.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+class AppLinkServiceFixture : public ScenarioHelperWithCleanupFixture
+{
+public:
+  void
+  run(const std::string& isSynchronous, const std::string& producerNode)
+  {
+    createTopology({
+        {"1", "2"}
+      });
+
+    addRoutes({
+        {"1", "2", "/prefix", 1}
+      });
+
+    addApps({
+        {"1", "ns3::ndn::ConsumerCbr",
+            {{"Prefix", "/prefix"}, {"Frequency", "10"}, {"SynchronousDelivery", isSynchronous}},
+            "0s", "0.95s"},
+        {producerNode, "ns3::ndn::Producer",
+            {{"Prefix", "/prefix"}, {"PayloadSize", "100"}, {"SynchronousDelivery", isSynchronous}},
+            "0s", "100s"}
+      });
+
+    Config::ConnectWithoutContext("/NodeList/*/ApplicationList/*/$ns3::ndn::App/ReceivedInterests",
+                                  MakeCallback(&AppLinkServiceFixture::countInterest, this));
+    Config::ConnectWithoutContext("/NodeList/*/ApplicationList/*/$ns3::ndn::App/ReceivedDatas",
+                                  MakeCallback(&AppLinkServiceFixture::countData, this));
+
+    Simulator::Stop(Seconds(2.0));
+    Simulator::Run();
+  }
+
+private:
+  void
+  countInterest(shared_ptr<const Interest>, Ptr<App>, shared_ptr<Face>)
+  {
+    ++nInterests;
+  }
+
+  void
+  countData(shared_ptr<const Data>, Ptr<App>, shared_ptr<Face>)
+  {
+    ++nData;
+  }
+
+public:
+  size_t nInterests = 0;
+  size_t nData = 0;
+};
+
+BOOST_FIXTURE_TEST_SUITE(ModelNdnAppLinkService, AppLinkServiceFixture)
+
+BOOST_AUTO_TEST_CASE(Scheduled)
+{
+  run("false", "2");
+
+  BOOST_CHECK_EQUAL(nInterests, 10);
+  BOOST_CHECK_EQUAL(nData, 10);
+}
+
+BOOST_AUTO_TEST_CASE(Synchronous)
+{
+  run("true", "2");
+
+  BOOST_CHECK_EQUAL(nInterests, 10);
+  BOOST_CHECK_EQUAL(nData, 10);
+}
+
+BOOST_AUTO_TEST_CASE(SynchronousReentrant)
+{
+  // the Data is produced while the forwarder is still handling the consumer's Interest,
+  // so it reaches the consumer only after the consumer's send returns
+  run("true", "1");
+
+  BOOST_CHECK_EQUAL(nInterests, 10);
+  BOOST_CHECK_EQUAL(nData, 10);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -92,6 +92,51 @@ BOOST_AUTO_TEST_CASE(EncodePrintData)
   BOOST_CHECK_EQUAL(header.GetSerializedSize(), 1365);
 }
 
+BOOST_AUTO_TEST_CASE(SerializeComposite)
+{
+  Data data("/other/prefix");
+  data.setContent(std::make_shared< ::ndn::Buffer>(1024));
+  ndn::StackHelper::getKeyChain().sign(data);
+  lp::Packet lpPacket(data.wireEncode());
+  lpPacket.add<::ndn::lp::SequenceField>(0);
+
+  BlockHeader header(lpPacket.wireEncodeComposite());
+  BOOST_CHECK_EQUAL(header.getBlock().hasWire(), false);
+
+  Block expected = lpPacket.wireEncode();
+  BOOST_CHECK_EQUAL(header.GetSerializedSize(), expected.size());
+
+  Ptr<Packet> packet = Create<Packet>();
+  packet->AddHeader(header);
+  std::vector<uint8_t> serialized(packet->GetSize());
+  packet->CopyData(serialized.data(), serialized.size());
+  BOOST_CHECK_EQUAL_COLLECTIONS(serialized.begin(), serialized.end(), expected.begin(), expected.end());
+
+  BlockHeader decoded;
+  packet->RemoveHeader(decoded);
+  BOOST_CHECK(decoded.getBlock() == expected);
+}
+
+BOOST_AUTO_TEST_CASE(DeserializePadded)
+{
+  Data data("/other/prefix");
+  data.setContent(std::make_shared< ::ndn::Buffer>(1024));
+  ndn::StackHelper::getKeyChain().sign(data);
+  Block expected = lp::Packet(data.wireEncode()).wireEncode();
+
+  Ptr<Packet> packet = Create<Packet>();
+  packet->AddHeader(BlockHeader(expected));
+  packet->AddPaddingAtEnd(10); // e.g., Ethernet padding of a short frame
+
+  BlockHeader decoded;
+  BOOST_CHECK_EQUAL(packet->RemoveHeader(decoded), expected.size());
+  BOOST_CHECK(decoded.getBlock() == expected);
+  BOOST_CHECK_EQUAL(packet->GetSize(), 10);
+
+  Ptr<Packet> truncated = Create<Packet>(expected.data(), expected.size() - 1);
+  BOOST_CHECK_THROW(truncated->RemoveHeader(decoded), ::ndn::tlv::Error);
+}
+
 BOOST_AUTO_TEST_CASE(PrintLpPacket)
 {
   Interest interest("/prefix");
@@ -0,0 +1,129 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2021  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include <ndn-cxx/util/scheduler.hpp>
+
+#include "ns3/ndnSIM/utils/ndn-time.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+using ::ndn::Scheduler;
+using ::ndn::scheduler::EventId;
+using namespace ::ndn::time_literals;
+
+class SchedulerFixture : public CleanupFixture
+{
+public:
+  SchedulerFixture()
+    : scheduler(io)
+  {
+    ::ndn::time::setCustomClocks(make_shared<time::CustomSteadyClock>(),
+                                 make_shared<time::CustomSystemClock>());
+  }
+
+protected:
+  ::ndn::DummyIoService io;
+  Scheduler scheduler;
+};
+
+BOOST_FIXTURE_TEST_SUITE(NdnCxxScheduler, SchedulerFixture)
+
+BOOST_AUTO_TEST_CASE(CoarseEvents)
+{
+  std::vector<std::pair<Time, Time>> fired; // requested, actual
+
+  auto scheduleAt = [&] (time::nanoseconds after) {
+    Time requested = Simulator::Now() + NanoSeconds(after.count());
+    return scheduler.scheduleCoarse(after, [&fired, requested] {
+      fired.emplace_back(requested, Simulator::Now());
+    });
+  };
+
+  scheduleAt(0_ms);
+  scheduleAt(250_us);
+  scheduleAt(63_ms);
+  scheduleAt(64_ms);
+  scheduleAt(4100_ms);
+  scheduleAt(10_s);
+  scheduleAt(6_h); // beyond the wheel horizon
+  EventId canceled = scheduleAt(500_ms);
+  canceled.cancel();
+  BOOST_CHECK(!canceled);
+
+  Simulator::Stop(Hours(7));
+  Simulator::Run();
+
+  BOOST_REQUIRE_EQUAL(fired.size(), 7);
+  for (const auto& event : fired) {
+    BOOST_CHECK_GE(event.second, event.first);
+    BOOST_CHECK_LE(event.second, event.first + MilliSeconds(1));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(CoarseRescheduleFromCallback)
+{
+  int nFired = 0;
+  std::function<void()> reschedule = [&] {
+    if (++nFired < 100) {
+      scheduler.scheduleCoarse(1500_us, reschedule);
+    }
+  };
+  scheduler.scheduleCoarse(1_ms, reschedule);
+
+  Simulator::Stop(Seconds(1));
+  Simulator::Run();
+
+  BOOST_CHECK_EQUAL(nFired, 100);
+}
+
+BOOST_AUTO_TEST_CASE(CoarseSharesTimer)
+{
+  int nFired = 0;
+  for (int i = 0; i < 1000; ++i) {
+    scheduler.scheduleCoarse(time::microseconds(10 + i % 900), [&] { ++nFired; });
+  }
+
+  Simulator::Stop(Seconds(1));
+  Simulator::Run();
+
+  BOOST_CHECK_EQUAL(nFired, 1000);
+  // all events fall within the same 1ms tick and are executed from a single simulator event
+  BOOST_CHECK_LE(Simulator::GetEventCount(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(CoarseDisabled)
+{
+  scheduler.setCoarseGranularity(0_ns);
+
+  Time firedAt;
+  scheduler.scheduleCoarse(250_us, [&] { firedAt = Simulator::Now(); });
+
+  Simulator::Stop(Seconds(1));
+  Simulator::Run();
+
+  BOOST_CHECK_EQUAL(firedAt, MicroSeconds(250));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,169 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/topology/annotated-topology-reader.hpp"
+
+#include "ns3/mobility-model.h"
+#include "ns3/names.h"
+#include "ns3/node.h"
+
+#include "../../tests-common.hpp"
+
+#include <boost/filesystem.hpp>
+
+#include <fstream>
+#include <sstream>
+
+namespace ns3 {
+namespace ndn {
+
+const boost::filesystem::path TEST_TOPO_DIR =
+  boost::filesystem::path(TEST_CONFIG_PATH) / "annotated-topology-reader";
+
+// B A is the reverse of A B, and is dropped
+const std::vector<std::string> TOPOLOGY = {
+  "router",
+  "# node  comment  yPos  xPos",
+  "A  NA  1  2",
+  "B  NA  3  4",
+  "C  NA  5  6",
+  "link",
+  "# from  to  capacity  metric  delay  queue  lossRate",
+  "A  B  10Mbps  1  10ms  20",
+  "B  C  1Mbps  2  5ms  10  ns3::RateErrorModel,ErrorRate=0.01,ErrorUnit=ERROR_UNIT_PACKET",
+  "B  A  5Mbps  3  1ms  5",
+  "C  A  2Mbps  4  2ms  30",
+};
+
+const std::vector<std::string> EXPECTED = {
+  "node A 2 -1",
+  "node B 4 -3",
+  "node C 6 -5",
+  "link A B DataRate=10Mbps OSPF=1 Delay=10ms MaxPackets=20",
+  "link B C DataRate=1Mbps OSPF=2 Delay=5ms MaxPackets=10 "
+    "LossRate=ns3::RateErrorModel,ErrorRate=0.01,ErrorUnit=ERROR_UNIT_PACKET",
+  "link C A DataRate=2Mbps OSPF=4 Delay=2ms MaxPackets=30",
+};
+
+class AnnotatedTopologyReaderFixture : public CleanupFixture
+{
+public:
+  AnnotatedTopologyReaderFixture()
+  {
+    boost::filesystem::create_directories(TEST_TOPO_DIR);
+  }
+
+  ~AnnotatedTopologyReaderFixture()
+  {
+    boost::filesystem::remove_all(TEST_TOPO_DIR);
+  }
+
+  /**
+   * @brief Write TOPOLOGY, ending lines with @p newLine, and with @p nPaddingLines comment lines
+   *        after every link
+   */
+  std::string
+  WriteTopology(const std::string& name, const std::string& newLine, size_t nPaddingLines = 0)
+  {
+    std::string file = (TEST_TOPO_DIR / name).string();
+    std::ofstream os(file.c_str(), std::ios::binary);
+    bool isLinkSection = false;
+    for (const std::string& line : TOPOLOGY) {
+      os << line << newLine;
+      isLinkSection = isLinkSection || line == "link";
+      if (isLinkSection && line[0] != '#' && line != "link") {
+        for (size_t i = 0; i < nPaddingLines; i++) {
+          os << "#" << std::string(127, '-') << newLine;
+        }
+      }
+    }
+    return file;
+  }
+
+  /**
+   * @brief Read @p file, and describe the nodes and links created
+   */
+  std::vector<std::string>
+  Read(const std::string& file, uint32_t nThreads = 1)
+  {
+    AnnotatedTopologyReader reader;
+    reader.SetFileName(file);
+    reader.SetParsingThreads(nThreads);
+    reader.Read();
+
+    std::vector<std::string> topology;
+    NodeContainer nodes = reader.GetNodes();
+    for (NodeContainer::Iterator node = nodes.Begin(); node != nodes.End(); node++) {
+      Vector position = (*node)->GetObject<MobilityModel>()->GetPosition();
+      std::ostringstream os;
+      os << "node " << Names::FindName(*node) << " " << position.x << " " << position.y;
+      topology.push_back(os.str());
+    }
+    for (const TopologyReader::Link& link : reader.GetLinks()) {
+      std::ostringstream os;
+      os << "link " << link.GetFromNodeName() << " " << link.GetToNodeName();
+      for (const char* attribute : {"DataRate", "OSPF", "Delay", "MaxPackets", "LossRate"}) {
+        std::string value;
+        if (link.GetAttributeFailSafe(attribute, value)) {
+          os << " " << attribute << "=" << value;
+        }
+      }
+      topology.push_back(os.str());
+    }
+    return topology;
+  }
+};
+
+BOOST_FIXTURE_TEST_SUITE(UtilsTopologyAnnotatedTopologyReader, AnnotatedTopologyReaderFixture)
+
+BOOST_AUTO_TEST_CASE(Text)
+{
+  std::vector<std::string> topology = Read(WriteTopology("topo.txt", "\n"));
+  BOOST_CHECK_EQUAL_COLLECTIONS(topology.begin(), topology.end(), EXPECTED.begin(), EXPECTED.end());
+}
+
+BOOST_AUTO_TEST_CASE(TextCrLf)
+{
+  std::vector<std::string> topology = Read(WriteTopology("topo.txt", "\r\n"));
+  BOOST_CHECK_EQUAL_COLLECTIONS(topology.begin(), topology.end(), EXPECTED.begin(), EXPECTED.end());
+}
+
+BOOST_AUTO_TEST_CASE(TextParallel)
+{
+  // the links are spread over a link section large enough to be split between the threads
+  std::string file = WriteTopology("topo.txt", "\n", 3000);
+  BOOST_REQUIRE_GT(boost::filesystem::file_size(file), 4 * 3000 * 128);
+
+  std::vector<std::string> topology = Read(file, 4);
+  BOOST_CHECK_EQUAL_COLLECTIONS(topology.begin(), topology.end(), EXPECTED.begin(), EXPECTED.end());
+}
+
+BOOST_AUTO_TEST_CASE(Binary)
+{
+  std::string file = (TEST_TOPO_DIR / "topo.bin").string();
+  AnnotatedTopologyReader::ConvertToBinary(WriteTopology("topo.txt", "\n"), file);
+
+  std::vector<std::string> topology = Read(file);
+  BOOST_CHECK_EQUAL_COLLECTIONS(topology.begin(), topology.end(), EXPECTED.begin(), EXPECTED.end());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,163 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/tracers/ndn-app-delay-quantile-tracer.hpp"
+
+#include <boost/filesystem.hpp>
+
+#include "../../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+const boost::filesystem::path TEST_QUANTILE_TRACE = boost::filesystem::path(TEST_CONFIG_PATH) / "quantile-trace.txt";
+
+class AppDelayQuantileTracerFixture : public ScenarioHelperWithCleanupFixture
+{
+public:
+  AppDelayQuantileTracerFixture()
+  {
+    boost::filesystem::create_directories(TEST_CONFIG_PATH);
+
+    // setting default parameters for PointToPoint links and channels
+    Config::SetDefault("ns3::PointToPointNetDevice::DataRate", StringValue("10Mbps"));
+    Config::SetDefault("ns3::PointToPointChannel::Delay", StringValue("10ms"));
+    Config::SetDefault("ns3::DropTailQueue<Packet>::MaxSize", StringValue("20p"));
+
+    createTopology({
+        {"1", "2"},
+        {"2", "3"}
+      });
+
+    addRoutes({
+        {"1", "2", "/prefix", 1},
+        {"2", "3", "/prefix", 1}
+      });
+
+    addApps({
+        {"1", "ns3::ndn::ConsumerCbr",
+            {{"Prefix", "/prefix"}, {"Frequency", "1"}},
+            "1s", "1.9s"}, // send just one packet
+        {"2", "ns3::ndn::ConsumerCbr",
+            {{"Prefix", "/prefix"}, {"Frequency", "1"}},
+            "2s", "100s"},
+        {"3", "ns3::ndn::Producer",
+            {{"Prefix", "/prefix"}, {"PayloadSize", "1024"}},
+            "0s", "100s"}
+      });
+  }
+
+  ~AppDelayQuantileTracerFixture()
+  {
+    boost::filesystem::remove(TEST_QUANTILE_TRACE);
+    AppDelayQuantileTracer::Destroy(); // additional cleanup
+  }
+};
+
+BOOST_FIXTURE_TEST_SUITE(UtilsTracersNdnAppDelayQuantileTracer, AppDelayQuantileTracerFixture)
+
+BOOST_AUTO_TEST_CASE(Histogram)
+{
+  AppDelayQuantileTracer::Histogram histogram;
+  for (uint64_t delay = 1; delay <= 100000; ++delay) {
+    histogram.Record(delay);
+  }
+
+  BOOST_CHECK_EQUAL(histogram.GetCount(), 100000);
+  BOOST_CHECK_EQUAL(histogram.GetMin(), 1);
+  BOOST_CHECK_EQUAL(histogram.GetMax(), 100000);
+  BOOST_CHECK_CLOSE(histogram.GetMean(), 50000.5, 0.0001);
+  BOOST_CHECK_CLOSE(static_cast<double>(histogram.GetQuantile(0.5)), 50000, 1);
+  BOOST_CHECK_CLOSE(static_cast<double>(histogram.GetQuantile(0.9)), 90000, 1);
+  BOOST_CHECK_CLOSE(static_cast<double>(histogram.GetQuantile(0.99)), 99000, 1);
+  BOOST_CHECK_EQUAL(histogram.GetQuantile(0.0), 1);
+  BOOST_CHECK_EQUAL(histogram.GetQuantile(1.0), 100000);
+
+  // small values are exact
+  AppDelayQuantileTracer::Histogram small;
+  for (uint64_t delay = 0; delay < 100; ++delay) {
+    small.Record(delay);
+  }
+  BOOST_CHECK_EQUAL(small.GetQuantile(0.5), 49);
+  BOOST_CHECK_EQUAL(small.GetQuantile(0.9), 89);
+
+  // memory does not depend on the number of samples
+  size_t nBuckets = histogram.GetBucketCount();
+  for (int i = 0; i < 10; ++i) {
+    for (uint64_t delay = 1; delay <= 100000; ++delay) {
+      histogram.Record(delay);
+    }
+  }
+  BOOST_CHECK_EQUAL(histogram.GetBucketCount(), nBuckets);
+
+  histogram.Reset();
+  BOOST_CHECK_EQUAL(histogram.GetCount(), 0);
+  histogram.Record(41766);
+  BOOST_CHECK_EQUAL(histogram.GetQuantile(0.5), 41766);
+  BOOST_CHECK_EQUAL(histogram.GetBucketCount(), nBuckets);
+}
+
+BOOST_AUTO_TEST_CASE(InstallAll)
+{
+  AppDelayQuantileTracer::InstallAll(TEST_QUANTILE_TRACE.string(), Seconds(2.5));
+
+  Simulator::Stop(Seconds(6));
+  Simulator::Run();
+
+  AppDelayQuantileTracer::Destroy(); // to force log to be written
+
+  std::ifstream t(TEST_QUANTILE_TRACE.string().c_str());
+  std::stringstream buffer;
+  buffer << t.rdbuf();
+
+  BOOST_CHECK_EQUAL(buffer.str(),
+                    R"STR(Time	Node	AppId	Prefix	Type	Samples	MinUS	P50US	P90US	P99US	MaxUS	MeanUS
+2.5	1	0	/prefix	LastDelay	1	41766	41766	41766	41766	41766	41766
+2.5	1	0	/prefix	FullDelay	1	41766	41766	41766	41766	41766	41766
+2.5	2	0	/prefix	LastDelay	1	0	0	0	0	0	0
+2.5	2	0	/prefix	FullDelay	1	0	0	0	0	0	0
+5	2	0	/prefix	LastDelay	2	20883	20883	20883	20883	20883	20883
+5	2	0	/prefix	FullDelay	2	20883	20883	20883	20883	20883	20883
+)STR");
+}
+
+BOOST_AUTO_TEST_CASE(InstallNode)
+{
+  AppDelayQuantileTracer::Install(getNode("1"), TEST_QUANTILE_TRACE.string(), Seconds(2.5));
+
+  Simulator::Stop(Seconds(6));
+  Simulator::Run();
+
+  AppDelayQuantileTracer::Destroy(); // to force log to be written
+
+  std::ifstream t(TEST_QUANTILE_TRACE.string().c_str());
+  std::stringstream buffer;
+  buffer << t.rdbuf();
+
+  BOOST_CHECK_EQUAL(buffer.str(),
+                    R"STR(Time	Node	AppId	Prefix	Type	Samples	MinUS	P50US	P90US	P99US	MaxUS	MeanUS
+2.5	1	0	/prefix	LastDelay	1	41766	41766	41766	41766	41766	41766
+2.5	1	0	/prefix	FullDelay	1	41766	41766	41766	41766	41766	41766
+)STR");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
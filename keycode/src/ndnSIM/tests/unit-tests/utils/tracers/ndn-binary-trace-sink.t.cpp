@@ -0,0 +1,132 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/tracers/ndn-binary-trace-sink.hpp"
+
+#include <boost/filesystem.hpp>
+
+#include <fstream>
+#include <sstream>
+
+#include "../../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+const boost::filesystem::path TEST_TRACE = boost::filesystem::path(TEST_CONFIG_PATH) / "trace.bin";
+const boost::filesystem::path TEST_TRACE_GZ = boost::filesystem::path(TEST_CONFIG_PATH) / "trace.bin.gz";
+
+using Column = BinaryTraceSink::Column;
+
+class BinaryTraceSinkFixture
+{
+public:
+  BinaryTraceSinkFixture()
+  {
+    boost::filesystem::create_directories(TEST_CONFIG_PATH);
+  }
+
+  ~BinaryTraceSinkFixture()
+  {
+    boost::filesystem::remove(TEST_TRACE);
+    boost::filesystem::remove(TEST_TRACE_GZ);
+  }
+
+  /**
+   * @brief Write @p nRecords records to @p file, return the text the converter should produce
+   */
+  std::string
+  write(const boost::filesystem::path& file, size_t nRecords)
+  {
+    std::ostringstream expected;
+    expected << "Time\tNode\tFaceId\tType\tPackets\tSeqNo\tHopCount\n";
+
+    auto sink = BinaryTraceSink::Open(file.string());
+    BOOST_REQUIRE(sink != nullptr);
+    sink->Start("Time\tNode\tFaceId\tType\tPackets\tSeqNo\tHopCount",
+                {Column::DOUBLE, Column::STRING, Column::INT64, Column::STRING, Column::DOUBLE,
+                 Column::UINT32, Column::INT32});
+    for (size_t i = 0; i < nRecords; i++) {
+      double time = i * 0.25;
+      std::string node = "node" + std::to_string(i % 10);
+      int64_t faceId = i % 3 == 0 ? -1 : 256 + i % 4;
+      const char* type = i % 2 == 0 ? "InInterests" : "OutData";
+      double packets = i / 3.0;
+      uint32_t seqNo = i;
+      int32_t hopCount = -static_cast<int32_t>(i % 5);
+
+      sink->Write(time, node, faceId, type, packets, seqNo, hopCount);
+      expected << time << "\t" << node << "\t" << faceId << "\t" << type << "\t" << packets << "\t"
+               << seqNo << "\t" << hopCount << "\n";
+    }
+    return expected.str();
+  }
+
+  std::string
+  convert(const boost::filesystem::path& file)
+  {
+    std::ifstream is(file.string(), std::ios_base::binary);
+    std::ostringstream os;
+    BinaryTraceSink::ConvertToTsv(is, os);
+    return os.str();
+  }
+};
+
+BOOST_FIXTURE_TEST_SUITE(UtilsTracersNdnBinaryTraceSink, BinaryTraceSinkFixture)
+
+BOOST_AUTO_TEST_CASE(IsBinaryFile)
+{
+  BOOST_CHECK(BinaryTraceSink::IsBinaryFile("rate-trace.bin"));
+  BOOST_CHECK(BinaryTraceSink::IsBinaryFile("rate-trace.bin.gz"));
+  BOOST_CHECK(!BinaryTraceSink::IsBinaryFile("rate-trace.txt"));
+  BOOST_CHECK(!BinaryTraceSink::IsBinaryFile("-"));
+}
+
+BOOST_AUTO_TEST_CASE(ConvertToTsv)
+{
+  // several chunks, each with its own new strings
+  std::string expected = write(TEST_TRACE, 100000);
+  BOOST_CHECK(convert(TEST_TRACE) == expected);
+}
+
+BOOST_AUTO_TEST_CASE(ConvertCompressedToTsv)
+{
+  std::string expected = write(TEST_TRACE_GZ, 100000);
+  BOOST_CHECK(convert(TEST_TRACE_GZ) == expected);
+  BOOST_CHECK_LT(boost::filesystem::file_size(TEST_TRACE_GZ), expected.size());
+}
+
+BOOST_AUTO_TEST_CASE(Truncated)
+{
+  write(TEST_TRACE, 10);
+
+  std::ifstream is(TEST_TRACE.string(), std::ios_base::binary);
+  std::string trace((std::istreambuf_iterator<char>(is)), std::istreambuf_iterator<char>());
+  std::istringstream truncated(trace.substr(0, trace.size() - 1));
+  std::ostringstream os;
+  BOOST_CHECK_THROW(BinaryTraceSink::ConvertToTsv(truncated, os), BinaryTraceSink::Error);
+
+  std::istringstream text("Time\tNode\n");
+  BOOST_CHECK_THROW(BinaryTraceSink::ConvertToTsv(text, os), BinaryTraceSink::Error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
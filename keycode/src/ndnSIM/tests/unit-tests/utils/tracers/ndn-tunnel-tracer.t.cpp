@@ -0,0 +1,118 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/tracers/ndn-tunnel-tracer.hpp"
+
+#include "ns3/application.h"
+#include "ns3/traced-callback.h"
+#include "ns3/traced-value.h"
+
+#include <boost/test/output_test_stream.hpp>
+
+#include "../../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @brief Application with the trace sources of a gateway
+ */
+class TunnelTestApp : public Application {
+public:
+  static TypeId
+  GetTypeId()
+  {
+    static TypeId tid =
+      TypeId("ns3::ndn::TunnelTestApp")
+        .SetParent<Application>()
+        .AddConstructor<TunnelTestApp>()
+        .AddTraceSource("TunnelTx", "", MakeTraceSourceAccessor(&TunnelTestApp::m_tunnelTx), "")
+        .AddTraceSource("TunnelRx", "", MakeTraceSourceAccessor(&TunnelTestApp::m_tunnelRx), "")
+        .AddTraceSource("Drop", "", MakeTraceSourceAccessor(&TunnelTestApp::m_drop), "")
+        .AddTraceSource("GttLookup", "", MakeTraceSourceAccessor(&TunnelTestApp::m_gttLookup), "")
+        .AddTraceSource("DttSize", "", MakeTraceSourceAccessor(&TunnelTestApp::m_dttSize), "");
+    return tid;
+  }
+
+  void
+  Run()
+  {
+    Ipv4Address peer("10.0.0.2");
+    m_tunnelTx(Create<Packet>(1024), peer);
+    m_tunnelTx(Create<Packet>(1024), peer);
+    m_tunnelRx(Create<Packet>(512), peer, MilliSeconds(10));
+    m_tunnelRx(Create<Packet>(512), peer, Seconds(-1)); // not stamped, not in InDelayS
+    m_drop(Create<Packet>(100), Ipv4Address::GetAny());
+
+    ::ndn::ViewArena arena;
+    Name prefix("/domain2/dst1");
+    m_gttLookup(::ndn::NameView(prefix, arena), peer, true);
+    m_gttLookup(::ndn::NameView(prefix, arena), Ipv4Address::GetAny(), false);
+    m_dttSize = 3;
+  }
+
+public:
+  TracedCallback<Ptr<const Packet>, Ipv4Address> m_tunnelTx;
+  TracedCallback<Ptr<const Packet>, Ipv4Address, Time> m_tunnelRx;
+  TracedCallback<Ptr<const Packet>, Ipv4Address> m_drop;
+  TracedCallback<const ::ndn::NameView&, Ipv4Address, bool> m_gttLookup;
+  TracedValue<uint32_t> m_dttSize;
+};
+
+BOOST_FIXTURE_TEST_SUITE(UtilsTracersNdnTunnelTracer, CleanupFixture)
+
+BOOST_AUTO_TEST_CASE(PeriodicRates)
+{
+  Ptr<Node> node = CreateObject<Node>();
+  Names::Add("gateway", node);
+  Ptr<TunnelTestApp> app = CreateObject<TunnelTestApp>();
+  node->AddApplication(app);
+
+  auto output = make_shared<boost::test_tools::output_test_stream>();
+  Ptr<TunnelTracer> tracer = TunnelTracer::Install(node, output, Seconds(1));
+
+  Simulator::Schedule(Seconds(0.5), &TunnelTestApp::Run, app);
+  Simulator::Stop(Seconds(1.5));
+  Simulator::Run();
+
+  tracer = nullptr; // destroy tracer
+
+  BOOST_CHECK(output->is_equal(
+    R"STR(1	gateway	0.0.0.0	OutPackets	0
+1	gateway	0.0.0.0	OutKilobytes	0
+1	gateway	0.0.0.0	InPackets	0
+1	gateway	0.0.0.0	InKilobytes	0
+1	gateway	0.0.0.0	Drops	1
+1	gateway	0.0.0.0	InDelayS	0
+1	gateway	10.0.0.2	OutPackets	2
+1	gateway	10.0.0.2	OutKilobytes	2
+1	gateway	10.0.0.2	InPackets	2
+1	gateway	10.0.0.2	InKilobytes	1
+1	gateway	10.0.0.2	Drops	0
+1	gateway	10.0.0.2	InDelayS	0.01
+1	gateway	all	GttHits	1
+1	gateway	all	GttMisses	1
+1	gateway	all	DttSize	3
+)STR"));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -50,8 +50,17 @@
 
 #include <boost/graph/adjacency_list.hpp>
 #include <boost/graph/graphviz.hpp>
+#include <boost/iostreams/device/mapped_file.hpp>
 
+#include <algorithm>
+#include <cstring>
+#include <limits>
 #include <set>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
 
 #ifdef NS3_MPI
 #include <ns3/mpi-interface.h>
@@ -69,6 +78,7 @@ AnnotatedTopologyReader::AnnotatedTopologyReader(const std::string& path, double
   , m_randY(CreateObject<UniformRandomVariable>())
   , m_scale(scale)
   , m_requiredPartitions(1)
+  , m_nParsingThreads(0)
 {
   NS_LOG_FUNCTION(this);
 
@@ -150,121 +160,510 @@ AnnotatedTopologyReader::GetLinks() const
   return m_linksList;
 }
 
-NodeContainer
-AnnotatedTopologyReader::Read(void)
+/// @cond include_hidden
+
+struct TopologyNode {
+  std::string name;
+  double latitude = 0;
+  double longitude = 0;
+  uint32_t systemId = 0;
+};
+
+/**
+ * \brief Link between two nodes, referred to by their index
+ *
+ * The attributes point into the mapped file.
+ */
+struct TopologyLink {
+  uint32_t from;
+  uint32_t to;
+  std::string_view capacity;
+  std::string_view metric;
+  std::string_view delay;
+  std::string_view maxPackets;
+  std::string_view lossRate;
+};
+
+struct AnnotatedTopologyReader::ParsedTopology {
+  std::string file;
+  boost::iostreams::mapped_file_source mapping;
+  std::vector<TopologyNode> nodes;
+  std::vector<TopologyLink> links;
+  bool hasLinkSection = false;
+};
+
+// the binary topology is little-endian on every host, and its doubles are IEEE 754 binary64
+static_assert(std::numeric_limits<double>::is_iec559 && sizeof(double) == sizeof(uint64_t),
+              "binary topology doubles are IEEE 754 binary64");
+
+static const char BINARY_MAGIC[] = {'N', 'D', 'N', 'S', 'I', 'M', 'T', 'P'};
+static const uint32_t BINARY_VERSION = 1;
+static const uint32_t NO_STRING = std::numeric_limits<uint32_t>::max();
+
+// a smaller link section is not worth starting threads
+static const size_t MIN_PARALLEL_SIZE = 1024 * 1024;
+
+/**
+ * \brief Iterate over the lines of [begin, end), without the end of line characters
+ */
+static bool
+nextLine(const char*& begin, const char* end, std::string_view& line)
 {
-  ifstream topgen;
-  topgen.open(GetFileName().c_str());
+  if (begin == end) {
+    return false;
+  }
+  const char* newLine = static_cast<const char*>(std::memchr(begin, '\n', end - begin));
+  const char* lineEnd = newLine != nullptr ? newLine : end;
+  line = std::string_view(begin, lineEnd - begin);
+  if (!line.empty() && line.back() == '\r') {
+    line.remove_suffix(1);
+  }
+  begin = newLine != nullptr ? newLine + 1 : end;
+  return true;
+}
 
-  if (!topgen.is_open() || !topgen.good()) {
-    NS_FATAL_ERROR("Cannot open file " << GetFileName() << " for reading");
-    return m_nodes;
+/**
+ * \brief Split a line into at most \p maxTokens whitespace separated tokens, as operator>> does
+ */
+static size_t
+tokenize(std::string_view line, std::string_view* tokens, size_t maxTokens)
+{
+  size_t nTokens = 0;
+  size_t pos = 0;
+  while (nTokens < maxTokens) {
+    pos = line.find_first_not_of(" \t\r\v\f", pos);
+    if (pos == std::string_view::npos) {
+      break;
+    }
+    size_t tokenEnd = std::min(line.find_first_of(" \t\r\v\f", pos), line.size());
+    tokens[nTokens++] = line.substr(pos, tokenEnd - pos);
+    pos = tokenEnd;
+  }
+  return nTokens;
+}
+
+template<class T>
+static bool
+parseNumber(std::string_view token, T& value)
+{
+  std::istringstream is{std::string(token)};
+  return static_cast<bool>(is >> value);
+}
+
+/**
+ * \brief Parse the links of [begin, end)
+ * \param[out] error set to the first unknown node name
+ */
+static void
+parseLinks(const char* begin, const char* end,
+           const std::unordered_map<std::string_view, uint32_t>& index,
+           std::vector<TopologyLink>& links, std::string& error)
+{
+  std::string_view line;
+  while (nextLine(begin, end, line)) {
+    if (line.empty() || line[0] == '#')
+      continue; // comments
+
+    std::string_view tokens[7];
+    size_t nTokens = tokenize(line, tokens, 7);
+    if (nTokens == 0)
+      continue;
+
+    auto from = index.find(tokens[0]);
+    auto to = index.find(tokens[1]);
+    if (from == index.end() || to == index.end()) {
+      error = std::string(from == index.end() ? tokens[0] : tokens[1]);
+      return;
+    }
+
+    links.push_back({from->second, to->second, tokens[2], tokens[3], tokens[4], tokens[5],
+                     tokens[6]});
+  }
+}
+
+/// @endcond
+
+void
+AnnotatedTopologyReader::SetParsingThreads(uint32_t nThreads)
+{
+  m_nParsingThreads = nThreads;
+}
+
+void
+AnnotatedTopologyReader::Parse(const std::string& file, uint32_t nThreads,
+                               ParsedTopology& topology)
+{
+  topology.file = file;
+  try {
+    topology.mapping.open(file);
+  }
+  catch (const std::exception&) {
+    NS_FATAL_ERROR("Cannot open file " << file << " for reading");
   }
 
-  while (!topgen.eof()) {
-    string line;
-    getline(topgen, line);
+  if (topology.mapping.size() >= sizeof(BINARY_MAGIC)
+      && std::equal(std::begin(BINARY_MAGIC), std::end(BINARY_MAGIC), topology.mapping.data())) {
+    ParseBinary(topology);
+  }
+  else {
+    ParseText(nThreads, topology);
+  }
+}
 
-    if (line == "router")
+void
+AnnotatedTopologyReader::ParseText(uint32_t nThreads, ParsedTopology& topology)
+{
+  const char* begin = topology.mapping.data();
+  const char* end = begin + topology.mapping.size();
+
+  std::string_view line;
+  bool hasRouterSection = false;
+  while (nextLine(begin, end, line)) {
+    if (line == "router") {
+      hasRouterSection = true;
       break;
+    }
   }
 
-  if (topgen.eof()) {
-    NS_FATAL_ERROR("Topology file " << GetFileName() << " does not have \"router\" section");
-    return m_nodes;
+  if (!hasRouterSection) {
+    NS_FATAL_ERROR("Topology file " << topology.file << " does not have \"router\" section");
+    return;
   }
 
-  while (!topgen.eof()) {
-    string line;
-    getline(topgen, line);
-    if (line[0] == '#')
+  while (nextLine(begin, end, line)) {
+    if (!line.empty() && line[0] == '#')
       continue; // comments
-    if (line == "link")
+    if (line == "link") {
+      topology.hasLinkSection = true;
       break; // stop reading nodes
+    }
 
-    istringstream lineBuffer(line);
-    string name, city;
-    double latitude = 0, longitude = 0;
-    uint32_t systemId = 0;
-
-    lineBuffer >> name >> city >> latitude >> longitude >> systemId;
-    if (name.empty())
+    std::string_view tokens[5];
+    size_t nTokens = tokenize(line, tokens, 5);
+    if (nTokens == 0)
       continue;
 
-    Ptr<Node> node;
+    TopologyNode node;
+    node.name = std::string(tokens[0]);
+    // as operator>>, stop at the first value that is not a number
+    nTokens > 2 && parseNumber(tokens[2], node.latitude)
+      && nTokens > 3 && parseNumber(tokens[3], node.longitude)
+      && nTokens > 4 && parseNumber(tokens[4], node.systemId);
+    topology.nodes.push_back(std::move(node));
+  }
 
-    if (abs(latitude) > 0.001 && abs(latitude) > 0.001)
-      node = CreateNode(name, m_scale * longitude, -m_scale * latitude, systemId);
+  if (!topology.hasLinkSection) {
+    return;
+  }
+
+  // index of the nodes, the names are not modified anymore
+  std::unordered_map<std::string_view, uint32_t> index(topology.nodes.size());
+  for (uint32_t i = 0; i < topology.nodes.size(); i++) {
+    index.emplace(topology.nodes[i].name, i);
+  }
+
+  // split the link section at line boundaries, parse the parts in parallel
+  if (nThreads == 0) {
+    nThreads = std::max(std::thread::hardware_concurrency(), 1U);
+  }
+  if (static_cast<size_t>(end - begin) < MIN_PARALLEL_SIZE) {
+    nThreads = 1;
+  }
+
+  std::vector<const char*> bounds{begin};
+  for (uint32_t i = 1; i < nThreads; i++) {
+    const char* bound = std::max(begin + (end - begin) * i / nThreads, bounds.back());
+    const char* newLine = static_cast<const char*>(std::memchr(bound, '\n', end - bound));
+    bounds.push_back(newLine != nullptr ? newLine + 1 : end);
+  }
+  bounds.push_back(end);
+
+  std::vector<std::vector<TopologyLink>> parts(nThreads);
+  std::vector<std::string> errors(nThreads);
+  std::vector<std::thread> threads;
+  for (uint32_t i = 1; i < nThreads; i++) {
+    threads.emplace_back(parseLinks, bounds[i], bounds[i + 1], std::cref(index),
+                         std::ref(parts[i]), std::ref(errors[i]));
+  }
+  parseLinks(bounds[0], bounds[1], index, parts[0], errors[0]);
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  size_t nLinks = 0;
+  for (uint32_t i = 0; i < nThreads; i++) {
+    NS_ABORT_MSG_IF(!errors[i].empty(), errors[i] << " node not found");
+    nLinks += parts[i].size();
+  }
+  topology.links.reserve(nLinks);
+  for (auto& part : parts) {
+    topology.links.insert(topology.links.end(), part.begin(), part.end());
+  }
+}
+
+/// @cond include_hidden
+
+/**
+ * \brief Reader of the binary topology, aborting on truncation
+ */
+class BinaryTopologyInput {
+public:
+  BinaryTopologyInput(const char* begin, const char* end, const std::string& file)
+    : m_begin(begin)
+    , m_end(end)
+    , m_file(file)
+  {
+  }
+
+  template<class T>
+  T
+  Read()
+  {
+    if constexpr (std::is_same_v<T, double>) {
+      uint64_t bits = Read<uint64_t>();
+      double value;
+      std::memcpy(&value, &bits, sizeof(value));
+      return value;
+    }
     else {
-      Ptr<UniformRandomVariable> var = CreateObject<UniformRandomVariable>();
-      node = CreateNode(name, var->GetValue(0, 200), var->GetValue(0, 200), systemId);
-      // node = CreateNode (name, systemId);
+      const unsigned char* bytes = reinterpret_cast<const unsigned char*>(Take(sizeof(T)));
+      T value = 0;
+      for (size_t i = 0; i < sizeof(T); i++) {
+        value |= static_cast<T>(bytes[i]) << (8 * i);
+      }
+      return value;
     }
   }
 
-  map<string, set<string>> processedLinks; // to eliminate duplications
+  std::string_view
+  ReadString()
+  {
+    uint32_t size = Read<uint32_t>();
+    return std::string_view(Take(size), size);
+  }
 
-  if (topgen.eof()) {
-    NS_LOG_ERROR("Topology file " << GetFileName() << " does not have \"link\" section");
-    return m_nodes;
+private:
+  const char*
+  Take(size_t size)
+  {
+    NS_ABORT_MSG_IF(static_cast<size_t>(m_end - m_begin) < size,
+                    "Binary topology " << m_file << " is truncated");
+    const char* data = m_begin;
+    m_begin += size;
+    return data;
   }
 
-  // SeekToSection ("link");
-  while (!topgen.eof()) {
-    string line;
-    getline(topgen, line);
-    if (line == "")
-      continue;
-    if (line[0] == '#')
-      continue; // comments
+private:
+  const char* m_begin;
+  const char* m_end;
+  const std::string& m_file;
+};
 
-    // NS_LOG_DEBUG ("Input: [" << line << "]");
+/// @endcond
 
-    istringstream lineBuffer(line);
-    string from, to, capacity, metric, delay, maxPackets, lossRate;
+void
+AnnotatedTopologyReader::ParseBinary(ParsedTopology& topology)
+{
+  BinaryTopologyInput is(topology.mapping.data() + sizeof(BINARY_MAGIC),
+                         topology.mapping.data() + topology.mapping.size(), topology.file);
+  NS_ABORT_MSG_IF(is.Read<uint32_t>() != BINARY_VERSION,
+                  "Unsupported version of binary topology " << topology.file);
+
+  topology.nodes.resize(is.Read<uint32_t>());
+  for (TopologyNode& node : topology.nodes) {
+    node.name = std::string(is.ReadString());
+    node.latitude = is.Read<double>();
+    node.longitude = is.Read<double>();
+    node.systemId = is.Read<uint32_t>();
+  }
 
-    lineBuffer >> from >> to >> capacity >> metric >> delay >> maxPackets >> lossRate;
+  // strings stay in the mapped file
+  std::vector<std::string_view> strings(is.Read<uint32_t>());
+  for (std::string_view& string : strings) {
+    string = is.ReadString();
+  }
+  auto getString = [&] (uint32_t id) {
+    if (id == NO_STRING) {
+      return std::string_view();
+    }
+    NS_ABORT_MSG_IF(id >= strings.size(), "Unknown string in binary topology " << topology.file);
+    return strings[id];
+  };
+
+  topology.links.resize(is.Read<uint32_t>());
+  for (TopologyLink& link : topology.links) {
+    link.from = is.Read<uint32_t>();
+    link.to = is.Read<uint32_t>();
+    NS_ABORT_MSG_IF(link.from >= topology.nodes.size() || link.to >= topology.nodes.size(),
+                    "Unknown node in binary topology " << topology.file);
+    link.capacity = getString(is.Read<uint32_t>());
+    link.metric = getString(is.Read<uint32_t>());
+    link.delay = getString(is.Read<uint32_t>());
+    link.maxPackets = getString(is.Read<uint32_t>());
+    link.lossRate = getString(is.Read<uint32_t>());
+  }
+  topology.hasLinkSection = true;
+}
 
-    if (processedLinks[to].size() != 0
-        && processedLinks[to].find(from) != processedLinks[to].end()) {
-      continue; // duplicated link
+void
+AnnotatedTopologyReader::ConvertToBinary(const std::string& textFile,
+                                         const std::string& binaryFile)
+{
+  ParsedTopology topology;
+  Parse(textFile, 0, topology);
+
+  ofstream os(binaryFile.c_str(), ios::trunc | ios::binary);
+  NS_ABORT_MSG_IF(!os.is_open(), "File " << binaryFile << " cannot be opened for writing");
+
+  auto writeInteger = [&os] (auto value) {
+    char bytes[sizeof(value)];
+    for (size_t i = 0; i < sizeof(value); i++) {
+      bytes[i] = static_cast<char>(value >> (8 * i));
+    }
+    os.write(bytes, sizeof(bytes));
+  };
+  auto write = [&] (auto value) {
+    if constexpr (std::is_same_v<decltype(value), double>) {
+      uint64_t bits;
+      std::memcpy(&bits, &value, sizeof(bits));
+      writeInteger(bits);
     }
-    processedLinks[from].insert(to);
+    else {
+      writeInteger(value);
+    }
+  };
+  auto writeString = [&] (std::string_view value) {
+    write(static_cast<uint32_t>(value.size()));
+    os.write(value.data(), value.size());
+  };
+
+  os.write(BINARY_MAGIC, sizeof(BINARY_MAGIC));
+  write(BINARY_VERSION);
+
+  write(static_cast<uint32_t>(topology.nodes.size()));
+  for (const TopologyNode& node : topology.nodes) {
+    writeString(node.name);
+    write(node.latitude);
+    write(node.longitude);
+    write(node.systemId);
+  }
 
-    Ptr<Node> fromNode = Names::Find<Node>(m_path, from);
-    NS_ASSERT_MSG(fromNode != 0, from << " node not found");
-    Ptr<Node> toNode = Names::Find<Node>(m_path, to);
-    NS_ASSERT_MSG(toNode != 0, to << " node not found");
+  // link attributes take few distinct values, each is written once
+  std::unordered_map<std::string_view, uint32_t> stringIds;
+  std::vector<std::string_view> strings;
+  auto getId = [&] (std::string_view value) {
+    if (value.empty()) {
+      return NO_STRING;
+    }
+    auto id = stringIds.emplace(value, strings.size());
+    if (id.second) {
+      strings.push_back(value);
+    }
+    return id.first->second;
+  };
+  std::vector<uint32_t> linkStrings;
+  linkStrings.reserve(topology.links.size() * 5);
+  for (const TopologyLink& link : topology.links) {
+    for (std::string_view value : {link.capacity, link.metric, link.delay, link.maxPackets,
+                                   link.lossRate}) {
+      linkStrings.push_back(getId(value));
+    }
+  }
 
-    Link link(fromNode, from, toNode, to);
+  write(static_cast<uint32_t>(strings.size()));
+  for (std::string_view string : strings) {
+    writeString(string);
+  }
 
-    link.SetAttribute("DataRate", capacity);
-    link.SetAttribute("OSPF", metric);
+  write(static_cast<uint32_t>(topology.links.size()));
+  auto linkString = linkStrings.begin();
+  for (const TopologyLink& link : topology.links) {
+    write(link.from);
+    write(link.to);
+    for (int i = 0; i < 5; i++) {
+      write(*linkString++);
+    }
+  }
 
-    if (!delay.empty())
-      link.SetAttribute("Delay", delay);
-    if (!maxPackets.empty())
-      link.SetAttribute("MaxPackets", maxPackets);
+  NS_ABORT_MSG_IF(!os.good(), "Cannot write binary topology " << binaryFile);
+}
 
-    // Saran Added lossRate
-    if (!lossRate.empty())
-      link.SetAttribute("LossRate", lossRate);
+NodeContainer
+AnnotatedTopologyReader::Read(void)
+{
+  ParsedTopology topology;
+  Parse(GetFileName(), m_nParsingThreads, topology);
 
-    AddLink(link);
-    NS_LOG_DEBUG("New link " << from << " <==> " << to << " / " << capacity << " with " << metric
-                             << " metric (" << delay << ", " << maxPackets << ", " << lossRate
-                             << ")");
+  Create(topology);
+  if (!topology.hasLinkSection) {
+    NS_LOG_ERROR("Topology file " << GetFileName() << " does not have \"link\" section");
+    return m_nodes;
   }
 
   NS_LOG_INFO("Annotated topology created with " << m_nodes.GetN() << " nodes and " << LinksSize()
                                                  << " links");
-  topgen.close();
 
   ApplySettings();
 
   return m_nodes;
 }
 
+void
+AnnotatedTopologyReader::Create(const ParsedTopology& topology)
+{
+  std::vector<Ptr<Node>> nodes;
+  nodes.reserve(topology.nodes.size());
+  for (const TopologyNode& parsedNode : topology.nodes) {
+    const std::string& name = parsedNode.name;
+    double latitude = parsedNode.latitude;
+    double longitude = parsedNode.longitude;
+    uint32_t systemId = parsedNode.systemId;
+
+    Ptr<Node> node;
+
+    if (abs(latitude) > 0.001 && abs(latitude) > 0.001)
+      node = CreateNode(name, m_scale * longitude, -m_scale * latitude, systemId);
+    else {
+      Ptr<UniformRandomVariable> var = CreateObject<UniformRandomVariable>();
+      node = CreateNode(name, var->GetValue(0, 200), var->GetValue(0, 200), systemId);
+      // node = CreateNode (name, systemId);
+    }
+    nodes.push_back(node);
+  }
+
+  // to eliminate duplications: a link is skipped if the reverse link is already there
+  std::unordered_set<uint64_t> processedLinks(topology.links.size());
+  auto key = [] (uint32_t from, uint32_t to) { return static_cast<uint64_t>(from) << 32 | to; };
+
+  for (const TopologyLink& parsedLink : topology.links) {
+    if (processedLinks.count(key(parsedLink.to, parsedLink.from)) != 0) {
+      continue; // duplicated link
+    }
+    processedLinks.insert(key(parsedLink.from, parsedLink.to));
+
+    const std::string& from = topology.nodes[parsedLink.from].name;
+    const std::string& to = topology.nodes[parsedLink.to].name;
+    Link link(nodes[parsedLink.from], from, nodes[parsedLink.to], to);
+
+    link.SetAttribute("DataRate", std::string(parsedLink.capacity));
+    link.SetAttribute("OSPF", std::string(parsedLink.metric));
+
+    if (!parsedLink.delay.empty())
+      link.SetAttribute("Delay", std::string(parsedLink.delay));
+    if (!parsedLink.maxPackets.empty())
+      link.SetAttribute("MaxPackets", std::string(parsedLink.maxPackets));
+
+    // Saran Added lossRate
+    if (!parsedLink.lossRate.empty())
+      link.SetAttribute("LossRate", std::string(parsedLink.lossRate));
+
+    AddLink(link);
+    NS_LOG_DEBUG("New link " << from << " <==> " << to << " / " << parsedLink.capacity << " with "
+                             << parsedLink.metric << " metric (" << parsedLink.delay << ", "
+                             << parsedLink.maxPackets << ", " << parsedLink.lossRate << ")");
+  }
+}
+
 void
 AnnotatedTopologyReader::AssignIpv4Addresses(Ipv4Address base)
 {
@@ -336,14 +735,17 @@ AnnotatedTopologyReader::ApplySettings()
 #endif
 
   PointToPointHelper p2p;
+  // links mostly share their settings, the helper is only updated when they change
+  string lastMaxPackets, lastDataRate, lastDelay;
 
   BOOST_FOREACH (Link& link, m_linksList) {
     // cout << "Link: " << Findlink.GetFromNode () << ", " << link.GetToNode () << endl;
     string tmp;
 
     ////////////////////////////////////////////////
-    if (link.GetAttributeFailSafe("MaxPackets", tmp)) {
+    if (link.GetAttributeFailSafe("MaxPackets", tmp) && tmp != lastMaxPackets) {
       NS_LOG_INFO("MaxPackets = " + link.GetAttribute("MaxPackets"));
+      lastMaxPackets = tmp;
 
       try {
         std::string maxPackets = link.GetAttribute("MaxPackets");
@@ -381,13 +783,15 @@ AnnotatedTopologyReader::ApplySettings()
       }
     }
 
-    if (link.GetAttributeFailSafe("DataRate", tmp)) {
+    if (link.GetAttributeFailSafe("DataRate", tmp) && tmp != lastDataRate) {
       NS_LOG_INFO("DataRate = " + link.GetAttribute("DataRate"));
+      lastDataRate = tmp;
       p2p.SetDeviceAttribute("DataRate", StringValue(link.GetAttribute("DataRate")));
     }
 
-    if (link.GetAttributeFailSafe("Delay", tmp)) {
+    if (link.GetAttributeFailSafe("Delay", tmp) && tmp != lastDelay) {
       NS_LOG_INFO("Delay = " + link.GetAttribute("Delay"));
+      lastDelay = tmp;
       p2p.SetChannelAttribute("Delay", StringValue(link.GetAttribute("Delay")));
     }
 
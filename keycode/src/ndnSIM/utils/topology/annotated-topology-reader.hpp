@@ -50,13 +50,35 @@ public:
   /**
    * \brief Main annotated topology reading function.
    *
-   * This method opens an input stream and reads topology file with annotations.
+   * This method maps the topology file with annotations into memory, or the binary topology
+   * written by ConvertToBinary(), and creates the nodes and links.  Lines of a large link section
+   * are parsed in parallel (see SetParsingThreads()).
    *
    * \return the container of the nodes created (or empty container if there was an error)
    */
   virtual NodeContainer
   Read();
 
+  /**
+   * \brief Set the number of threads parsing the link section of a text topology
+   * \param nThreads number of threads, or 0 for one per core (default)
+   */
+  void
+  SetParsingThreads(uint32_t nThreads);
+
+  /**
+   * \brief Convert a text topology into the binary topology format
+   *
+   * The binary topology holds the same nodes and links, with node names and link attributes
+   * stored once, and is loaded without parsing text.  No node is created by the conversion.
+   *
+   * Integers are written little-endian and coordinates as IEEE 754 doubles in the same byte
+   * order, whatever the host, so that a file converted on one machine is read correctly on
+   * any other.
+   */
+  static void
+  ConvertToBinary(const std::string& textFile, const std::string& binaryFile);
+
   /**
    * \brief Get nodes read by the reader
    */
@@ -141,6 +163,25 @@ private:
   AnnotatedTopologyReader&
   operator=(const AnnotatedTopologyReader&);
 
+  /// @cond include_hidden
+  struct ParsedTopology;
+  /// @endcond
+
+  static void
+  Parse(const std::string& file, uint32_t nThreads, ParsedTopology& topology);
+
+  static void
+  ParseText(uint32_t nThreads, ParsedTopology& topology);
+
+  static void
+  ParseBinary(ParsedTopology& topology);
+
+  /**
+   * \brief Create nodes, then links, of the parsed topology
+   */
+  void
+  Create(const ParsedTopology& topology);
+
   Ptr<UniformRandomVariable> m_randX;
   Ptr<UniformRandomVariable> m_randY;
 
@@ -148,6 +189,7 @@ private:
   double m_scale;
 
   uint32_t m_requiredPartitions;
+  uint32_t m_nParsingThreads;
 };
 }
 
@@ -0,0 +1,336 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-app-delay-quantile-tracer.hpp"
+#include "ns3/node.h"
+#include "ns3/config.h"
+#include "ns3/names.h"
+#include "ns3/callback.h"
+#include "ns3/string.h"
+
+#include "apps/ndn-app.hpp"
+#include "ns3/simulator.h"
+#include "ns3/log.h"
+
+#include <boost/lexical_cast.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+
+NS_LOG_COMPONENT_DEFINE("ndn.AppDelayQuantileTracer");
+
+namespace ns3 {
+namespace ndn {
+
+/// buckets for every power of two above 2 * SUB_BUCKETS, below which values are counted exactly
+static const uint64_t SUB_BUCKETS = 64;
+
+static std::list<std::tuple<shared_ptr<std::ostream>, std::list<Ptr<AppDelayQuantileTracer>>>>
+  g_tracers;
+
+void
+AppDelayQuantileTracer::Histogram::Record(uint64_t value)
+{
+  size_t index = GetIndex(value);
+  if (index >= m_buckets.size()) {
+    m_buckets.resize(index + 1, 0);
+  }
+  ++m_buckets[index];
+
+  if (m_count == 0 || value < m_min) {
+    m_min = value;
+  }
+  m_max = std::max(m_max, value);
+  m_sum += value;
+  ++m_count;
+}
+
+void
+AppDelayQuantileTracer::Histogram::Reset()
+{
+  std::fill(m_buckets.begin(), m_buckets.end(), 0);
+  m_count = 0;
+  m_sum = 0;
+  m_min = 0;
+  m_max = 0;
+}
+
+uint64_t
+AppDelayQuantileTracer::Histogram::GetQuantile(double quantile) const
+{
+  NS_ASSERT(m_count > 0);
+
+  uint64_t rank = static_cast<uint64_t>(std::ceil(quantile * m_count));
+  rank = std::min(std::max<uint64_t>(rank, 1), m_count);
+  if (rank == m_count) {
+    return m_max;
+  }
+
+  uint64_t seen = 0;
+  for (size_t index = 0; index < m_buckets.size(); ++index) {
+    seen += m_buckets[index];
+    if (seen >= rank) {
+      return std::min(std::max(GetValue(index), m_min), m_max);
+    }
+  }
+  return m_max;
+}
+
+size_t
+AppDelayQuantileTracer::Histogram::GetIndex(uint64_t value)
+{
+  if (value < 2 * SUB_BUCKETS) {
+    return value;
+  }
+
+  // keep the 7 most significant bits, i.e., 64 <= value >> shift < 128
+  size_t shift = 0;
+  while ((value >> shift) >= 2 * SUB_BUCKETS) {
+    ++shift;
+  }
+  return 2 * SUB_BUCKETS + (shift - 1) * SUB_BUCKETS + ((value >> shift) - SUB_BUCKETS);
+}
+
+uint64_t
+AppDelayQuantileTracer::Histogram::GetValue(size_t index)
+{
+  if (index < 2 * SUB_BUCKETS) {
+    return index;
+  }
+
+  size_t shift = (index - 2 * SUB_BUCKETS) / SUB_BUCKETS + 1;
+  uint64_t lowest = (SUB_BUCKETS + (index - 2 * SUB_BUCKETS) % SUB_BUCKETS) << shift;
+  return lowest + (uint64_t(1) << (shift - 1));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+void
+AppDelayQuantileTracer::Destroy()
+{
+  g_tracers.clear();
+}
+
+void
+AppDelayQuantileTracer::InstallAll(const std::string& file, Time averagingPeriod /* = Seconds(1.0)*/)
+{
+  Install(NodeContainer::GetGlobal(), file, averagingPeriod);
+}
+
+void
+AppDelayQuantileTracer::Install(const NodeContainer& nodes, const std::string& file,
+                                Time averagingPeriod /* = Seconds(1.0)*/)
+{
+  std::list<Ptr<AppDelayQuantileTracer>> tracers;
+  shared_ptr<std::ostream> outputStream;
+  if (file != "-") {
+    shared_ptr<std::ofstream> os(new std::ofstream());
+    os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
+
+    if (!os->is_open()) {
+      NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
+      return;
+    }
+
+    outputStream = os;
+  }
+  else {
+    outputStream = shared_ptr<std::ostream>(&std::cout, std::bind([]{}));
+  }
+
+  for (NodeContainer::Iterator node = nodes.Begin(); node != nodes.End(); node++) {
+    Ptr<AppDelayQuantileTracer> trace = Install(*node, outputStream, averagingPeriod);
+    tracers.push_back(trace);
+  }
+
+  if (tracers.size() > 0) {
+    tracers.front()->PrintHeader(*outputStream);
+    *outputStream << "\n";
+  }
+
+  g_tracers.push_back(std::make_tuple(outputStream, tracers));
+}
+
+void
+AppDelayQuantileTracer::Install(Ptr<Node> node, const std::string& file,
+                                Time averagingPeriod /* = Seconds(1.0)*/)
+{
+  Install(NodeContainer(node), file, averagingPeriod);
+}
+
+Ptr<AppDelayQuantileTracer>
+AppDelayQuantileTracer::Install(Ptr<Node> node, shared_ptr<std::ostream> outputStream,
+                                Time averagingPeriod /* = Seconds(1.0)*/)
+{
+  NS_LOG_DEBUG("Node: " << node->GetId());
+
+  Ptr<AppDelayQuantileTracer> trace = Create<AppDelayQuantileTracer>(outputStream, node);
+  trace->SetAveragingPeriod(averagingPeriod);
+
+  return trace;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+AppDelayQuantileTracer::AppDelayQuantileTracer(shared_ptr<std::ostream> os, Ptr<Node> node)
+  : m_nodePtr(node)
+  , m_os(os)
+{
+  m_node = boost::lexical_cast<std::string>(m_nodePtr->GetId());
+
+  Connect();
+
+  std::string name = Names::FindName(node);
+  if (!name.empty()) {
+    m_node = name;
+  }
+}
+
+AppDelayQuantileTracer::~AppDelayQuantileTracer()
+{
+  m_printEvent.Cancel();
+}
+
+void
+AppDelayQuantileTracer::Connect()
+{
+  Config::ConnectWithoutContextFailSafe("/NodeList/" + m_node + "/ApplicationList/*/LastRetransmittedInterestDataDelay",
+                                        MakeCallback(&AppDelayQuantileTracer::LastRetransmittedInterestDataDelay,
+                                                     this));
+
+  Config::ConnectWithoutContextFailSafe("/NodeList/" + m_node + "/ApplicationList/*/FirstInterestDataDelay",
+                                        MakeCallback(&AppDelayQuantileTracer::FirstInterestDataDelay,
+                                                     this));
+}
+
+void
+AppDelayQuantileTracer::SetAveragingPeriod(const Time& period)
+{
+  m_period = period;
+  m_printEvent.Cancel();
+  m_printEvent = Simulator::Schedule(m_period, &AppDelayQuantileTracer::PeriodicPrinter, this);
+}
+
+void
+AppDelayQuantileTracer::PeriodicPrinter()
+{
+  Print(*m_os);
+  Reset();
+
+  m_printEvent = Simulator::Schedule(m_period, &AppDelayQuantileTracer::PeriodicPrinter, this);
+}
+
+void
+AppDelayQuantileTracer::Reset()
+{
+  for (auto& stats : m_stats) {
+    stats.second.m_lastDelay.Reset();
+    stats.second.m_fullDelay.Reset();
+  }
+}
+
+void
+AppDelayQuantileTracer::PrintHeader(std::ostream& os) const
+{
+  os << "Time"
+     << "\t"
+     << "Node"
+     << "\t"
+     << "AppId"
+     << "\t"
+     << "Prefix"
+     << "\t"
+
+     << "Type"
+     << "\t"
+     << "Samples"
+     << "\t"
+     << "MinUS"
+     << "\t"
+     << "P50US"
+     << "\t"
+     << "P90US"
+     << "\t"
+     << "P99US"
+     << "\t"
+     << "MaxUS"
+     << "\t"
+     << "MeanUS"
+     << "";
+}
+
+void
+AppDelayQuantileTracer::Print(std::ostream& os) const
+{
+  double time = Simulator::Now().ToDouble(Time::S);
+
+  auto printRow = [&] (uint32_t appId, const AppStats& stats, const char* type,
+                       const Histogram& histogram) {
+    if (histogram.GetCount() == 0) {
+      return;
+    }
+
+    os << time << "\t" << m_node << "\t" << appId << "\t" << stats.m_prefix << "\t" << type
+       << "\t" << histogram.GetCount() << "\t" << histogram.GetMin() << "\t"
+       << histogram.GetQuantile(0.5) << "\t" << histogram.GetQuantile(0.9) << "\t"
+       << histogram.GetQuantile(0.99) << "\t" << histogram.GetMax() << "\t" << histogram.GetMean()
+       << "\n";
+  };
+
+  for (const auto& stats : m_stats) {
+    printRow(stats.first, stats.second, "LastDelay", stats.second.m_lastDelay);
+    printRow(stats.first, stats.second, "FullDelay", stats.second.m_fullDelay);
+  }
+}
+
+AppDelayQuantileTracer::AppStats&
+AppDelayQuantileTracer::GetStats(Ptr<App> app)
+{
+  auto stats = m_stats.find(app->GetId());
+  if (stats != m_stats.end()) {
+    return stats->second;
+  }
+
+  stats = m_stats.emplace(app->GetId(), AppStats()).first;
+  StringValue prefix;
+  stats->second.m_prefix = app->GetAttributeFailSafe("Prefix", prefix) ? prefix.Get() : "-";
+  return stats->second;
+}
+
+void
+AppDelayQuantileTracer::LastRetransmittedInterestDataDelay(Ptr<App> app, uint32_t seqno,
+                                                           Time delay, int32_t hopCount)
+{
+  GetStats(app).m_lastDelay.Record(delay.GetMicroSeconds());
+}
+
+void
+AppDelayQuantileTracer::FirstInterestDataDelay(Ptr<App> app, uint32_t seqno, Time delay,
+                                               uint32_t retxCount, int32_t hopCount)
+{
+  GetStats(app).m_fullDelay.Record(delay.GetMicroSeconds());
+}
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,263 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_APP_DELAY_QUANTILE_TRACER_H
+#define NDN_APP_DELAY_QUANTILE_TRACER_H
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include "ns3/ptr.h"
+#include "ns3/simple-ref-count.h"
+#include <ns3/nstime.h>
+#include <ns3/event-id.h>
+#include <ns3/node-container.h>
+
+#include <tuple>
+#include <map>
+#include <list>
+#include <vector>
+
+namespace ns3 {
+
+class Node;
+
+namespace ndn {
+
+class App;
+
+/**
+ * @ingroup ndn-tracers
+ * @brief Tracer to obtain per-period quantiles of application-level delays
+ *
+ * Instead of a row per received Data packet, as written by AppDelayTracer, the tracer writes
+ * for every application and every averaging period the number of samples and the minimum,
+ * median, 90th and 99th percentile, maximum, and mean of LastDelay and FullDelay.  Samples are
+ * accumulated in a Histogram, so that the memory of the tracer does not grow with the number of
+ * packets.
+ */
+class AppDelayQuantileTracer : public SimpleRefCount<AppDelayQuantileTracer> {
+public:
+  /**
+   * @brief Histogram of delays in microseconds with a bounded relative error
+   *
+   * Values below 128 are counted exactly.  Above, every power of two is split into 64 buckets
+   * of equal width, so that a quantile is off by less than 1% of its value, and the number of
+   * buckets depends only on the largest value recorded, not on the number of values.
+   */
+  class Histogram {
+  public:
+    void
+    Record(uint64_t value);
+
+    /**
+     * @brief Forget recorded values, keeping the buckets for the next period
+     */
+    void
+    Reset();
+
+    uint64_t
+    GetCount() const
+    {
+      return m_count;
+    }
+
+    uint64_t
+    GetMin() const
+    {
+      return m_min;
+    }
+
+    uint64_t
+    GetMax() const
+    {
+      return m_max;
+    }
+
+    double
+    GetMean() const
+    {
+      return m_count > 0 ? static_cast<double>(m_sum) / m_count : 0.0;
+    }
+
+    /**
+     * @brief Get the smallest value such that a @p quantile fraction of values is not larger
+     * @param quantile fraction between 0 and 1
+     * @pre GetCount() > 0
+     */
+    uint64_t
+    GetQuantile(double quantile) const;
+
+    /**
+     * @brief Number of buckets currently allocated
+     */
+    size_t
+    GetBucketCount() const
+    {
+      return m_buckets.size();
+    }
+
+  private:
+    static size_t
+    GetIndex(uint64_t value);
+
+    /**
+     * @brief Representative value of the bucket: its middle
+     */
+    static uint64_t
+    GetValue(size_t index);
+
+  private:
+    std::vector<uint32_t> m_buckets;
+    uint64_t m_count = 0;
+    uint64_t m_sum = 0;
+    uint64_t m_min = 0;
+    uint64_t m_max = 0;
+  };
+
+  /**
+   * @brief Helper method to install tracers on all simulation nodes
+   *
+   * @param file File to which traces will be written.  If filename is -, then std::out is used
+   * @param averagingPeriod How often quantiles will be written into the trace file (default,
+   *        every second)
+   */
+  static void
+  InstallAll(const std::string& file, Time averagingPeriod = Seconds(1.0));
+
+  /**
+   * @brief Helper method to install tracers on the selected simulation nodes
+   *
+   * @param nodes Nodes on which to install tracer
+   * @param file File to which traces will be written.  If filename is -, then std::out is used
+   * @param averagingPeriod How often quantiles will be written into the trace file (default,
+   *        every second)
+   */
+  static void
+  Install(const NodeContainer& nodes, const std::string& file,
+          Time averagingPeriod = Seconds(1.0));
+
+  /**
+   * @brief Helper method to install tracers on a specific simulation node
+   *
+   * @param node Node on which to install tracer
+   * @param file File to which traces will be written.  If filename is -, then std::out is used
+   * @param averagingPeriod How often quantiles will be written into the trace file (default,
+   *        every second)
+   */
+  static void
+  Install(Ptr<Node> node, const std::string& file, Time averagingPeriod = Seconds(1.0));
+
+  /**
+   * @brief Helper method to install tracers on a specific simulation node
+   *
+   * @param node Node on which to install tracer
+   * @param outputStream Smart pointer to a stream
+   * @param averagingPeriod How often quantiles will be written into the trace file (default,
+   *        every second)
+   *
+   * @returns the tracer, which needs to be preserved for the lifetime of simulation
+   */
+  static Ptr<AppDelayQuantileTracer>
+  Install(Ptr<Node> node, shared_ptr<std::ostream> outputStream,
+          Time averagingPeriod = Seconds(1.0));
+
+  /**
+   * @brief Explicit request to remove all statically created tracers
+   *
+   * This method can be helpful if simulation scenario contains several independent run,
+   * or if it is desired to do a postprocessing of the resulting data
+   */
+  static void
+  Destroy();
+
+  /**
+   * @brief Trace constructor that attaches to all applications on the node using node's pointer
+   * @param os    reference to the output stream
+   * @param node  pointer to the node
+   */
+  AppDelayQuantileTracer(shared_ptr<std::ostream> os, Ptr<Node> node);
+
+  /**
+   * @brief Destructor
+   */
+  ~AppDelayQuantileTracer();
+
+  /**
+   * @brief Print head of the trace (e.g., for post-processing)
+   *
+   * @param os reference to output stream
+   */
+  void
+  PrintHeader(std::ostream& os) const;
+
+  /**
+   * @brief Print quantiles of the current period
+   *
+   * @param os reference to output stream
+   */
+  void
+  Print(std::ostream& os) const;
+
+private:
+  void
+  Connect();
+
+  void
+  LastRetransmittedInterestDataDelay(Ptr<App> app, uint32_t seqno, Time delay, int32_t hopCount);
+
+  void
+  FirstInterestDataDelay(Ptr<App> app, uint32_t seqno, Time delay, uint32_t rextCount,
+                         int32_t hopCount);
+
+  void
+  SetAveragingPeriod(const Time& period);
+
+  void
+  Reset();
+
+  void
+  PeriodicPrinter();
+
+private:
+  /// @cond include_hidden
+  struct AppStats {
+    std::string m_prefix;
+    Histogram m_lastDelay;
+    Histogram m_fullDelay;
+  };
+  /// @endcond
+
+  AppStats&
+  GetStats(Ptr<App> app);
+
+private:
+  std::string m_node;
+  Ptr<Node> m_nodePtr;
+
+  shared_ptr<std::ostream> m_os;
+
+  Time m_period;
+  EventId m_printEvent;
+  std::map<uint32_t, AppStats> m_stats; ///< @brief statistics of every application, by its ID
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_APP_DELAY_QUANTILE_TRACER_H
@@ -33,12 +33,15 @@
 #include <boost/make_shared.hpp>
 
 #include <fstream>
+#include <sstream>
 
 NS_LOG_COMPONENT_DEFINE("ndn.AppDelayTracer");
 
 namespace ns3 {
 namespace ndn {
 
+using Column = BinaryTraceSink::Column;
+
 static std::list<std::tuple<shared_ptr<std::ostream>, std::list<Ptr<AppDelayTracer>>>>
   g_tracers;
 
@@ -51,38 +54,7 @@ AppDelayTracer::Destroy()
 void
 AppDelayTracer::InstallAll(const std::string& file)
 {
-  using namespace boost;
-  using namespace std;
-
-  std::list<Ptr<AppDelayTracer>> tracers;
-  shared_ptr<std::ostream> outputStream;
-  if (file != "-") {
-    shared_ptr<std::ofstream> os(new std::ofstream());
-    os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
-
-    if (!os->is_open()) {
-      NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
-      return;
-    }
-
-    outputStream = os;
-  }
-  else {
-    outputStream = shared_ptr<std::ostream>(&std::cout, std::bind([]{}));
-  }
-
-  for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
-    Ptr<AppDelayTracer> trace = Install(*node, outputStream);
-    tracers.push_back(trace);
-  }
-
-  if (tracers.size() > 0) {
-    // *m_l3RateTrace << "# "; // not necessary for R's read.table
-    tracers.front()->PrintHeader(*outputStream);
-    *outputStream << "\n";
-  }
-
-  g_tracers.push_back(std::make_tuple(outputStream, tracers));
+  Install(NodeContainer::GetGlobal(), file);
 }
 
 void
@@ -93,7 +65,14 @@ AppDelayTracer::Install(const NodeContainer& nodes, const std::string& file)
 
   std::list<Ptr<AppDelayTracer>> tracers;
   shared_ptr<std::ostream> outputStream;
-  if (file != "-") {
+  shared_ptr<BinaryTraceSink> sink;
+  if (BinaryTraceSink::IsBinaryFile(file)) {
+    sink = BinaryTraceSink::Open(file);
+    if (sink == nullptr) {
+      return;
+    }
+  }
+  else if (file != "-") {
     shared_ptr<std::ofstream> os(new std::ofstream());
     os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
 
@@ -109,14 +88,23 @@ AppDelayTracer::Install(const NodeContainer& nodes, const std::string& file)
   }
 
   for (NodeContainer::Iterator node = nodes.Begin(); node != nodes.End(); node++) {
-    Ptr<AppDelayTracer> trace = Install(*node, outputStream);
+    Ptr<AppDelayTracer> trace = sink != nullptr ? Install(*node, sink) : Install(*node, outputStream);
     tracers.push_back(trace);
   }
 
   if (tracers.size() > 0) {
-    // *m_l3RateTrace << "# "; // not necessary for R's read.table
-    tracers.front()->PrintHeader(*outputStream);
-    *outputStream << "\n";
+    if (sink != nullptr) {
+      std::ostringstream header;
+      tracers.front()->PrintHeader(header);
+      sink->Start(header.str(), {Column::DOUBLE, Column::STRING, Column::UINT32, Column::UINT32,
+                                 Column::STRING, Column::DOUBLE, Column::DOUBLE, Column::UINT32,
+                                 Column::INT32});
+    }
+    else {
+      // *m_l3RateTrace << "# "; // not necessary for R's read.table
+      tracers.front()->PrintHeader(*outputStream);
+      *outputStream << "\n";
+    }
   }
 
   g_tracers.push_back(std::make_tuple(outputStream, tracers));
@@ -125,44 +113,25 @@ AppDelayTracer::Install(const NodeContainer& nodes, const std::string& file)
 void
 AppDelayTracer::Install(Ptr<Node> node, const std::string& file)
 {
-  using namespace boost;
-  using namespace std;
-
-  std::list<Ptr<AppDelayTracer>> tracers;
-  shared_ptr<std::ostream> outputStream;
-  if (file != "-") {
-    shared_ptr<std::ofstream> os(new std::ofstream());
-    os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
-
-    if (!os->is_open()) {
-      NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
-      return;
-    }
-
-    outputStream = os;
-  }
-  else {
-    outputStream = shared_ptr<std::ostream>(&std::cout, std::bind([]{}));
-  }
+  Install(NodeContainer(node), file);
+}
 
-  Ptr<AppDelayTracer> trace = Install(node, outputStream);
-  tracers.push_back(trace);
+Ptr<AppDelayTracer>
+AppDelayTracer::Install(Ptr<Node> node, shared_ptr<std::ostream> outputStream)
+{
+  NS_LOG_DEBUG("Node: " << node->GetId());
 
-  if (tracers.size() > 0) {
-    // *m_l3RateTrace << "# "; // not necessary for R's read.table
-    tracers.front()->PrintHeader(*outputStream);
-    *outputStream << "\n";
-  }
+  Ptr<AppDelayTracer> trace = Create<AppDelayTracer>(outputStream, node);
 
-  g_tracers.push_back(std::make_tuple(outputStream, tracers));
+  return trace;
 }
 
 Ptr<AppDelayTracer>
-AppDelayTracer::Install(Ptr<Node> node, shared_ptr<std::ostream> outputStream)
+AppDelayTracer::Install(Ptr<Node> node, shared_ptr<BinaryTraceSink> sink)
 {
   NS_LOG_DEBUG("Node: " << node->GetId());
 
-  Ptr<AppDelayTracer> trace = Create<AppDelayTracer>(outputStream, node);
+  Ptr<AppDelayTracer> trace = Create<AppDelayTracer>(sink, node);
 
   return trace;
 }
@@ -185,6 +154,12 @@ AppDelayTracer::AppDelayTracer(shared_ptr<std::ostream> os, Ptr<Node> node)
   }
 }
 
+AppDelayTracer::AppDelayTracer(shared_ptr<BinaryTraceSink> sink, Ptr<Node> node)
+  : AppDelayTracer(shared_ptr<std::ostream>(), node)
+{
+  m_sink = sink;
+}
+
 AppDelayTracer::AppDelayTracer(shared_ptr<std::ostream> os, const std::string& node)
   : m_node(node)
   , m_os(os)
@@ -233,6 +208,13 @@ void
 AppDelayTracer::LastRetransmittedInterestDataDelay(Ptr<App> app, uint32_t seqno, Time delay,
                                                    int32_t hopCount)
 {
+  if (m_sink != nullptr) {
+    m_sink->Write(Simulator::Now().ToDouble(Time::S), m_node, app->GetId(), seqno, "LastDelay",
+                  delay.ToDouble(Time::S), delay.ToDouble(Time::US), static_cast<uint32_t>(1),
+                  hopCount);
+    return;
+  }
+
   *m_os << Simulator::Now().ToDouble(Time::S) << "\t" << m_node << "\t" << app->GetId() << "\t"
         << seqno << "\t"
         << "LastDelay"
@@ -244,6 +226,12 @@ void
 AppDelayTracer::FirstInterestDataDelay(Ptr<App> app, uint32_t seqno, Time delay, uint32_t retxCount,
                                        int32_t hopCount)
 {
+  if (m_sink != nullptr) {
+    m_sink->Write(Simulator::Now().ToDouble(Time::S), m_node, app->GetId(), seqno, "FullDelay",
+                  delay.ToDouble(Time::S), delay.ToDouble(Time::US), retxCount, hopCount);
+    return;
+  }
+
   *m_os << Simulator::Now().ToDouble(Time::S) << "\t" << m_node << "\t" << app->GetId() << "\t"
         << seqno << "\t"
         << "FullDelay"
@@ -22,6 +22,8 @@
 
 #include "ns3/ndnSIM/model/ndn-common.hpp"
 
+#include "ndn-binary-trace-sink.hpp"
+
 #include "ns3/ptr.h"
 #include "ns3/simple-ref-count.h"
 #include <ns3/nstime.h>
@@ -49,7 +51,8 @@ public:
   /**
    * @brief Helper method to install tracers on all simulation nodes
    *
-   * @param file File to which traces will be written.  If filename is -, then std::out is used
+   * @param file File to which traces will be written.  If filename is -, then std::out is used.
+   *             If filename ends with .bin or .bin.gz, the trace is written by BinaryTraceSink
    *
    */
   static void
@@ -59,7 +62,8 @@ public:
    * @brief Helper method to install tracers on the selected simulation nodes
    *
    * @param nodes Nodes on which to install tracer
-   * @param file File to which traces will be written.  If filename is -, then std::out is used
+   * @param file File to which traces will be written.  If filename is -, then std::out is used.
+   *             If filename ends with .bin or .bin.gz, the trace is written by BinaryTraceSink
    *
    */
   static void
@@ -69,7 +73,8 @@ public:
    * @brief Helper method to install tracers on a specific simulation node
    *
    * @param nodes Nodes on which to install tracer
-   * @param file File to which traces will be written.  If filename is -, then std::out is used
+   * @param file File to which traces will be written.  If filename is -, then std::out is used.
+   *             If filename ends with .bin or .bin.gz, the trace is written by BinaryTraceSink
    * @param averagingPeriod How often data will be written into the trace file (default, every half
    *        second)
    */
@@ -91,6 +96,12 @@ public:
   static Ptr<AppDelayTracer>
   Install(Ptr<Node> node, shared_ptr<std::ostream> outputStream);
 
+  /**
+   * @brief Helper method to install a tracer writing to a binary sink on a specific node
+   */
+  static Ptr<AppDelayTracer>
+  Install(Ptr<Node> node, shared_ptr<BinaryTraceSink> sink);
+
   /**
    * @brief Explicit request to remove all statically created tracers
    *
@@ -114,6 +125,13 @@ public:
    */
   AppDelayTracer(shared_ptr<std::ostream> os, const std::string& node);
 
+  /**
+   * @brief Trace constructor that attaches to all applications on the node using node's pointer
+   * @param sink  binary sink, which must be started by the caller
+   * @param node  pointer to the node
+   */
+  AppDelayTracer(shared_ptr<BinaryTraceSink> sink, Ptr<Node> node);
+
   /**
    * @brief Destructor
    */
@@ -143,6 +161,7 @@ private:
   Ptr<Node> m_nodePtr;
 
   shared_ptr<std::ostream> m_os;
+  shared_ptr<BinaryTraceSink> m_sink;
 };
 
 } // namespace ndn
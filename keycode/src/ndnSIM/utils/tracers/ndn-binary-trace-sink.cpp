@@ -0,0 +1,290 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-binary-trace-sink.hpp"
+
+#include "ns3/log.h"
+
+#include <algorithm>
+
+#include <boost/algorithm/string/predicate.hpp>
+#include <boost/iostreams/device/file.hpp>
+#include <boost/iostreams/filter/gzip.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
+
+NS_LOG_COMPONENT_DEFINE("ndn.BinaryTraceSink");
+
+namespace ns3 {
+namespace ndn {
+
+static const char MAGIC[] = {'N', 'D', 'N', 'S', 'I', 'M', 'T', 'R'};
+static const uint32_t VERSION = 1;
+
+template<class T>
+static void
+appendRaw(std::vector<uint8_t>& buffer, T value)
+{
+  size_t offset = buffer.size();
+  buffer.resize(offset + sizeof(value));
+  std::memcpy(buffer.data() + offset, &value, sizeof(value));
+}
+
+static void
+appendString(std::vector<uint8_t>& buffer, const std::string& value)
+{
+  appendRaw(buffer, static_cast<uint32_t>(value.size()));
+  buffer.insert(buffer.end(), value.begin(), value.end());
+}
+
+bool
+BinaryTraceSink::IsBinaryFile(const std::string& file)
+{
+  return boost::algorithm::ends_with(file, ".bin") || boost::algorithm::ends_with(file, ".bin.gz");
+}
+
+shared_ptr<BinaryTraceSink>
+BinaryTraceSink::Open(const std::string& file)
+{
+  try {
+    return make_shared<BinaryTraceSink>(file, boost::algorithm::ends_with(file, ".gz"));
+  }
+  catch (const Error& e) {
+    NS_LOG_ERROR(e.what() << ". Tracing disabled");
+    return nullptr;
+  }
+}
+
+BinaryTraceSink::BinaryTraceSink(const std::string& file, bool isCompressed)
+{
+  boost::iostreams::file_sink sink(file, std::ios_base::out | std::ios_base::trunc |
+                                           std::ios_base::binary);
+  if (!sink.is_open()) {
+    throw Error("File " + file + " cannot be opened for writing");
+  }
+
+  auto os = make_shared<boost::iostreams::filtering_ostream>();
+  if (isCompressed) {
+    // the fastest level, so that compression keeps up with the simulation
+    os->push(boost::iostreams::gzip_compressor(boost::iostreams::zlib::best_speed));
+  }
+  os->push(sink);
+  m_os = os;
+
+  m_records.reserve(CHUNK_SIZE + 1024);
+  m_thread = std::thread(&BinaryTraceSink::Run, this);
+}
+
+BinaryTraceSink::~BinaryTraceSink()
+{
+  Flush();
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_isStopped = true;
+  }
+  m_cv.notify_all();
+  m_thread.join();
+
+  // closes the compressor as well, which then writes the end of the stream
+  m_os.reset();
+}
+
+void
+BinaryTraceSink::Start(const std::string& header, std::vector<Column> columns)
+{
+  NS_ASSERT_MSG(m_columns.empty(), "The sink is already started");
+  m_columns = std::move(columns);
+
+  std::vector<uint8_t> chunk(std::begin(MAGIC), std::end(MAGIC));
+  appendRaw(chunk, VERSION);
+  appendString(chunk, header);
+  appendRaw(chunk, static_cast<uint32_t>(m_columns.size()));
+  for (Column column : m_columns) {
+    appendRaw(chunk, static_cast<uint8_t>(column));
+  }
+  Enqueue(std::move(chunk));
+}
+
+void
+BinaryTraceSink::Append(const std::string& value)
+{
+  auto id = m_stringIds.emplace(value, m_stringIds.size());
+  if (id.second) {
+    appendString(m_strings, value);
+    ++m_nStrings;
+  }
+  AppendValue(Column::STRING, id.first->second);
+}
+
+void
+BinaryTraceSink::Append(const char* value)
+{
+  auto id = m_literalIds.find(value);
+  if (id == m_literalIds.end()) {
+    Append(std::string(value));
+    m_literalIds.emplace(value, m_stringIds.at(value));
+    return;
+  }
+  AppendValue(Column::STRING, id->second);
+}
+
+void
+BinaryTraceSink::Flush()
+{
+  if (m_nRecords == 0) {
+    return;
+  }
+
+  std::vector<uint8_t> chunk;
+  chunk.reserve(2 * sizeof(uint32_t) + m_strings.size() + m_records.size());
+  appendRaw(chunk, m_nStrings);
+  appendRaw(chunk, m_nRecords);
+  chunk.insert(chunk.end(), m_strings.begin(), m_strings.end());
+  chunk.insert(chunk.end(), m_records.begin(), m_records.end());
+  Enqueue(std::move(chunk));
+
+  m_strings.clear();
+  m_nStrings = 0;
+  m_records.clear();
+  m_nRecords = 0;
+}
+
+void
+BinaryTraceSink::Enqueue(std::vector<uint8_t>&& chunk)
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  // the simulation waits only if the disk cannot keep up
+  m_cv.wait(lock, [this] { return m_chunks.size() < MAX_QUEUED_CHUNKS; });
+  m_chunks.push_back(std::move(chunk));
+  lock.unlock();
+  m_cv.notify_all();
+}
+
+void
+BinaryTraceSink::Run()
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  while (true) {
+    m_cv.wait(lock, [this] { return !m_chunks.empty() || m_isStopped; });
+    if (m_chunks.empty()) {
+      break;
+    }
+
+    std::vector<uint8_t> chunk = std::move(m_chunks.front());
+    m_chunks.pop_front();
+    lock.unlock();
+    m_cv.notify_all();
+
+    m_os->write(reinterpret_cast<const char*>(chunk.data()), chunk.size());
+
+    lock.lock();
+  }
+  m_os->flush();
+}
+
+template<class T>
+static T
+readRaw(std::istream& is)
+{
+  T value;
+  if (!is.read(reinterpret_cast<char*>(&value), sizeof(value))) {
+    throw BinaryTraceSink::Error("Trace is truncated");
+  }
+  return value;
+}
+
+static std::string
+readString(std::istream& is)
+{
+  std::string value(readRaw<uint32_t>(is), '\0');
+  if (!is.read(&value[0], value.size())) {
+    throw BinaryTraceSink::Error("Trace is truncated");
+  }
+  return value;
+}
+
+void
+BinaryTraceSink::ConvertToTsv(std::istream& is, std::ostream& os)
+{
+  boost::iostreams::filtering_istream in;
+  if (is.peek() == 0x1f) { // first byte of a gzip stream
+    in.push(boost::iostreams::gzip_decompressor());
+  }
+  in.push(is);
+
+  char magic[sizeof(MAGIC)];
+  if (!in.read(magic, sizeof(magic)) || !std::equal(std::begin(MAGIC), std::end(MAGIC), magic)) {
+    throw Error("Not an ndnSIM binary trace");
+  }
+  if (readRaw<uint32_t>(in) != VERSION) {
+    throw Error("Unsupported version of ndnSIM binary trace");
+  }
+
+  os << readString(in) << "\n";
+
+  std::vector<Column> columns(readRaw<uint32_t>(in));
+  for (Column& column : columns) {
+    column = static_cast<Column>(readRaw<uint8_t>(in));
+    if (column < Column::DOUBLE || column > Column::STRING) {
+      throw Error("Unknown column type " + std::to_string(static_cast<int>(column)));
+    }
+  }
+
+  std::vector<std::string> strings;
+  while (in.peek() != std::char_traits<char>::eof()) {
+    uint32_t nStrings = readRaw<uint32_t>(in);
+    uint32_t nRecords = readRaw<uint32_t>(in);
+    for (uint32_t i = 0; i < nStrings; i++) {
+      strings.push_back(readString(in));
+    }
+
+    for (uint32_t i = 0; i < nRecords; i++) {
+      for (size_t j = 0; j < columns.size(); j++) {
+        if (j > 0) {
+          os << "\t";
+        }
+        switch (columns[j]) {
+        case Column::DOUBLE:
+          os << readRaw<double>(in);
+          break;
+        case Column::INT64:
+          os << readRaw<int64_t>(in);
+          break;
+        case Column::UINT32:
+          os << readRaw<uint32_t>(in);
+          break;
+        case Column::INT32:
+          os << readRaw<int32_t>(in);
+          break;
+        case Column::STRING: {
+          uint32_t id = readRaw<uint32_t>(in);
+          if (id >= strings.size()) {
+            throw Error("Unknown string " + std::to_string(id));
+          }
+          os << strings[id];
+          break;
+        }
+        }
+      }
+      os << "\n";
+    }
+  }
+}
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,214 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_BINARY_TRACE_SINK_H
+#define NDN_BINARY_TRACE_SINK_H
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include "ns3/assert.h"
+
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn-tracers
+ * @brief Binary output of the tracers, written by a background thread
+ *
+ * Every row of a trace is a fixed-width record of typed columns; strings, e.g. node names and
+ * face descriptions, are stored once and referred to by index.  Records are buffered and
+ * handed in chunks to a thread that writes them, optionally gzip-compressed, so that the
+ * simulation does not wait for the formatting of text nor for the disk.
+ *
+ * The tracers use this sink when the name of their trace file ends with ".bin", or with
+ * ".bin.gz" for the compressed variant.  ConvertToTsv() turns the file into the tab-separated
+ * values that the tracer would have written.
+ *
+ * File layout, in host byte order: the magic "NDNSIMTR", uint32 version, uint32 length and text
+ * of the header row, uint32 number and uint8 types of the columns, then chunks made of uint32
+ * number of new strings, uint32 number of records, the new strings (uint32 length and text
+ * each), and the records.
+ */
+class BinaryTraceSink : boost::noncopyable {
+public:
+  class Error : public std::runtime_error {
+  public:
+    using std::runtime_error::runtime_error;
+  };
+
+  enum class Column : uint8_t {
+    DOUBLE = 1,
+    INT64 = 2,
+    UINT32 = 3,
+    INT32 = 4,
+    STRING = 5 ///< index of a string of the file
+  };
+
+  /**
+   * @brief Whether tracers write @p file with a BinaryTraceSink
+   */
+  static bool
+  IsBinaryFile(const std::string& file);
+
+  /**
+   * @brief Open @p file for writing, compressed if its name ends with ".gz"
+   * @return nullptr if the file cannot be opened
+   */
+  static shared_ptr<BinaryTraceSink>
+  Open(const std::string& file);
+
+  /**
+   * @brief Convert the binary trace in @p is, compressed or not, to tab-separated values
+   * @throw Error the trace is malformed or truncated
+   */
+  static void
+  ConvertToTsv(std::istream& is, std::ostream& os);
+
+  /**
+   * @brief Open @p file for writing
+   * @throw Error the file cannot be opened
+   */
+  BinaryTraceSink(const std::string& file, bool isCompressed);
+
+  /**
+   * @brief Write the remaining records and wait for the background thread
+   */
+  ~BinaryTraceSink();
+
+  /**
+   * @brief Describe the records, must be called once before the first Write()
+   * @param header header row of the text trace, e.g., as written by PrintHeader of the tracer
+   */
+  void
+  Start(const std::string& header, std::vector<Column> columns);
+
+  /**
+   * @brief Write one record
+   *
+   * Values are double, int64_t, uint32_t, int32_t, std::string or string literals, in the order
+   * and of the types of the columns.
+   */
+  template<class... Values>
+  void
+  Write(const Values&... values)
+  {
+    NS_ASSERT_MSG(sizeof...(Values) == m_columns.size(), "Record does not match the columns");
+    m_column = 0;
+    int expand[] = {0, (Append(values), 0)...};
+    (void)expand;
+
+    ++m_nRecords;
+    if (m_records.size() >= CHUNK_SIZE) {
+      Flush();
+    }
+  }
+
+private:
+  void
+  Append(double value)
+  {
+    AppendValue(Column::DOUBLE, value);
+  }
+
+  void
+  Append(int64_t value)
+  {
+    AppendValue(Column::INT64, value);
+  }
+
+  void
+  Append(uint32_t value)
+  {
+    AppendValue(Column::UINT32, value);
+  }
+
+  void
+  Append(int32_t value)
+  {
+    AppendValue(Column::INT32, value);
+  }
+
+  void
+  Append(const std::string& value);
+
+  /**
+   * @brief Append a string literal, looked up by its address
+   */
+  void
+  Append(const char* value);
+
+  template<class T>
+  void
+  AppendValue(Column column, T value)
+  {
+    NS_ASSERT_MSG(m_columns.at(m_column) == column, "Column " << m_column << " has another type");
+    ++m_column;
+
+    size_t offset = m_records.size();
+    m_records.resize(offset + sizeof(value));
+    std::memcpy(m_records.data() + offset, &value, sizeof(value));
+  }
+
+  /**
+   * @brief Hand the buffered strings and records to the background thread
+   */
+  void
+  Flush();
+
+  void
+  Enqueue(std::vector<uint8_t>&& chunk);
+
+  void
+  Run();
+
+private:
+  static const size_t CHUNK_SIZE = 256 * 1024;
+  static const size_t MAX_QUEUED_CHUNKS = 16;
+
+  std::vector<Column> m_columns;
+  size_t m_column = 0;
+
+  std::unordered_map<std::string, uint32_t> m_stringIds;
+  std::unordered_map<const char*, uint32_t> m_literalIds;
+  std::vector<uint8_t> m_strings; ///< strings not yet written
+  uint32_t m_nStrings = 0;
+  std::vector<uint8_t> m_records; ///< records not yet written
+  uint32_t m_nRecords = 0;
+
+  shared_ptr<std::ostream> m_os;
+  std::thread m_thread;
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+  std::deque<std::vector<uint8_t>> m_chunks;
+  bool m_isStopped = false;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_BINARY_TRACE_SINK_H
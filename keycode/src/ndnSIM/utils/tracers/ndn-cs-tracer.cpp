@@ -32,12 +32,15 @@
 #include <boost/lexical_cast.hpp>
 
 #include <fstream>
+#include <sstream>
 
 NS_LOG_COMPONENT_DEFINE("ndn.CsTracer");
 
 namespace ns3 {
 namespace ndn {
 
+using Column = BinaryTraceSink::Column;
+
 static std::list<std::tuple<shared_ptr<std::ostream>, std::list<Ptr<CsTracer>>>> g_tracers;
 
 void
@@ -49,38 +52,7 @@ CsTracer::Destroy()
 void
 CsTracer::InstallAll(const std::string& file, Time averagingPeriod /* = Seconds (0.5)*/)
 {
-  using namespace boost;
-  using namespace std;
-
-  std::list<Ptr<CsTracer>> tracers;
-  shared_ptr<std::ostream> outputStream;
-  if (file != "-") {
-    shared_ptr<std::ofstream> os(new std::ofstream());
-    os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
-
-    if (!os->is_open()) {
-      NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
-      return;
-    }
-
-    outputStream = os;
-  }
-  else {
-    outputStream = shared_ptr<std::ostream>(&std::cout, std::bind([]{}));
-  }
-
-  for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
-    Ptr<CsTracer> trace = Install(*node, outputStream, averagingPeriod);
-    tracers.push_back(trace);
-  }
-
-  if (tracers.size() > 0) {
-    // *m_l3RateTrace << "# "; // not necessary for R's read.table
-    tracers.front()->PrintHeader(*outputStream);
-    *outputStream << "\n";
-  }
-
-  g_tracers.push_back(std::make_tuple(outputStream, tracers));
+  Install(NodeContainer::GetGlobal(), file, averagingPeriod);
 }
 
 void
@@ -92,7 +64,14 @@ CsTracer::Install(const NodeContainer& nodes, const std::string& file,
 
   std::list<Ptr<CsTracer>> tracers;
   shared_ptr<std::ostream> outputStream;
-  if (file != "-") {
+  shared_ptr<BinaryTraceSink> sink;
+  if (BinaryTraceSink::IsBinaryFile(file)) {
+    sink = BinaryTraceSink::Open(file);
+    if (sink == nullptr) {
+      return;
+    }
+  }
+  else if (file != "-") {
     shared_ptr<std::ofstream> os(new std::ofstream());
     os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
 
@@ -108,14 +87,22 @@ CsTracer::Install(const NodeContainer& nodes, const std::string& file,
   }
 
   for (NodeContainer::Iterator node = nodes.Begin(); node != nodes.End(); node++) {
-    Ptr<CsTracer> trace = Install(*node, outputStream, averagingPeriod);
+    Ptr<CsTracer> trace = sink != nullptr ? Install(*node, sink, averagingPeriod)
+                                          : Install(*node, outputStream, averagingPeriod);
     tracers.push_back(trace);
   }
 
   if (tracers.size() > 0) {
-    // *m_l3RateTrace << "# "; // not necessary for R's read.table
-    tracers.front()->PrintHeader(*outputStream);
-    *outputStream << "\n";
+    if (sink != nullptr) {
+      std::ostringstream header;
+      tracers.front()->PrintHeader(header);
+      sink->Start(header.str(), {Column::DOUBLE, Column::STRING, Column::STRING, Column::DOUBLE});
+    }
+    else {
+      // *m_l3RateTrace << "# "; // not necessary for R's read.table
+      tracers.front()->PrintHeader(*outputStream);
+      *outputStream << "\n";
+    }
   }
 
   g_tracers.push_back(std::make_tuple(outputStream, tracers));
@@ -125,45 +112,28 @@ void
 CsTracer::Install(Ptr<Node> node, const std::string& file,
                   Time averagingPeriod /* = Seconds (0.5)*/)
 {
-  using namespace boost;
-  using namespace std;
-
-  std::list<Ptr<CsTracer>> tracers;
-  shared_ptr<std::ostream> outputStream;
-  if (file != "-") {
-    shared_ptr<std::ofstream> os(new std::ofstream());
-    os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
-
-    if (!os->is_open()) {
-      NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
-      return;
-    }
-
-    outputStream = os;
-  }
-  else {
-    outputStream = shared_ptr<std::ostream>(&std::cout, std::bind([]{}));
-  }
+  Install(NodeContainer(node), file, averagingPeriod);
+}
 
-  Ptr<CsTracer> trace = Install(node, outputStream, averagingPeriod);
-  tracers.push_back(trace);
+Ptr<CsTracer>
+CsTracer::Install(Ptr<Node> node, shared_ptr<std::ostream> outputStream,
+                  Time averagingPeriod /* = Seconds (0.5)*/)
+{
+  NS_LOG_DEBUG("Node: " << node->GetId());
 
-  if (tracers.size() > 0) {
-    // *m_l3RateTrace << "# "; // not necessary for R's read.table
-    tracers.front()->PrintHeader(*outputStream);
-    *outputStream << "\n";
-  }
+  Ptr<CsTracer> trace = Create<CsTracer>(outputStream, node);
+  trace->SetAveragingPeriod(averagingPeriod);
 
-  g_tracers.push_back(std::make_tuple(outputStream, tracers));
+  return trace;
 }
 
 Ptr<CsTracer>
-CsTracer::Install(Ptr<Node> node, shared_ptr<std::ostream> outputStream,
+CsTracer::Install(Ptr<Node> node, shared_ptr<BinaryTraceSink> sink,
                   Time averagingPeriod /* = Seconds (0.5)*/)
 {
   NS_LOG_DEBUG("Node: " << node->GetId());
 
-  Ptr<CsTracer> trace = Create<CsTracer>(outputStream, node);
+  Ptr<CsTracer> trace = Create<CsTracer>(sink, node);
   trace->SetAveragingPeriod(averagingPeriod);
 
   return trace;
@@ -187,6 +157,12 @@ CsTracer::CsTracer(shared_ptr<std::ostream> os, Ptr<Node> node)
   }
 }
 
+CsTracer::CsTracer(shared_ptr<BinaryTraceSink> sink, Ptr<Node> node)
+  : CsTracer(shared_ptr<std::ostream>(), node)
+{
+  m_sink = sink;
+}
+
 CsTracer::CsTracer(shared_ptr<std::ostream> os, const std::string& node)
   : m_node(node)
   , m_os(os)
@@ -218,7 +194,12 @@ CsTracer::SetAveragingPeriod(const Time& period)
 void
 CsTracer::PeriodicPrinter()
 {
-  Print(*m_os);
+  if (m_sink != nullptr) {
+    Write(*m_sink);
+  }
+  else {
+    Print(*m_os);
+  }
   Reset();
 
   m_printEvent = Simulator::Schedule(m_period, &CsTracer::PeriodicPrinter, this);
@@ -258,6 +239,15 @@ CsTracer::Print(std::ostream& os) const
   PRINTER("CacheMisses", m_cacheMisses);
 }
 
+void
+CsTracer::Write(BinaryTraceSink& sink) const
+{
+  double time = Simulator::Now().ToDouble(Time::S);
+
+  sink.Write(time, m_node, "CacheHits", m_stats.m_cacheHits);
+  sink.Write(time, m_node, "CacheMisses", m_stats.m_cacheMisses);
+}
+
 void
 CsTracer::CacheHits(shared_ptr<const Interest>, shared_ptr<const Data>)
 {
@@ -22,6 +22,8 @@
 
 #include "ns3/ndnSIM/model/ndn-common.hpp"
 
+#include "ndn-binary-trace-sink.hpp"
+
 #include "ns3/ptr.h"
 #include "ns3/simple-ref-count.h"
 #include <ns3/nstime.h>
@@ -64,7 +66,8 @@ public:
   /**
    * @brief Helper method to install tracers on all simulation nodes
    *
-   * @param file File to which traces will be written.  If filename is -, then std::out is used
+   * @param file File to which traces will be written.  If filename is -, then std::out is used.
+   *             If filename ends with .bin or .bin.gz, the trace is written by BinaryTraceSink
    * @param averagingPeriod How often data will be written into the trace file (default, every half
    *second)
    *
@@ -80,7 +83,8 @@ public:
    * @brief Helper method to install tracers on the selected simulation nodes
    *
    * @param nodes Nodes on which to install tracer
-   * @param file File to which traces will be written.  If filename is -, then std::out is used
+   * @param file File to which traces will be written.  If filename is -, then std::out is used.
+   *             If filename ends with .bin or .bin.gz, the trace is written by BinaryTraceSink
    * @param averagingPeriod How often data will be written into the trace file (default, every half
    *second)
    *
@@ -96,7 +100,8 @@ public:
    * @brief Helper method to install tracers on a specific simulation node
    *
    * @param nodes Nodes on which to install tracer
-   * @param file File to which traces will be written.  If filename is -, then std::out is used
+   * @param file File to which traces will be written.  If filename is -, then std::out is used.
+   *             If filename ends with .bin or .bin.gz, the trace is written by BinaryTraceSink
    * @param averagingPeriod How often data will be written into the trace file (default, every half
    *second)
    *
@@ -124,6 +129,12 @@ public:
   Install(Ptr<Node> node, shared_ptr<std::ostream> outputStream,
           Time averagingPeriod = Seconds(0.5));
 
+  /**
+   * @brief Helper method to install a tracer writing to a binary sink on a specific node
+   */
+  static Ptr<CsTracer>
+  Install(Ptr<Node> node, shared_ptr<BinaryTraceSink> sink, Time averagingPeriod = Seconds(0.5));
+
   /**
    * @brief Explicit request to remove all statically created tracers
    *
@@ -147,6 +158,13 @@ public:
    */
   CsTracer(shared_ptr<std::ostream> os, const std::string& node);
 
+  /**
+   * @brief Trace constructor that attaches to the node using node pointer
+   * @param sink  binary sink, which must be started by the caller
+   * @param node  pointer to the node
+   */
+  CsTracer(shared_ptr<BinaryTraceSink> sink, Ptr<Node> node);
+
   /**
    * @brief Destructor
    */
@@ -168,6 +186,12 @@ public:
   void
   Print(std::ostream& os) const;
 
+  /**
+   * @brief Write current trace data to a binary sink
+   */
+  void
+  Write(BinaryTraceSink& sink) const;
+
 private:
   void
   Connect();
@@ -193,6 +217,7 @@ private:
   Ptr<Node> m_nodePtr;
 
   shared_ptr<std::ostream> m_os;
+  shared_ptr<BinaryTraceSink> m_sink;
 
   Time m_period;
   EventId m_printEvent;
@@ -25,11 +25,13 @@
 #include "ns3/simulator.h"
 #include "ns3/log.h"
 #include "ns3/node-list.h"
+#include "ns3/names.h"
 #include "ns3/ndnSIM/model/ndn-l3-protocol.hpp"
 
-#include "daemon/table/pit-entry.hpp"
+#include "daemon/fw/forwarder.hpp"
 
 #include <fstream>
+#include <sstream>
 #include <boost/lexical_cast.hpp>
 
 NS_LOG_COMPONENT_DEFINE("ndn.L3RateTracer");
@@ -37,6 +39,12 @@ NS_LOG_COMPONENT_DEFINE("ndn.L3RateTracer");
 namespace ns3 {
 namespace ndn {
 
+using Column = BinaryTraceSink::Column;
+
+static const std::vector<Column> BINARY_COLUMNS = {
+  Column::DOUBLE, Column::STRING, Column::INT64, Column::STRING, Column::STRING,
+  Column::DOUBLE, Column::DOUBLE, Column::DOUBLE, Column::DOUBLE};
+
 static std::list<std::tuple<shared_ptr<std::ostream>, std::list<Ptr<L3RateTracer>>>>
   g_tracers;
 
@@ -49,35 +57,7 @@ L3RateTracer::Destroy()
 void
 L3RateTracer::InstallAll(const std::string& file, Time averagingPeriod /* = Seconds (0.5)*/)
 {
-  std::list<Ptr<L3RateTracer>> tracers;
-  shared_ptr<std::ostream> outputStream;
-  if (file != "-") {
-    shared_ptr<std::ofstream> os(new std::ofstream());
-    os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
-
-    if (!os->is_open()) {
-      NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
-      return;
-    }
-
-    outputStream = os;
-  }
-  else {
-    outputStream = shared_ptr<std::ostream>(&std::cout, std::bind([]{}));
-  }
-
-  for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
-    Ptr<L3RateTracer> trace = Install(*node, outputStream, averagingPeriod);
-    tracers.push_back(trace);
-  }
-
-  if (tracers.size() > 0) {
-    // *m_l3RateTrace << "# "; // not necessary for R's read.table
-    tracers.front()->PrintHeader(*outputStream);
-    *outputStream << "\n";
-  }
-
-  g_tracers.push_back(std::make_tuple(outputStream, tracers));
+  Install(NodeContainer::GetGlobal(), file, averagingPeriod);
 }
 
 void
@@ -89,7 +69,14 @@ L3RateTracer::Install(const NodeContainer& nodes, const std::string& file,
 
   std::list<Ptr<L3RateTracer>> tracers;
   shared_ptr<std::ostream> outputStream;
-  if (file != "-") {
+  shared_ptr<BinaryTraceSink> sink;
+  if (BinaryTraceSink::IsBinaryFile(file)) {
+    sink = BinaryTraceSink::Open(file);
+    if (sink == nullptr) {
+      return;
+    }
+  }
+  else if (file != "-") {
     shared_ptr<std::ofstream> os(new std::ofstream());
     os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
 
@@ -105,14 +92,22 @@ L3RateTracer::Install(const NodeContainer& nodes, const std::string& file,
   }
 
   for (NodeContainer::Iterator node = nodes.Begin(); node != nodes.End(); node++) {
-    Ptr<L3RateTracer> trace = Install(*node, outputStream, averagingPeriod);
+    Ptr<L3RateTracer> trace = sink != nullptr ? Install(*node, sink, averagingPeriod)
+                                              : Install(*node, outputStream, averagingPeriod);
     tracers.push_back(trace);
   }
 
   if (tracers.size() > 0) {
-    // *m_l3RateTrace << "# "; // not necessary for R's read.table
-    tracers.front()->PrintHeader(*outputStream);
-    *outputStream << "\n";
+    if (sink != nullptr) {
+      std::ostringstream header;
+      tracers.front()->PrintHeader(header);
+      sink->Start(header.str(), BINARY_COLUMNS);
+    }
+    else {
+      // *m_l3RateTrace << "# "; // not necessary for R's read.table
+      tracers.front()->PrintHeader(*outputStream);
+      *outputStream << "\n";
+    }
   }
 
   g_tracers.push_back(std::make_tuple(outputStream, tracers));
@@ -122,59 +117,49 @@ void
 L3RateTracer::Install(Ptr<Node> node, const std::string& file,
                       Time averagingPeriod /* = Seconds (0.5)*/)
 {
-  using namespace boost;
-  using namespace std;
-
-  std::list<Ptr<L3RateTracer>> tracers;
-  shared_ptr<std::ostream> outputStream;
-  if (file != "-") {
-    shared_ptr<std::ofstream> os(new std::ofstream());
-    os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
-
-    if (!os->is_open()) {
-      NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
-      return;
-    }
-
-    outputStream = os;
-  }
-  else {
-    outputStream = shared_ptr<std::ostream>(&std::cout, std::bind([]{}));
-  }
+  Install(NodeContainer(node), file, averagingPeriod);
+}
 
-  Ptr<L3RateTracer> trace = Install(node, outputStream, averagingPeriod);
-  tracers.push_back(trace);
+Ptr<L3RateTracer>
+L3RateTracer::Install(Ptr<Node> node, shared_ptr<std::ostream> outputStream,
+                      Time averagingPeriod /* = Seconds (0.5)*/)
+{
+  NS_LOG_DEBUG("Node: " << node->GetId());
 
-  if (tracers.size() > 0) {
-    // *m_l3RateTrace << "# "; // not necessary for R's read.table
-    tracers.front()->PrintHeader(*outputStream);
-    *outputStream << "\n";
-  }
+  Ptr<L3RateTracer> trace = Create<L3RateTracer>(outputStream, node);
+  trace->SetAveragingPeriod(averagingPeriod);
 
-  g_tracers.push_back(std::make_tuple(outputStream, tracers));
+  return trace;
 }
 
 Ptr<L3RateTracer>
-L3RateTracer::Install(Ptr<Node> node, shared_ptr<std::ostream> outputStream,
+L3RateTracer::Install(Ptr<Node> node, shared_ptr<BinaryTraceSink> sink,
                       Time averagingPeriod /* = Seconds (0.5)*/)
 {
   NS_LOG_DEBUG("Node: " << node->GetId());
 
-  Ptr<L3RateTracer> trace = Create<L3RateTracer>(outputStream, node);
+  Ptr<L3RateTracer> trace = Create<L3RateTracer>(sink, node);
   trace->SetAveragingPeriod(averagingPeriod);
 
   return trace;
 }
 
 L3RateTracer::L3RateTracer(shared_ptr<std::ostream> os, Ptr<Node> node)
-  : L3Tracer(node)
+  : L3Tracer(node, false)
   , m_os(os)
 {
   SetAveragingPeriod(Seconds(1.0));
 }
 
+L3RateTracer::L3RateTracer(shared_ptr<BinaryTraceSink> sink, Ptr<Node> node)
+  : L3Tracer(node, false)
+  , m_sink(sink)
+{
+  SetAveragingPeriod(Seconds(1.0));
+}
+
 L3RateTracer::L3RateTracer(shared_ptr<std::ostream> os, const std::string& node)
-  : L3Tracer(node)
+  : L3Tracer(Names::Find<Node>(node), false)
   , m_os(os)
 {
   SetAveragingPeriod(Seconds(1.0));
@@ -196,8 +181,13 @@ L3RateTracer::SetAveragingPeriod(const Time& period)
 void
 L3RateTracer::PeriodicPrinter()
 {
-  Print(*m_os);
-  Reset();
+  Sample();
+  if (m_sink != nullptr) {
+    Write(*m_sink);
+  }
+  else {
+    Print(*m_os);
+  }
 
   m_printEvent = Simulator::Schedule(m_period, &L3RateTracer::PeriodicPrinter, this);
 }
@@ -246,21 +236,23 @@ const double alpha = 0.8;
   STATS(3).fieldName = /*new value*/ alpha * RATE(1, fieldName) / 1024.0                           \
                        + /*old value*/ (1 - alpha) * STATS(3).fieldName;                           \
                                                                                                    \
-  os << time.ToDouble(Time::S) << "\t" << m_node << "\t";                                          \
   if (stats.first != nfd::face::INVALID_FACEID) {                                                  \
-    os << stats.first << "\t";                                                                     \
     NS_ASSERT(m_faceInfos.find(stats.first) != m_faceInfos.end());                                 \
-    os << m_faceInfos.find(stats.first)->second << "\t";                                           \
+    writeRow(time.ToDouble(Time::S), static_cast<int64_t>(stats.first),                            \
+             m_faceInfos.find(stats.first)->second, printName, STATS(2).fieldName,                 \
+             STATS(3).fieldName, STATS(0).fieldName, STATS(1).fieldName / 1024.0);                 \
   }                                                                                                \
   else {                                                                                           \
-    os << "-1\tall\t";                                                                             \
-  }                                                                                                \
-  os << printName << "\t" << STATS(2).fieldName << "\t" << STATS(3).fieldName << "\t"              \
-     << STATS(0).fieldName << "\t" << STATS(1).fieldName / 1024.0 << "\n";
+    writeRow(time.ToDouble(Time::S), static_cast<int64_t>(-1), ALL, printName,                     \
+             STATS(2).fieldName, STATS(3).fieldName, STATS(0).fieldName,                           \
+             STATS(1).fieldName / 1024.0);                                                         \
+  }
 
+template<class RowWriter>
 void
-L3RateTracer::Print(std::ostream& os) const
+L3RateTracer::WriteRows(const RowWriter& writeRow) const
 {
+  static const std::string ALL = "all";
   Time time = Simulator::Now();
 
   for (auto& stats : m_stats) {
@@ -294,103 +286,94 @@ L3RateTracer::Print(std::ostream& os) const
 }
 
 void
-L3RateTracer::OutInterests(const Interest& interest, const Face& face)
-{
-  AddInfo(face);
-  std::get<0>(m_stats[face.getId()]).m_outInterests++;
-  if (interest.hasWire()) {
-    std::get<1>(m_stats[face.getId()]).m_outInterests +=
-      interest.wireEncode().size();
-  }
-}
-
-void
-L3RateTracer::InInterests(const Interest& interest, const Face& face)
-{
-  AddInfo(face);
-  std::get<0>(m_stats[face.getId()]).m_inInterests++;
-  if (interest.hasWire()) {
-    std::get<1>(m_stats[face.getId()]).m_inInterests +=
-      interest.wireEncode().size();
-  }
-}
-
-void
-L3RateTracer::OutData(const Data& data, const Face& face)
-{
-  AddInfo(face);
-  std::get<0>(m_stats[face.getId()]).m_outData++;
-  if (data.hasWire()) {
-    std::get<1>(m_stats[face.getId()]).m_outData +=
-      data.wireEncode().size();
-  }
-}
-
-void
-L3RateTracer::InData(const Data& data, const Face& face)
+L3RateTracer::Print(std::ostream& os) const
 {
-  AddInfo(face);
-  std::get<0>(m_stats[face.getId()]).m_inData++;
-  if (data.hasWire()) {
-    std::get<1>(m_stats[face.getId()]).m_inData +=
-      data.wireEncode().size();
-  }
+  WriteRows([this, &os] (double time, int64_t faceId, const std::string& faceDescr,
+                         const char* type, double packets, double kilobytes,
+                         double packetRaw, double kilobytesRaw) {
+    os << time << "\t" << m_node << "\t" << faceId << "\t" << faceDescr << "\t" << type << "\t"
+       << packets << "\t" << kilobytes << "\t" << packetRaw << "\t" << kilobytesRaw << "\n";
+  });
 }
 
 void
-L3RateTracer::OutNack(const lp::Nack& nack, const Face& face)
+L3RateTracer::Write(BinaryTraceSink& sink) const
 {
-  AddInfo(face);
-  std::get<0>(m_stats[face.getId()]).m_outNack++;
-  if (nack.getInterest().hasWire()) {
-    std::get<1>(m_stats[face.getId()]).m_outNack +=
-      nack.getInterest().wireEncode().size();
-  }
+  WriteRows([this, &sink] (double time, int64_t faceId, const std::string& faceDescr,
+                           const char* type, double packets, double kilobytes,
+                           double packetRaw, double kilobytesRaw) {
+    sink.Write(time, m_node, faceId, faceDescr, type, packets, kilobytes, packetRaw, kilobytesRaw);
+  });
 }
 
 void
-L3RateTracer::InNack(const lp::Nack& nack, const Face& face)
+L3RateTracer::Sample()
 {
-  AddInfo(face);
-  std::get<0>(m_stats[face.getId()]).m_inNack++;
-  if (nack.getInterest().hasWire()) {
-    std::get<1>(m_stats[face.getId()]).m_inNack +=
-      nack.getInterest().wireEncode().size();
-  }
-}
+  Reset();
 
-void
-L3RateTracer::SatisfiedInterests(const nfd::pit::Entry& entry, const Face&, const Data&)
-{
-  std::get<0>(m_stats[nfd::face::INVALID_FACEID]).m_satisfiedInterests++;
-  // no "size" stats
+  Ptr<L3Protocol> l3 = m_nodePtr->GetObject<L3Protocol>();
 
-  for (const auto& in : entry.getInRecords()) {
-    AddInfo(in.getFace());
-    std::get<0>(m_stats[(in.getFace()).getId()]).m_satisfiedInterests ++;
-  }
+  for (const Face& face : l3->getFaceTable()) {
+    if (face.getId() <= nfd::face::FACEID_RESERVED_MAX) {
+      continue;
+    }
 
-  for (const auto& out : entry.getOutRecords()) {
-    AddInfo(out.getFace());
-    std::get<0>(m_stats[(out.getFace()).getId()]).m_outSatisfiedInterests ++;
+    nfd::face::FaceCounters::Snapshot current = face.getCounters().snapshot();
+    nfd::face::FaceCounters::Snapshot& last = m_lastFaceCounters[face.getId()];
+
+    Stats packets;
+    packets.m_inInterests = current.nInInterests - last.nInInterests;
+    packets.m_outInterests = current.nOutInterests - last.nOutInterests;
+    packets.m_inData = current.nInData - last.nInData;
+    packets.m_outData = current.nOutData - last.nOutData;
+    packets.m_inNack = current.nInNacks - last.nInNacks;
+    packets.m_outNack = current.nOutNacks - last.nOutNacks;
+    packets.m_satisfiedInterests = current.nInSatisfiedInterests - last.nInSatisfiedInterests;
+    packets.m_timedOutInterests = current.nInUnsatisfiedInterests - last.nInUnsatisfiedInterests;
+    packets.m_outSatisfiedInterests = current.nOutSatisfiedInterests - last.nOutSatisfiedInterests;
+    packets.m_outTimedOutInterests = current.nOutUnsatisfiedInterests - last.nOutUnsatisfiedInterests;
+
+    Stats bytes;
+    bytes.Reset(); // no "size" stats for satisfied and timed out Interests
+    bytes.m_inInterests = current.nInInterestBytes - last.nInInterestBytes;
+    bytes.m_outInterests = current.nOutInterestBytes - last.nOutInterestBytes;
+    bytes.m_inData = current.nInDataBytes - last.nInDataBytes;
+    bytes.m_outData = current.nOutDataBytes - last.nOutDataBytes;
+    bytes.m_inNack = current.nInNackBytes - last.nInNackBytes;
+    bytes.m_outNack = current.nOutNackBytes - last.nOutNackBytes;
+
+    last = current;
+
+    auto stats = m_stats.find(face.getId());
+    if (stats == m_stats.end()) {
+      // faces are reported starting from their first activity
+      if (packets.m_inInterests + packets.m_outInterests + packets.m_inData + packets.m_outData +
+          packets.m_inNack + packets.m_outNack + packets.m_satisfiedInterests +
+          packets.m_timedOutInterests + packets.m_outSatisfiedInterests +
+          packets.m_outTimedOutInterests == 0) {
+        continue;
+      }
+      AddInfo(face);
+      stats = m_stats.emplace(face.getId(), std::tuple<Stats, Stats, Stats, Stats>{}).first;
+    }
+    std::get<0>(stats->second) = packets;
+    std::get<1>(stats->second) = bytes;
   }
-}
 
-void
-L3RateTracer::TimedOutInterests(const nfd::pit::Entry& entry)
-{
-  std::get<0>(m_stats[nfd::face::INVALID_FACEID]).m_timedOutInterests++;
-  // no "size" stats
-
-  for (const auto& in : entry.getInRecords()) {
-    AddInfo(in.getFace());
-    std::get<0>(m_stats[(in.getFace()).getId()]).m_timedOutInterests++;
-  }
+  nfd::ForwarderCounters::Snapshot current = l3->getForwarder()->getCounters().snapshot();
+  uint64_t nSatisfied = current.nSatisfiedInterests - m_lastForwarderCounters.nSatisfiedInterests;
+  uint64_t nUnsatisfied = current.nUnsatisfiedInterests - m_lastForwarderCounters.nUnsatisfiedInterests;
+  m_lastForwarderCounters = current;
 
-  for (const auto& out : entry.getOutRecords()) {
-    AddInfo(out.getFace());
-    std::get<0>(m_stats[(out.getFace()).getId()]).m_outTimedOutInterests++;
+  auto stats = m_stats.find(nfd::face::INVALID_FACEID);
+  if (stats == m_stats.end()) {
+    if (nSatisfied + nUnsatisfied == 0) {
+      return;
+    }
+    stats = m_stats.emplace(nfd::face::INVALID_FACEID, std::tuple<Stats, Stats, Stats, Stats>{}).first;
   }
+  std::get<0>(stats->second).m_satisfiedInterests = nSatisfied;
+  std::get<0>(stats->second).m_timedOutInterests = nUnsatisfied;
 }
 
 void
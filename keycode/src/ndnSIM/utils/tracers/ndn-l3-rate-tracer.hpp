@@ -23,6 +23,10 @@
 #include "ns3/ndnSIM/model/ndn-common.hpp"
 
 #include "ndn-l3-tracer.hpp"
+#include "ndn-binary-trace-sink.hpp"
+
+#include "ns3/ndnSIM/NFD/daemon/face/face-counters.hpp"
+#include "ns3/ndnSIM/NFD/daemon/fw/forwarder-counters.hpp"
 
 #include "ns3/nstime.h"
 #include "ns3/event-id.h"
@@ -44,7 +48,8 @@ public:
   /**
    * @brief Helper method to install tracers on all simulation nodes
    *
-   * @param file File to which traces will be written.  If filename is -, then std::out is used
+   * @param file File to which traces will be written.  If filename is -, then std::out is used.
+   *             If filename ends with .bin or .bin.gz, the trace is written by BinaryTraceSink
    * @param averagingPeriod Defines averaging period for the rate calculation,
    *        as well as how often data will be written into the trace file (default, every half
    *second)
@@ -56,7 +61,8 @@ public:
    * @brief Helper method to install tracers on the selected simulation nodes
    *
    * @param nodes Nodes on which to install tracer
-   * @param file File to which traces will be written.  If filename is -, then std::out is used
+   * @param file File to which traces will be written.  If filename is -, then std::out is used.
+   *             If filename ends with .bin or .bin.gz, the trace is written by BinaryTraceSink
    * @param averagingPeriod How often data will be written into the trace file (default, every half
    *second)
    */
@@ -67,7 +73,8 @@ public:
    * @brief Helper method to install tracers on a specific simulation node
    *
    * @param nodes Nodes on which to install tracer
-   * @param file File to which traces will be written.  If filename is -, then std::out is used
+   * @param file File to which traces will be written.  If filename is -, then std::out is used.
+   *             If filename ends with .bin or .bin.gz, the trace is written by BinaryTraceSink
    * @param averagingPeriod How often data will be written into the trace file (default, every half
    *second)
    */
@@ -97,6 +104,13 @@ public:
    */
   L3RateTracer(shared_ptr<std::ostream> os, const std::string& node);
 
+  /**
+   * @brief Trace constructor that attaches to the node using node pointer
+   * @param sink  binary sink, which must be started by the caller
+   * @param node  pointer to the node
+   */
+  L3RateTracer(shared_ptr<BinaryTraceSink> sink, Ptr<Node> node);
+
   /**
    * @brief Destructor
    */
@@ -118,6 +132,12 @@ public:
   Install(Ptr<Node> node, shared_ptr<std::ostream> outputStream,
           Time averagingPeriod = Seconds(0.5));
 
+  /**
+   * @brief Helper method to install a tracer writing to a binary sink on a specific node
+   */
+  static Ptr<L3RateTracer>
+  Install(Ptr<Node> node, shared_ptr<BinaryTraceSink> sink, Time averagingPeriod = Seconds(0.5));
+
   // from L3Tracer
   virtual void
   PrintHeader(std::ostream& os) const;
@@ -125,31 +145,53 @@ public:
   virtual void
   Print(std::ostream& os) const;
 
+  /**
+   * @brief Write current trace data to a binary sink
+   */
+  void
+  Write(BinaryTraceSink& sink) const;
+
 protected:
-  // from L3Tracer
+  // from L3Tracer; not connected, the rates are sampled from face and forwarder counters
   virtual void
-  OutInterests(const Interest& interest, const Face& face);
+  OutInterests(const Interest& interest, const Face& face)
+  {
+  }
 
   virtual void
-  InInterests(const Interest& interest, const Face& face);
+  InInterests(const Interest& interest, const Face& face)
+  {
+  }
 
   virtual void
-  OutData(const Data& data, const Face& face);
+  OutData(const Data& data, const Face& face)
+  {
+  }
 
   virtual void
-  InData(const Data& data, const Face& face);
+  InData(const Data& data, const Face& face)
+  {
+  }
 
   virtual void
-  OutNack(const lp::Nack& nack, const Face& face);
+  OutNack(const lp::Nack& nack, const Face& face)
+  {
+  }
 
   virtual void
-  InNack(const lp::Nack& nack, const Face& face);
+  InNack(const lp::Nack& nack, const Face& face)
+  {
+  }
 
   virtual void
-  SatisfiedInterests(const nfd::pit::Entry&, const Face&, const Data&);
+  SatisfiedInterests(const nfd::pit::Entry&, const Face&, const Data&)
+  {
+  }
 
   virtual void
-  TimedOutInterests(const nfd::pit::Entry&);
+  TimedOutInterests(const nfd::pit::Entry&)
+  {
+  }
 
 private:
   void
@@ -161,16 +203,34 @@ private:
   void
   Reset();
 
+  /**
+   * @brief Compute per-period values from the difference between the current counters
+   *        of node's faces and forwarder and those at the previous period
+   */
+  void
+  Sample();
+
   void
   AddInfo(const Face& face);
 
+  /**
+   * @brief Call @p writeRow with the columns of every row of current trace data
+   */
+  template<class RowWriter>
+  void
+  WriteRows(const RowWriter& writeRow) const;
+
 private:
   shared_ptr<std::ostream> m_os;
+  shared_ptr<BinaryTraceSink> m_sink;
   Time m_period;
   EventId m_printEvent;
 
   mutable std::map<nfd::FaceId, std::tuple<Stats, Stats, Stats, Stats>> m_stats;
   std::map<nfd::FaceId, std::string> m_faceInfos; // needed, because face may no longer exists at the time of stat printing
+
+  std::map<nfd::FaceId, nfd::face::FaceCounters::Snapshot> m_lastFaceCounters;
+  nfd::ForwarderCounters::Snapshot m_lastForwarderCounters = {};
 };
 
 } // namespace ndn
@@ -32,11 +32,18 @@ namespace ns3 {
 namespace ndn {
 
 L3Tracer::L3Tracer(Ptr<Node> node)
+  : L3Tracer(node, true)
+{
+}
+
+L3Tracer::L3Tracer(Ptr<Node> node, bool connect)
   : m_nodePtr(node)
 {
   m_node = boost::lexical_cast<std::string>(m_nodePtr->GetId());
 
-  Connect();
+  if (connect) {
+    Connect();
+  }
 
   std::string name = Names::FindName(node);
   if (!name.empty()) {
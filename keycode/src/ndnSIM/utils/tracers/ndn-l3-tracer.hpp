@@ -73,6 +73,17 @@ public:
   Print(std::ostream& os) const = 0;
 
 protected:
+  /**
+   * @brief Trace constructor for tracers that do not need per-packet trace sources
+   *
+   * Derived tracers that sample the face and forwarder counters use this constructor,
+   * so that no callbacks are invoked on the forwarding path.
+   *
+   * @param node     pointer to the node
+   * @param connect  whether to connect to the L3Protocol trace sources
+   */
+  L3Tracer(Ptr<Node> node, bool connect);
+
   void
   Connect();
 
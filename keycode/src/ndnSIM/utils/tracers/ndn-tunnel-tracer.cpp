@@ -0,0 +1,276 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-tunnel-tracer.hpp"
+#include "ns3/node.h"
+#include "ns3/packet.h"
+#include "ns3/config.h"
+#include "ns3/names.h"
+#include "ns3/callback.h"
+
+#include "ns3/simulator.h"
+#include "ns3/log.h"
+
+#include <boost/lexical_cast.hpp>
+
+#include <fstream>
+
+NS_LOG_COMPONENT_DEFINE("ndn.TunnelTracer");
+
+namespace ns3 {
+namespace ndn {
+
+static std::list<std::tuple<shared_ptr<std::ostream>, std::list<Ptr<TunnelTracer>>>> g_tracers;
+
+void
+TunnelTracer::Destroy()
+{
+  g_tracers.clear();
+}
+
+void
+TunnelTracer::InstallAll(const std::string& file, Time averagingPeriod /* = Seconds (0.5)*/)
+{
+  Install(NodeContainer::GetGlobal(), file, averagingPeriod);
+}
+
+void
+TunnelTracer::Install(const NodeContainer& nodes, const std::string& file,
+                      Time averagingPeriod /* = Seconds (0.5)*/)
+{
+  std::list<Ptr<TunnelTracer>> tracers;
+  shared_ptr<std::ostream> outputStream;
+  if (file != "-") {
+    shared_ptr<std::ofstream> os(new std::ofstream());
+    os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
+
+    if (!os->is_open()) {
+      NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
+      return;
+    }
+
+    outputStream = os;
+  }
+  else {
+    outputStream = shared_ptr<std::ostream>(&std::cout, std::bind([]{}));
+  }
+
+  for (NodeContainer::Iterator node = nodes.Begin(); node != nodes.End(); node++) {
+    Ptr<TunnelTracer> trace = Install(*node, outputStream, averagingPeriod);
+    tracers.push_back(trace);
+  }
+
+  if (tracers.size() > 0) {
+    tracers.front()->PrintHeader(*outputStream);
+    *outputStream << "\n";
+  }
+
+  g_tracers.push_back(std::make_tuple(outputStream, tracers));
+}
+
+void
+TunnelTracer::Install(Ptr<Node> node, const std::string& file,
+                      Time averagingPeriod /* = Seconds (0.5)*/)
+{
+  Install(NodeContainer(node), file, averagingPeriod);
+}
+
+Ptr<TunnelTracer>
+TunnelTracer::Install(Ptr<Node> node, shared_ptr<std::ostream> outputStream,
+                      Time averagingPeriod /* = Seconds (0.5)*/)
+{
+  NS_LOG_DEBUG("Node: " << node->GetId());
+
+  Ptr<TunnelTracer> trace = Create<TunnelTracer>(outputStream, node);
+  trace->SetAveragingPeriod(averagingPeriod);
+
+  return trace;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////
+
+TunnelTracer::TunnelTracer(shared_ptr<std::ostream> os, Ptr<Node> node)
+  : m_nodePtr(node)
+  , m_os(os)
+  , m_gttHits(0)
+  , m_gttMisses(0)
+  , m_dttSize(0)
+{
+  m_node = boost::lexical_cast<std::string>(m_nodePtr->GetId());
+
+  Connect();
+
+  std::string name = Names::FindName(node);
+  if (!name.empty()) {
+    m_node = name;
+  }
+}
+
+TunnelTracer::~TunnelTracer()
+{
+  m_printEvent.Cancel();
+}
+
+void
+TunnelTracer::Connect()
+{
+  std::string apps = "/NodeList/" + m_node + "/ApplicationList/*/";
+
+  Config::ConnectWithoutContextFailSafe(apps + "TunnelTx",
+                                        MakeCallback(&TunnelTracer::TunnelTx, this));
+  Config::ConnectWithoutContextFailSafe(apps + "TunnelRx",
+                                        MakeCallback(&TunnelTracer::TunnelRx, this));
+  Config::ConnectWithoutContextFailSafe(apps + "Drop", MakeCallback(&TunnelTracer::Drop, this));
+  Config::ConnectWithoutContextFailSafe(apps + "GttLookup",
+                                        MakeCallback(&TunnelTracer::GttLookup, this));
+  Config::ConnectWithoutContextFailSafe(apps + "DttSize",
+                                        MakeCallback(&TunnelTracer::DttSize, this));
+
+  Reset();
+}
+
+void
+TunnelTracer::SetAveragingPeriod(const Time& period)
+{
+  m_period = period;
+  m_printEvent.Cancel();
+  m_printEvent = Simulator::Schedule(m_period, &TunnelTracer::PeriodicPrinter, this);
+}
+
+void
+TunnelTracer::PeriodicPrinter()
+{
+  Print(*m_os);
+  Reset();
+
+  m_printEvent = Simulator::Schedule(m_period, &TunnelTracer::PeriodicPrinter, this);
+}
+
+void
+TunnelTracer::Reset()
+{
+  for (auto& stats : m_stats) {
+    stats.second.Reset();
+  }
+  m_gttHits = 0;
+  m_gttMisses = 0;
+}
+
+void
+TunnelTracer::PrintHeader(std::ostream& os) const
+{
+  os << "Time"
+     << "\t"
+
+     << "Node"
+     << "\t"
+     << "Peer"
+     << "\t"
+
+     << "Type"
+     << "\t"
+     << "Value";
+}
+
+#define PRINTER(peer, printName, value)                                                          \
+  os << time.ToDouble(Time::S) << "\t" << m_node << "\t" << peer << "\t" << printName << "\t"    \
+     << (value) << "\n";
+
+void
+TunnelTracer::Print(std::ostream& os) const
+{
+  Time time = Simulator::Now();
+  double period = m_period.ToDouble(Time::S);
+
+  for (const auto& stats : m_stats) {
+    const tunnel::Stats& peer = stats.second;
+    PRINTER(stats.first, "OutPackets", peer.m_outPackets / period);
+    PRINTER(stats.first, "OutKilobytes", peer.m_outBytes / 1024.0 / period);
+    PRINTER(stats.first, "InPackets", peer.m_inPackets / period);
+    PRINTER(stats.first, "InKilobytes", peer.m_inBytes / 1024.0 / period);
+    PRINTER(stats.first, "Drops", peer.m_drops / period);
+    PRINTER(stats.first, "InDelayS",
+            peer.m_inDelayed > 0 ? peer.m_inDelay.ToDouble(Time::S) / peer.m_inDelayed : 0.0);
+  }
+
+  PRINTER("all", "GttHits", m_gttHits / period);
+  PRINTER("all", "GttMisses", m_gttMisses / period);
+  PRINTER("all", "DttSize", m_dttSize);
+}
+
+tunnel::Stats&
+TunnelTracer::GetStats(Ipv4Address peer)
+{
+  auto stats = m_stats.find(peer);
+  if (stats == m_stats.end()) {
+    stats = m_stats.emplace(peer, tunnel::Stats()).first;
+    stats->second.Reset();
+  }
+  return stats->second;
+}
+
+void
+TunnelTracer::TunnelTx(Ptr<const Packet> packet, Ipv4Address peer)
+{
+  tunnel::Stats& stats = GetStats(peer);
+  stats.m_outPackets++;
+  stats.m_outBytes += packet->GetSize();
+}
+
+void
+TunnelTracer::TunnelRx(Ptr<const Packet> packet, Ipv4Address peer, Time delay)
+{
+  tunnel::Stats& stats = GetStats(peer);
+  stats.m_inPackets++;
+  stats.m_inBytes += packet->GetSize();
+  // the peer did not stamp the packet
+  if (delay.IsNegative()) {
+    return;
+  }
+  stats.m_inDelayed++;
+  stats.m_inDelay += delay;
+}
+
+void
+TunnelTracer::Drop(Ptr<const Packet>, Ipv4Address peer)
+{
+  GetStats(peer).m_drops++;
+}
+
+void
+TunnelTracer::GttLookup(const ::ndn::NameView&, Ipv4Address, bool isFound)
+{
+  if (isFound) {
+    m_gttHits++;
+  }
+  else {
+    m_gttMisses++;
+  }
+}
+
+void
+TunnelTracer::DttSize(uint32_t, uint32_t newSize)
+{
+  m_dttSize = newSize;
+}
+
+} // namespace ndn
+} // namespace ns3
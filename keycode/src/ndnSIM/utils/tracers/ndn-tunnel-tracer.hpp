@@ -0,0 +1,220 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_TUNNEL_TRACER_H
+#define NDN_TUNNEL_TRACER_H
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include <ndn-cxx/name-view.hpp>
+
+#include "ns3/ptr.h"
+#include "ns3/simple-ref-count.h"
+#include "ns3/ipv4-address.h"
+#include <ns3/nstime.h>
+#include <ns3/event-id.h>
+#include <ns3/node-container.h>
+
+#include <tuple>
+#include <map>
+#include <list>
+
+namespace ns3 {
+
+class Node;
+class Packet;
+
+namespace ndn {
+
+namespace tunnel {
+
+/// @cond include_hidden
+struct Stats {
+  inline void
+  Reset()
+  {
+    m_outPackets = 0;
+    m_outBytes = 0;
+    m_inPackets = 0;
+    m_inBytes = 0;
+    m_drops = 0;
+    m_inDelayed = 0;
+    m_inDelay = Seconds(0);
+  }
+  uint64_t m_outPackets;
+  uint64_t m_outBytes;
+  uint64_t m_inPackets;
+  uint64_t m_inBytes;
+  uint64_t m_drops;
+  uint64_t m_inDelayed; ///< received packets with a known delay
+  Time m_inDelay; ///< sum of the delays of the received packets
+};
+/// @endcond
+}
+
+/**
+ * @ingroup ndn-tracers
+ * @brief Tracer of the IP tunnels between NDN gateways
+ *
+ * The tracer connects to the trace sources of the gateway applications on the node: TunnelTx,
+ * TunnelRx and Drop, with the UDP payload and the address of the peer gateway, TunnelRx also with
+ * the time since the peer encapsulated the packet, GttLookup, with the prefix, the gateway found,
+ * and whether one was found, and DttSize, the number of prefixes of the DTT.
+ *
+ * Every averaging period, it writes for every peer the OutPackets, OutKilobytes, InPackets,
+ * InKilobytes, and Drops rates (per second), and the mean InDelayS (in seconds) of the packets
+ * received, over those whose delay is known (TunnelRx reports a negative delay otherwise); and, with "all" as peer, the GttHits and GttMisses rates and the DttSize.  Packets
+ * dropped because the GTT or DTT has no gateway for them are reported for peer 0.0.0.0.
+ */
+class TunnelTracer : public SimpleRefCount<TunnelTracer> {
+public:
+  /**
+   * @brief Helper method to install tracers on all simulation nodes
+   *
+   * @param file File to which traces will be written.  If filename is -, then std::out is used
+   * @param averagingPeriod Defines averaging period for the rate calculation,
+   *        as well as how often data will be written into the trace file (default, every half
+   *        second)
+   */
+  static void
+  InstallAll(const std::string& file, Time averagingPeriod = Seconds(0.5));
+
+  /**
+   * @brief Helper method to install tracers on the selected simulation nodes
+   *
+   * @param nodes Nodes on which to install tracer
+   * @param file File to which traces will be written.  If filename is -, then std::out is used
+   * @param averagingPeriod How often data will be written into the trace file (default, every half
+   *        second)
+   */
+  static void
+  Install(const NodeContainer& nodes, const std::string& file, Time averagingPeriod = Seconds(0.5));
+
+  /**
+   * @brief Helper method to install tracers on a specific simulation node
+   *
+   * @param node Node on which to install tracer
+   * @param file File to which traces will be written.  If filename is -, then std::out is used
+   * @param averagingPeriod How often data will be written into the trace file (default, every half
+   *        second)
+   */
+  static void
+  Install(Ptr<Node> node, const std::string& file, Time averagingPeriod = Seconds(0.5));
+
+  /**
+   * @brief Helper method to install tracers on a specific simulation node
+   *
+   * @param node Node on which to install tracer
+   * @param outputStream Smart pointer to a stream
+   * @param averagingPeriod How often data will be written into the trace file (default, every half
+   *        second)
+   *
+   * @returns the tracer, which needs to be preserved for the lifetime of simulation
+   */
+  static Ptr<TunnelTracer>
+  Install(Ptr<Node> node, shared_ptr<std::ostream> outputStream,
+          Time averagingPeriod = Seconds(0.5));
+
+  /**
+   * @brief Explicit request to remove all statically created tracers
+   *
+   * This method can be helpful if simulation scenario contains several independent run,
+   * or if it is desired to do a postprocessing of the resulting data
+   */
+  static void
+  Destroy();
+
+  /**
+   * @brief Trace constructor that attaches to the gateway applications of the node
+   * @param os    reference to the output stream
+   * @param node  pointer to the node
+   */
+  TunnelTracer(shared_ptr<std::ostream> os, Ptr<Node> node);
+
+  /**
+   * @brief Destructor
+   */
+  ~TunnelTracer();
+
+  /**
+   * @brief Print head of the trace (e.g., for post-processing)
+   *
+   * @param os reference to output stream
+   */
+  void
+  PrintHeader(std::ostream& os) const;
+
+  /**
+   * @brief Print current trace data
+   *
+   * @param os reference to output stream
+   */
+  void
+  Print(std::ostream& os) const;
+
+private:
+  void
+  Connect();
+
+  void
+  TunnelTx(Ptr<const Packet> packet, Ipv4Address peer);
+
+  void
+  TunnelRx(Ptr<const Packet> packet, Ipv4Address peer, Time delay);
+
+  void
+  Drop(Ptr<const Packet> packet, Ipv4Address peer);
+
+  void
+  GttLookup(const ::ndn::NameView& prefix, Ipv4Address gateway, bool isFound);
+
+  void
+  DttSize(uint32_t oldSize, uint32_t newSize);
+
+  tunnel::Stats&
+  GetStats(Ipv4Address peer);
+
+private:
+  void
+  SetAveragingPeriod(const Time& period);
+
+  void
+  Reset();
+
+  void
+  PeriodicPrinter();
+
+private:
+  std::string m_node;
+  Ptr<Node> m_nodePtr;
+
+  shared_ptr<std::ostream> m_os;
+
+  Time m_period;
+  EventId m_printEvent;
+  std::map<Ipv4Address, tunnel::Stats> m_stats; ///< @brief statistics of every peer gateway
+  uint64_t m_gttHits;
+  uint64_t m_gttMisses;
+  uint32_t m_dttSize;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_TUNNEL_TRACER_H